@@ -20,6 +20,8 @@
 #include "Controller.h"
 #include "SystemInfo.h"
 
+#include <cinttypes>
+
 namespace WPEFramework {
 
 namespace Plugin {
@@ -34,6 +36,52 @@ namespace Plugin {
     static Core::ProxyPoolType<Web::JSONBodyType<PluginHost::MetaData::Service>> jsonBodyServiceFactory(1);
     static Core::ProxyPoolType<Web::TextBody> jsonBodyTextFactory(2);
 
+    // Helpers for the Prometheus text exposition format (version 0.0.4), they write straight into the text.
+    static void Append(string& text, const TCHAR format[], ...)
+    {
+        TCHAR buffer[128];
+        va_list ap;
+
+        va_start(ap, format);
+        int length = ::vsnprintf(buffer, sizeof(buffer), format, ap);
+        va_end(ap);
+
+        if (length > 0) {
+            text.append(buffer, std::min(static_cast<size_t>(length), sizeof(buffer) - 1));
+        }
+    }
+    static void Family(string& text, const TCHAR name[], const TCHAR type[], const TCHAR help[])
+    {
+        text += _T("# HELP ");
+        text += name;
+        text += ' ';
+        text += help;
+        text += _T("\n# TYPE ");
+        text += name;
+        text += ' ';
+        text += type;
+        text += '\n';
+    }
+    static void Label(string& text, const TCHAR key[], const string& value)
+    {
+        text += (text.back() == '{' ? _T("") : _T(","));
+        text += key;
+        text += _T("=\"");
+
+        for (const TCHAR character : value) {
+            if ((character == '\\') || (character == '"')) {
+                text += '\\';
+                text += character;
+            } else if (character == '\n') {
+                text += _T("\\n");
+            } else {
+                text += character;
+            }
+        }
+
+        text += '"';
+    }
+
     void Controller::SubSystems(Core::JSON::ArrayType<Core::JSON::EnumType<PluginHost::ISubSystem::subsystem>>::ConstIterator& index)
     {
         PluginHost::ISubSystem* subSystem = _service->SubSystems();
@@ -239,6 +287,12 @@ namespace Plugin {
 
             WorkerPoolMetaData(response->Process);
 
+            result->Body(Core::proxy_cast<Web::IBody>(response));
+        } else if (index.Current() == _T("Timeline")) {
+            Core::ProxyType<Web::JSONBodyType<PluginHost::MetaData>> response(jsonBodyMetaDataFactory.Element());
+
+            _pluginServer->Startup().GetMetaData(response->Activations);
+
             result->Body(Core::proxy_cast<Web::IBody>(response));
         } else if (index.Current() == _T("Discovery")) {
             Core::ProxyType<Web::JSONBodyType<PluginHost::MetaData>> response(jsonBodyMetaDataFactory.Element());
@@ -250,6 +304,13 @@ namespace Plugin {
                 response->Bridges.Add(newElement);
             }
 
+            result->Body(Core::proxy_cast<Web::IBody>(response));
+        } else if (index.Current() == _T("Metrics")) {
+            Core::ProxyType<Web::TextBody> response(jsonBodyTextFactory.Element());
+
+            Exposition(*response);
+
+            result->ContentType = Web::MIME_TEXT;
             result->Body(Core::proxy_cast<Web::IBody>(response));
         } else if (index.Current() == _T("SubSystems")) {
             PluginHost::ISubSystem* subSystem = _service->SubSystems();
@@ -270,6 +331,132 @@ namespace Plugin {
 
         return (result);
     }
+    void Controller::Exposition(string& text) const
+    {
+        const Core::WorkerPool::Metadata& snapshot = Core::WorkerPool::Instance().Snapshot();
+        Core::ProcessInfo host;
+
+        text.clear();
+        text.reserve(16 * 1024);
+
+        Family(text, _T("thunder_workerpool_pending"), _T("gauge"), _T("Jobs waiting for a thread of the worker pool."));
+        Append(text, _T("thunder_workerpool_pending %u\n"), snapshot.Pending);
+        Family(text, _T("thunder_workerpool_occupation"), _T("gauge"), _T("Threads of the worker pool running a job."));
+        Append(text, _T("thunder_workerpool_occupation %u\n"), snapshot.Occupation);
+        Family(text, _T("thunder_workerpool_runs_total"), _T("counter"), _T("Jobs run per thread of the worker pool."));
+        for (uint8_t slot = 0; slot < snapshot.Slots; slot++) {
+            Append(text, _T("thunder_workerpool_runs_total{slot=\"%u\"} %u\n"), slot, snapshot.Slot[slot]);
+        }
+
+        Family(text, _T("thunder_resourcemonitor_descriptors"), _T("gauge"), _T("File descriptors watched by the resource monitor."));
+        Append(text, _T("thunder_resourcemonitor_descriptors %u\n"), Core::ResourceMonitor::Instance().Count());
+
+        Family(text, _T("thunder_process_resident_bytes"), _T("gauge"), _T("Resident memory of the host process."));
+        Append(text, _T("thunder_process_resident_bytes %" PRIu64 "\n"), host.Resident());
+        Family(text, _T("thunder_process_allocated_bytes"), _T("gauge"), _T("Allocated memory of the host process."));
+        Append(text, _T("thunder_process_allocated_bytes %" PRIu64 "\n"), host.Allocated());
+        Family(text, _T("thunder_process_shared_bytes"), _T("gauge"), _T("Shared memory of the host process."));
+        Append(text, _T("thunder_process_shared_bytes %" PRIu64 "\n"), host.Shared());
+
+        Family(text, _T("thunder_channel_queue_depth"), _T("gauge"), _T("Messages waiting to be sent out per channel."));
+        _pluginServer->Dispatcher().Visit([&text](const PluginHost::Server::Channel& channel) {
+            text += _T("thunder_channel_queue_depth{");
+            Label(text, _T("id"), Core::NumberType<uint32_t>(channel.Id()).Text());
+            Label(text, _T("remote"), channel.RemoteId());
+            Label(text, _T("name"), channel.Name());
+            Label(text, _T("type"), (channel.IsWebSocket() ? ((channel.State() != PluginHost::Channel::RAW) ? _T("rawsocket") : _T("websocket")) : (channel.IsWebServer() ? _T("webserver") : _T("suspended"))));
+            Append(text, _T("} %u\n"), channel.Queued());
+        });
+        Family(text, _T("thunder_channel_queue_bytes"), _T("gauge"), _T("Bytes waiting to be sent out per channel."));
+        _pluginServer->Dispatcher().Visit([&text](const PluginHost::Server::Channel& channel) {
+            Append(text, _T("thunder_channel_queue_bytes{id=\"%u\"} %u\n"), channel.Id(), channel.QueuedBytes());
+        });
+        Family(text, _T("thunder_channel_dropped_total"), _T("counter"), _T("Messages dropped per channel, as its send queue was full."));
+        _pluginServer->Dispatcher().Visit([&text](const PluginHost::Server::Channel& channel) {
+            Append(text, _T("thunder_channel_dropped_total{id=\"%u\"} %u\n"), channel.Id(), channel.Dropped());
+        });
+        Family(text, _T("thunder_channel_coalesced_total"), _T("counter"), _T("Notifications replaced by a newer one of the same event per channel, as its send queue was full."));
+        _pluginServer->Dispatcher().Visit([&text](const PluginHost::Server::Channel& channel) {
+            Append(text, _T("thunder_channel_coalesced_total{id=\"%u\"} %u\n"), channel.Id(), channel.Coalesced());
+        });
+
+        Family(text, _T("thunder_plugin_state"), _T("gauge"), _T("Current state of a plugin."));
+        _pluginServer->Services().Visit([&text](const PluginHost::Server::Service& service) {
+            text += _T("thunder_plugin_state{");
+            Label(text, _T("callsign"), service.Callsign());
+            Label(text, _T("state"), Core::EnumerateType<PluginHost::IShell::state>(service.State()).Data());
+            text += _T("} 1\n");
+        });
+#ifdef RUNTIME_STATISTICS
+        Family(text, _T("thunder_plugin_requests_total"), _T("counter"), _T("Web requests handled per plugin."));
+        _pluginServer->Services().Visit([&text](const PluginHost::Server::Service& service) {
+            text += _T("thunder_plugin_requests_total{");
+            Label(text, _T("callsign"), service.Callsign());
+            Append(text, _T("} %u\n"), service.ProcessedRequests());
+        });
+        Family(text, _T("thunder_plugin_objects_total"), _T("counter"), _T("Websocket messages handled per plugin."));
+        _pluginServer->Services().Visit([&text](const PluginHost::Server::Service& service) {
+            text += _T("thunder_plugin_objects_total{");
+            Label(text, _T("callsign"), service.Callsign());
+            Append(text, _T("} %u\n"), service.ProcessedObjects());
+        });
+#endif
+        Family(text, _T("thunder_plugin_resident_bytes"), _T("gauge"), _T("Resident memory of the process hosting an out-of-process plugin."));
+        _pluginServer->Services().Visit([this, &text](const PluginHost::Server::Service& service) {
+            const uint32_t pid = ((service.State() == PluginHost::IShell::ACTIVATED) ? _pluginServer->Services().RemoteProcess(service.Callsign()) : 0);
+
+            if (pid != 0) {
+                text += _T("thunder_plugin_resident_bytes{");
+                Label(text, _T("callsign"), service.Callsign());
+                Append(text, _T(",pid=\"%u\"} %" PRIu64 "\n"), pid, Core::ProcessInfo(pid).Resident());
+            }
+        });
+
+        const Core::Metrics& metrics(Core::Metrics::Instance());
+
+        Family(text, _T("thunder_method_calls_total"), _T("counter"), _T("Calls handled per JSON-RPC or COM-RPC method."));
+        metrics.Visit([&text](const Core::Metrics::Entry& entry) {
+            text += _T("thunder_method_calls_total{");
+            Label(text, _T("method"), entry.Designator());
+            Append(text, _T("} %" PRIu64 "\n"), entry.Latency().Count());
+        });
+        Family(text, _T("thunder_method_errors_total"), _T("counter"), _T("Failed calls per JSON-RPC or COM-RPC method."));
+        metrics.Visit([&text](const Core::Metrics::Entry& entry) {
+            text += _T("thunder_method_errors_total{");
+            Label(text, _T("method"), entry.Designator());
+            Append(text, _T("} %" PRIu64 "\n"), entry.Errors());
+        });
+        Family(text, _T("thunder_method_received_bytes_total"), _T("counter"), _T("Bytes of the parameters per JSON-RPC or COM-RPC method."));
+        metrics.Visit([&text](const Core::Metrics::Entry& entry) {
+            text += _T("thunder_method_received_bytes_total{");
+            Label(text, _T("method"), entry.Designator());
+            Append(text, _T("} %" PRIu64 "\n"), entry.BytesIn());
+        });
+        Family(text, _T("thunder_method_sent_bytes_total"), _T("counter"), _T("Bytes of the responses per JSON-RPC or COM-RPC method."));
+        metrics.Visit([&text](const Core::Metrics::Entry& entry) {
+            text += _T("thunder_method_sent_bytes_total{");
+            Label(text, _T("method"), entry.Designator());
+            Append(text, _T("} %" PRIu64 "\n"), entry.BytesOut());
+        });
+        Family(text, _T("thunder_method_latency_seconds"), _T("summary"), _T("Handling time per JSON-RPC or COM-RPC method."));
+        metrics.Visit([&text](const Core::Metrics::Entry& entry) {
+            static const uint8_t quantiles[] = { 50, 90, 99 };
+            const Core::Histogram& latency(entry.Latency());
+
+            for (const uint8_t quantile : quantiles) {
+                text += _T("thunder_method_latency_seconds{");
+                Label(text, _T("method"), entry.Designator());
+                Append(text, _T(",quantile=\"%g\"} %.9g\n"), static_cast<double>(quantile) / 100.0, static_cast<double>(latency.Percentile(quantile)) / 1000000000.0);
+            }
+            text += _T("thunder_method_latency_seconds_sum{");
+            Label(text, _T("method"), entry.Designator());
+            Append(text, _T("} %.9g\n"), static_cast<double>(latency.Sum()) / 1000000000.0);
+            text += _T("thunder_method_latency_seconds_count{");
+            Label(text, _T("method"), entry.Designator());
+            Append(text, _T("} %" PRIu64 "\n"), latency.Count());
+        });
+    }
+
     Core::ProxyType<Web::Response> Controller::PutMethod(Core::TextSegmentIterator& index, const Web::Request& request)
     {
         Core::ProxyType<Web::Response> result(PluginHost::IFactories::Instance().Response());
@@ -106,6 +106,8 @@ namespace Plugin {
         };
 
         // GET -> URL /<MetaDataCallsign>/Plugin/<Callsign>
+        // GET -> URL /<MetaDataCallsign>/Timeline
+        // GET -> URL /<MetaDataCallsign>/Metrics
         // PUT -> URL /<MetaDataCallsign>/Configure
         // PUT -> URL /<MetaDataCallsign>/Activate/<Callsign>
         // PUT -> URL /<MetaDataCallsign>/Deactivate/<Callsign>
@@ -268,6 +270,7 @@ namespace Plugin {
         void SubSystems();
         void SubSystems(Core::JSON::ArrayType<Core::JSON::EnumType<PluginHost::ISubSystem::subsystem>>::ConstIterator& index);
         Core::ProxyType<Web::Response> GetMethod(Core::TextSegmentIterator& index) const;
+        void Exposition(string& text) const;
         Core::ProxyType<Web::Response> PutMethod(Core::TextSegmentIterator& index, const Web::Request& request);
         Core::ProxyType<Web::Response> DeleteMethod(Core::TextSegmentIterator& index, const Web::Request& request);
         void StateChange(PluginHost::IShell* plugin);
@@ -281,9 +284,12 @@ namespace Plugin {
         uint32_t endpoint_storeconfig();
         uint32_t endpoint_delete(const JsonData::Controller::DeleteParamsData& params);
         uint32_t endpoint_harakiri();
+        uint32_t endpoint_resetmetrics();
         uint32_t get_status(const string& index, Core::JSON::ArrayType<PluginHost::MetaData::Service>& response) const;
         uint32_t get_links(Core::JSON::ArrayType<PluginHost::MetaData::Channel>& response) const;
         uint32_t get_processinfo(PluginHost::MetaData::Server& response) const;
+        uint32_t get_timeline(Core::JSON::ArrayType<PluginHost::MetaData::Timeline>& response) const;
+        uint32_t get_metrics(Core::JSON::ArrayType<PluginHost::MetaData::Metric>& response) const;
         uint32_t get_subsystems(Core::JSON::ArrayType<JsonData::Controller::SubsystemsParamsData>& response) const;
         uint32_t get_discoveryresults(Core::JSON::ArrayType<PluginHost::MetaData::Bridge>& response) const;
         uint32_t get_environment(const string& index, Core::JSON::String& response) const;
@@ -39,9 +39,12 @@ namespace Plugin {
         Register<void,void>(_T("storeconfig"), &Controller::endpoint_storeconfig, this);
         Register<DeleteParamsData,void>(_T("delete"), &Controller::endpoint_delete, this);
         Register<void,void>(_T("harakiri"), &Controller::endpoint_harakiri, this);
+        Register<void,void>(_T("resetmetrics"), &Controller::endpoint_resetmetrics, this);
         Property<Core::JSON::ArrayType<PluginHost::MetaData::Service>>(_T("status"), &Controller::get_status, nullptr, this);
         Property<Core::JSON::ArrayType<PluginHost::MetaData::Channel>>(_T("links"), &Controller::get_links, nullptr, this);
         Property<PluginHost::MetaData::Server>(_T("processinfo"), &Controller::get_processinfo, nullptr, this);
+        Property<Core::JSON::ArrayType<PluginHost::MetaData::Timeline>>(_T("timeline"), &Controller::get_timeline, nullptr, this);
+        Property<Core::JSON::ArrayType<PluginHost::MetaData::Metric>>(_T("metrics"), &Controller::get_metrics, nullptr, this);
         Property<Core::JSON::ArrayType<SubsystemsParamsData>>(_T("subsystems"), &Controller::get_subsystems, nullptr, this);
         Property<Core::JSON::ArrayType<PluginHost::MetaData::Bridge>>(_T("discoveryresults"), &Controller::get_discoveryresults, nullptr, this);
         Property<Core::JSON::String>(_T("environment"), &Controller::get_environment, nullptr, this);
@@ -50,6 +53,7 @@ namespace Plugin {
 
     void Controller::UnregisterAll()
     {
+        Unregister(_T("resetmetrics"));
         Unregister(_T("harakiri"));
         Unregister(_T("delete"));
         Unregister(_T("storeconfig"));
@@ -60,6 +64,8 @@ namespace Plugin {
         Unregister(_T("environment"));
         Unregister(_T("discoveryresults"));
         Unregister(_T("subsystems"));
+        Unregister(_T("metrics"));
+        Unregister(_T("timeline"));
         Unregister(_T("processinfo"));
         Unregister(_T("links"));
         Unregister(_T("status"));
@@ -218,6 +224,16 @@ namespace Plugin {
         return result;
     }
 
+    // Method: resetmetrics - Clears the latency and counters of the JSON-RPC and COM-RPC methods
+    // Return codes:
+    //  - ERROR_NONE: Success
+    uint32_t Controller::endpoint_resetmetrics()
+    {
+        Core::Metrics::Instance().Reset();
+
+        return Core::ERROR_NONE;
+    }
+
     // Property: status - Information about plugins, including their configurations
     // Return codes:
     //  - ERROR_NONE: Success
@@ -271,6 +287,32 @@ namespace Plugin {
         return Core::ERROR_NONE;
     }
 
+    // Property: timeline - Activation times of the plugins started at startup
+    // Return codes:
+    //  - ERROR_NONE: Success
+    uint32_t Controller::get_timeline(Core::JSON::ArrayType<PluginHost::MetaData::Timeline>& response) const
+    {
+        ASSERT(_pluginServer != nullptr);
+
+        _pluginServer->Startup().GetMetaData(response);
+
+        return Core::ERROR_NONE;
+    }
+
+    // Property: metrics - Latency and counters of the JSON-RPC and COM-RPC methods
+    // Return codes:
+    //  - ERROR_NONE: Success
+    uint32_t Controller::get_metrics(Core::JSON::ArrayType<PluginHost::MetaData::Metric>& response) const
+    {
+        Core::Metrics::Instance().Visit([&response](const Core::Metrics::Entry& entry) {
+            if (entry.Latency().Count() != 0) {
+                response.Add(PluginHost::MetaData::Metric(entry));
+            }
+        });
+
+        return Core::ERROR_NONE;
+    }
+
     // Property: subsystems - Status of subsystems
     // Return codes:
     //  - ERROR_NONE: Success
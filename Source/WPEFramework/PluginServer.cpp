@@ -53,6 +53,7 @@ ENUM_CONVERSION_BEGIN(Core::ProcessInfo::scheduler)
     /* static */ Core::ProxyType<Web::Response> Server::Channel::_incorrectVersion(Core::ProxyType<Web::Response>::Create());
     /* static */ Core::ProxyType<Web::Response> Server::Channel::WebRequestJob::_missingResponse(Core::ProxyType<Web::Response>::Create());
     /* static */ Core::ProxyType<Web::Response> Server::Channel::_unauthorizedRequest(Core::ProxyType<Web::Response>::Create());
+    /* static */ Core::ProxyType<Web::Response> Server::Channel::_congested(Core::ProxyType<Web::Response>::Create());
     /* static */ Core::ProxyType<Web::Response> Server::Service::_missingHandler(Core::ProxyType<Web::Response>::Create());
     /* static */ Core::ProxyType<Web::Response> Server::Service::_unavailableHandler(Core::ProxyType<Web::Response>::Create());
 
@@ -275,6 +276,9 @@ ENUM_CONVERSION_BEGIN(Core::ProcessInfo::scheduler)
             service.Release();
         }
 
+        // The routing table holds on to the services as well, drop it before the libraries go.
+        Publish();
+
         Core::ServiceAdministrator::Instance().FlushLibraries();
 
         _adminLock.Unlock();
@@ -346,7 +350,11 @@ ENUM_CONVERSION_BEGIN(Core::ProcessInfo::scheduler)
 
             // Load the interfaces, If we did not load them yet...
             if (_handler == nullptr) {
+                const uint64_t loadStart = Core::Time::Now().Ticks();
+
                 AquireInterfaces();
+
+                _loadTime = Core::Time::Now().Ticks() - loadStart;
             }
 
             const string callSign(PluginHost::Service::Configuration().Callsign.Value());
@@ -363,6 +371,10 @@ ENUM_CONVERSION_BEGIN(Core::ProcessInfo::scheduler)
                 _reason = why;
                 State(PRECONDITION);
 
+                if (_pending == 0) {
+                    _pending = Core::Time::Now().Ticks();
+                }
+
                 if (Trace::TraceType<Activity, &Core::System::MODULE_NAME>::IsEnabled() == true) {
                     string feedback;
                     uint8_t index = 1;
@@ -388,6 +400,11 @@ ENUM_CONVERSION_BEGIN(Core::ProcessInfo::scheduler)
                 }
             } else {
 
+                const uint64_t initializeStart = Core::Time::Now().Ticks();
+
+                _preconditionTime = (_pending != 0 ? initializeStart - _pending : 0);
+                _pending = 0;
+
                 State(ACTIVATION);
                 _administrator.StateChange(this);
 
@@ -398,6 +415,8 @@ ENUM_CONVERSION_BEGIN(Core::ProcessInfo::scheduler)
                 // Fire up the interface. Let it handle the messages.
                 ErrorMessage(_handler->Initialize(this));
 
+                _initializeTime = Core::Time::Now().Ticks() - initializeStart;
+
                 if (HasError() == true) {
                     result = Core::ERROR_GENERAL;
 
@@ -559,9 +578,9 @@ ENUM_CONVERSION_BEGIN(Core::ProcessInfo::scheduler)
                 size_t length;
                 uint32_t offset = static_cast<uint32_t>(serviceHeader.length()) + 1; /* skip the slash after */
 
-                const string callSign(identifier.substr(offset, ((length = identifier.find_first_of('/', offset)) == string::npos ? string::npos : length - offset)));
+                length = identifier.find_first_of('/', offset);
 
-                result = FromIdentifier(callSign, service);
+                result = FromIdentifier(&(identifier[offset]), static_cast<uint32_t>((length == string::npos ? identifier.length() : length) - offset), service);
             }
         } else if (identifier.compare(0, JSONRPCHeader.length(), JSONRPCHeader.c_str()) == 0) {
 
@@ -574,9 +593,9 @@ ENUM_CONVERSION_BEGIN(Core::ProcessInfo::scheduler)
                 size_t length;
                 uint32_t offset = static_cast<uint32_t>(JSONRPCHeader.length()) + 1; /* skip the slash after */
 
-                const string callSign(identifier.substr(offset, ((length = identifier.find_first_of('/', offset)) == string::npos ? string::npos : length - offset)));
+                length = identifier.find_first_of('/', offset);
 
-                result = FromIdentifier(callSign, service);
+                result = FromIdentifier(&(identifier[offset]), static_cast<uint32_t>((length == string::npos ? identifier.length() : length) - offset), service);
             }
         }
 
@@ -645,6 +664,7 @@ ENUM_CONVERSION_BEGIN(Core::ProcessInfo::scheduler)
               Core::NodeId(configuration.Communicator.Value().c_str()),
               configuration.Redirect.Value())
         , _services(*this, _config, configuration.Process.IsSet() ? configuration.Process.StackSize.Value() : 0)
+        , _startup(*this, configuration.ParallelStartup.Value())
         , _controller()
         , _factoriesImplementation()
     {
@@ -664,6 +684,14 @@ ENUM_CONVERSION_BEGIN(Core::ProcessInfo::scheduler)
         // Lets assign a workerpool, we created it...
         Core::WorkerPool::Assign(&_dispatcher);
 
+        PluginHost::Channel::SendQueue(configuration.SendQueue.Messages.Value(), configuration.SendQueue.Bytes.Value(), configuration.SendQueue.Overflow.Value());
+        PluginHost::Channel::KeepAlive(configuration.KeepAlive.Requests.Value(), configuration.KeepAlive.Pipeline.Value());
+
+        // The zygotes should see the environment as set above, and refill through the workerpool.
+        if (configuration.Zygotes.Value() != 0) {
+            _services.Zygotes(configuration.Zygotes.Value());
+        }
+
         Core::JSON::ArrayType<Plugin::Config>::Iterator index = configuration.Plugins.Elements();
 
         // First register all services, than if we got them, start "activating what is required.
@@ -756,6 +784,262 @@ ENUM_CONVERSION_BEGIN(Core::ProcessInfo::scheduler)
         }
     }
 
+    void Server::StartupScheduler::Open()
+    {
+        ServiceMap::Iterator iterator(_server.Services().Services());
+
+        _adminLock.Lock();
+
+        _start = Core::Time::Now().Ticks();
+
+        while (iterator.Next() == true) {
+
+            Core::ProxyType<Service> service(*iterator);
+
+            if (service->State() == PluginHost::IShell::ACTIVATED) {
+                // The Controller, it is already up and running.
+            } else if (service->AutoStart() == true) {
+                _entries.emplace(std::piecewise_construct,
+                    std::forward_as_tuple(service->Callsign()),
+                    std::forward_as_tuple(service));
+            } else {
+                SYSLOG(Logging::Startup, (_T("Activation of plugin [%s]:[%s] blocked"), service->ClassName().c_str(), service->Callsign().c_str()));
+            }
+        }
+
+        // Connect the plugins to the plugins they depend on.
+        for (std::pair<const string, Entry>& entry : _entries) {
+            Core::JSON::ArrayType<Core::JSON::String>::ConstIterator index(entry.second.Shell->PluginHost::Service::Configuration().Dependencies.Elements());
+
+            while (index.Next() == true) {
+                const string& dependency(index.Current().Value());
+                std::map<string, Entry>::iterator other(_entries.find(dependency));
+
+                if (other != _entries.end()) {
+                    if (other != _entries.find(entry.first)) {
+                        other->second.Dependents.push_back(entry.first);
+                        entry.second.Pending++;
+                    }
+                } else if (dependency != _server.ControllerName()) {
+                    SYSLOG(Logging::Startup, (_T("Plugin [%s] depends on [%s], which is not started automatically, dependency ignored"), entry.first.c_str(), dependency.c_str()));
+                }
+            }
+        }
+
+        // Plugins that (indirectly) depend on themselves would never be activated, do not let them wait.
+        std::map<string, uint16_t> pending;
+        std::list<string> order;
+
+        for (const std::pair<const string, Entry>& entry : _entries) {
+            pending[entry.first] = entry.second.Pending;
+
+            if (entry.second.Pending == 0) {
+                order.push_back(entry.first);
+            }
+        }
+        while (order.empty() == false) {
+            for (const string& dependent : _entries.find(order.front())->second.Dependents) {
+                if (--pending[dependent] == 0) {
+                    order.push_back(dependent);
+                }
+            }
+            order.pop_front();
+        }
+        for (std::pair<const string, Entry>& entry : _entries) {
+            if (pending[entry.first] != 0) {
+                SYSLOG(Logging::Startup, (_T("Plugin [%s] is part of, or depends on, a circular dependency, it is activated without waiting"), entry.first.c_str()));
+                entry.second.Pending = 0;
+            }
+        }
+
+        _remaining = static_cast<uint32_t>(_entries.size());
+
+        for (std::pair<const string, Entry>& entry : _entries) {
+            if (entry.second.Pending == 0) {
+                Ready(entry.first, entry.second);
+            }
+        }
+
+        _adminLock.Unlock();
+
+        // From here on we want to know when a plugin gets activated, its dependents might be waiting for it.
+        _server.Services().Register(&_sink);
+
+        if (_parallel == 0) {
+            // Activate them one by one, on this thread, in the order of their dependencies.
+            _adminLock.Lock();
+
+            while ((_ready.empty() == false) && (_closed == false)) {
+                const string callsign(_ready.front());
+                _ready.pop_front();
+                _running++;
+
+                _adminLock.Unlock();
+
+                Activate(callsign);
+
+                _adminLock.Lock();
+            }
+
+            // Whatever gets released from now on (plugins waiting for preconditions), goes through the WorkerPool.
+            _slots = 1;
+            Schedule();
+
+            _adminLock.Unlock();
+        } else {
+            _adminLock.Lock();
+
+            _slots = _parallel;
+            Schedule();
+
+            _adminLock.Unlock();
+        }
+    }
+
+    void Server::StartupScheduler::Close()
+    {
+        _adminLock.Lock();
+        _closed = true;
+        _ready.clear();
+        _adminLock.Unlock();
+
+        // Jobs that are still queued, will see that we are closed and skip the activation.
+        _idle.Lock(Core::infinite);
+
+        _server.Services().Unregister(&_sink);
+
+        _adminLock.Lock();
+        _entries.clear();
+        _adminLock.Unlock();
+    }
+
+    void Server::StartupScheduler::GetMetaData(Core::JSON::ArrayType<MetaData::Timeline>& metaData) const
+    {
+        std::list<std::pair<Core::ProxyType<Service>, std::pair<uint64_t, uint64_t>>> entries;
+
+        _adminLock.Lock();
+
+        for (const std::pair<const string, Entry>& entry : _entries) {
+            entries.emplace_back(entry.second.Shell, std::make_pair(entry.second.Scheduled, entry.second.Started));
+        }
+
+        _adminLock.Unlock();
+
+        // Collect what the services know outside our lock, they call us with their own lock taken.
+        for (const std::pair<Core::ProxyType<Service>, std::pair<uint64_t, uint64_t>>& entry : entries) {
+            MetaData::Timeline timeline;
+
+            entry.first->GetTimeline(timeline);
+            timeline.Scheduled = entry.second.first;
+            timeline.Started = entry.second.second;
+
+            metaData.Add(timeline);
+        }
+    }
+
+    void Server::StartupScheduler::Activate(const string& callsign)
+    {
+        Core::ProxyType<Service> service;
+
+        _adminLock.Lock();
+
+        std::map<string, Entry>::iterator index(_entries.find(callsign));
+
+        if ((_closed == false) && (index != _entries.end())) {
+            index->second.Started = Elapsed();
+            service = index->second.Shell;
+        }
+
+        _adminLock.Unlock();
+
+        if (service.IsValid() == true) {
+            uint32_t result = service->Activate(PluginHost::IShell::STARTUP);
+
+            _adminLock.Lock();
+
+            // An activated plugin released its dependents while it changed state. If it is waiting for its
+            // preconditions, or someone else is activating it, its dependents wait until it is activated.
+            if ((result != Core::ERROR_NONE) && (result != Core::ERROR_PENDING_CONDITIONS) && (result != Core::ERROR_INPROGRESS)) {
+                index = _entries.find(callsign);
+
+                if (index != _entries.end()) {
+                    Release(index->second);
+                }
+            }
+
+            _adminLock.Unlock();
+        }
+
+        _adminLock.Lock();
+
+        ASSERT(_running > 0);
+        _running--;
+
+        Schedule();
+
+        if ((_running == 0) && ((_closed == true) || (_ready.empty() == true))) {
+            _idle.SetEvent();
+        }
+
+        _adminLock.Unlock();
+    }
+
+    void Server::StartupScheduler::Activated(const string& callsign)
+    {
+        _adminLock.Lock();
+
+        std::map<string, Entry>::iterator index(_entries.find(callsign));
+
+        if (index != _entries.end()) {
+            Release(index->second);
+            Schedule();
+        }
+
+        _adminLock.Unlock();
+    }
+
+    void Server::StartupScheduler::Release(Entry& entry)
+    {
+        if (entry.Released == false) {
+            entry.Released = true;
+
+            for (const string& dependent : entry.Dependents) {
+                std::map<string, Entry>::iterator index(_entries.find(dependent));
+
+                ASSERT(index != _entries.end());
+
+                if ((index->second.Pending > 0) && (--(index->second.Pending) == 0)) {
+                    Ready(index->first, index->second);
+                }
+            }
+
+            ASSERT(_remaining > 0);
+
+            if (--_remaining == 0) {
+                SYSLOG(Logging::Startup, (_T("Startup of %d plugins completed in %d ms"), static_cast<uint32_t>(_entries.size()), static_cast<uint32_t>(Elapsed() / 1000)));
+            }
+        }
+    }
+
+    void Server::StartupScheduler::Ready(const string& callsign, Entry& entry)
+    {
+        entry.Scheduled = Elapsed();
+        _ready.push_back(callsign);
+    }
+
+    void Server::StartupScheduler::Schedule()
+    {
+        while ((_closed == false) && (_ready.empty() == false) && (_running < _slots)) {
+            Core::ProxyType<Job> job(Core::ProxyType<Job>::Create(this, _ready.front()));
+
+            _ready.pop_front();
+            _running++;
+            _idle.ResetEvent();
+
+            _server.Submit(Core::proxy_cast<Core::IDispatchType<void>>(job));
+        }
+    }
+
     void Server::Open()
     {
         // Before we do anything with the subsystems (notifications)
@@ -786,24 +1070,14 @@ ENUM_CONVERSION_BEGIN(Core::ProcessInfo::scheduler)
         Dispatcher().Open(MAX_EXTERNAL_WAITS);
 
         // Right we have the shells for all possible services registered, time to activate what is needed :-)
-        ServiceMap::Iterator iterator(_services.Services());
-
-        while (iterator.Next() == true) {
-
-            Core::ProxyType<Service> service(*iterator);
-
-            if (service->AutoStart() == true) {
-                service->Activate(PluginHost::IShell::STARTUP);
-            } else {
-                SYSLOG(Logging::Startup, (_T("Activation of plugin [%s]:[%s] blocked"), service->ClassName().c_str(), service->Callsign().c_str()));
-            }
-        }
+        _startup.Open();
     }
 
     void Server::Close()
     {
         Plugin::Controller* destructor(_controller->ClassType<Plugin::Controller>());
         _connections.Close(Core::infinite);
+        _startup.Close();
         destructor->Stopped();
         _services.Destroy();
         _dispatcher.Stop();
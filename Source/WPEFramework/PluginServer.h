@@ -211,6 +211,52 @@ namespace PluginHost {
                 Core::JSON::Boolean OutputEnabled;
             };
 
+            // The limits of the queue of messages to be sent out per websocket, 0 is unlimited.
+            class SendQueueConfig : public Core::JSON::Container {
+            public:
+                SendQueueConfig(const SendQueueConfig&) = delete;
+                SendQueueConfig& operator=(const SendQueueConfig&) = delete;
+
+                SendQueueConfig()
+                    : Messages(0)
+                    , Bytes(0)
+                    , Overflow(PluginHost::Channel::DROP_OLDEST)
+                {
+                    Add(_T("messages"), &Messages);
+                    Add(_T("bytes"), &Bytes);
+                    Add(_T("overflow"), &Overflow);
+                }
+                ~SendQueueConfig()
+                {
+                }
+
+                Core::JSON::DecUInt32 Messages;
+                Core::JSON::DecUInt32 Bytes;
+                Core::JSON::EnumType<PluginHost::Channel::overflow> Overflow;
+            };
+
+            class KeepAliveConfig : public Core::JSON::Container {
+            public:
+                KeepAliveConfig(const KeepAliveConfig&) = delete;
+                KeepAliveConfig& operator=(const KeepAliveConfig&) = delete;
+
+                KeepAliveConfig()
+                    : Requests(0)
+                    , Pipeline(0)
+                {
+                    Add(_T("requests"), &Requests);
+                    Add(_T("pipeline"), &Pipeline);
+                }
+                ~KeepAliveConfig()
+                {
+                }
+
+                // Requests served over one HTTP connection before it is closed.
+                Core::JSON::DecUInt32 Requests;
+                // Pipelined requests on one connection that may wait for a response.
+                Core::JSON::DecUInt16 Pipeline;
+            };
+
 #ifdef PROCESSCONTAINERS_ENABLED
 
             class ProcessContainerConfig : public Core::JSON::Container {
@@ -267,6 +313,10 @@ namespace PluginHost {
                 , Signature(_T("TestSecretKey"))
                 , IdleTime(0)
                 , IPV6(false)
+                , ParallelStartup(THREADPOOL_COUNT > 1 ? THREADPOOL_COUNT - 1 : 0)
+                , Zygotes(0)
+                , SendQueue()
+                , KeepAlive()
                 , DefaultTraceCategories(false)
                 , Process()
                 , Input()
@@ -292,6 +342,10 @@ namespace PluginHost {
                 Add(_T("signature"), &Signature);
                 Add(_T("idletime"), &IdleTime);
                 Add(_T("ipv6"), &IPV6);
+                Add(_T("parallelstartup"), &ParallelStartup);
+                Add(_T("zygotes"), &Zygotes);
+                Add(_T("sendqueue"), &SendQueue);
+                Add(_T("keepalive"), &KeepAlive);
                 Add(_T("tracing"), &DefaultTraceCategories);
                 Add(_T("redirect"), &Redirect);
                 Add(_T("process"), &Process);
@@ -325,6 +379,12 @@ namespace PluginHost {
             Core::JSON::String Signature;
             Core::JSON::DecUInt16 IdleTime;
             Core::JSON::Boolean IPV6;
+            // Number of plugins that can be activated at the same time at startup, 0 activates them one by one.
+            Core::JSON::DecUInt8 ParallelStartup;
+            // Number of out-of-process hosts started ahead of time, 0 starts them when a plugin is activated.
+            Core::JSON::DecUInt8 Zygotes;
+            SendQueueConfig SendQueue;
+            KeepAliveConfig KeepAlive;
             Core::JSON::String DefaultTraceCategories;
             ProcessSet Process;
             InputConfig Input;
@@ -653,6 +713,10 @@ namespace PluginHost {
                 , _precondition(plugin->Precondition, true)
                 , _termination(plugin->Termination, false)
                 , _activity(0)
+                , _pending(0)
+                , _preconditionTime(0)
+                , _loadTime(0)
+                , _initializeTime(0)
                 , _administrator(*administrator)
             {
                 ASSERT(server != nullptr);
@@ -982,6 +1046,19 @@ namespace PluginHost {
 
                 PluginHost::Service::GetMetaData(metaData);
             }
+            // The time it took to get the plugin activated, the last time it was activated.
+            inline void GetTimeline(MetaData::Timeline& timeline) const
+            {
+                Lock();
+
+                timeline.Callsign = PluginHost::Service::Callsign();
+                timeline.JSONState = this;
+                timeline.Precondition = _preconditionTime;
+                timeline.Load = _loadTime;
+                timeline.Initialize = _initializeTime;
+
+                Unlock();
+            }
             inline void Evaluate()
             {
                 Lock();
@@ -1184,6 +1261,13 @@ namespace PluginHost {
             Condition _termination;
             uint32_t _activity;
 
+            // Timing of the last activation, the waiting time for the preconditions and the time it took
+            // to load the library and to initialize the plugin (in us).
+            uint64_t _pending;
+            uint64_t _preconditionTime;
+            uint64_t _loadTime;
+            uint64_t _initializeTime;
+
             ServiceMap& _administrator;
             static Core::ProxyType<Web::Response> _unavailableHandler;
             static Core::ProxyType<Web::Response> _missingHandler;
@@ -1348,6 +1432,10 @@ namespace PluginHost {
                 {
                     return (_application);
                 }
+                void Zygotes(const uint8_t size)
+                {
+                    RPC::Communicator::Zygotes(_application, _proxyStubPath, size);
+                }
 
             private:
                 RPC::Communicator::RemoteConnection* CreateStarter(const RPC::Config& config, const RPC::Object& instance) override
@@ -1708,6 +1796,130 @@ namespace PluginHost {
                 Core::ProxyType<Job> _decoupling;
             };
 
+            // Rationale:
+            // Every HTTP request and WebSocket upgrade looks up its service by callsign, while plugins are
+            // added, removed and change state. The Routing is a copy of what the lookup needs (callsign to
+            // service, and the security officer), built whenever one of these changes and never changed
+            // after that. Lookups take no lock: they announce themselves on one of two reader counters
+            // (picked by the epoch), use whatever table is current and leave again. The one replacing the
+            // table swaps in the new one, moves the epoch twice and waits till the counter of the previous
+            // epoch drops to zero each time, only then the old table is deleted. New readers always count
+            // on the other counter, so a steady stream of requests can not keep the swap waiting.
+            class Routing {
+            private:
+                struct Entry {
+                    string Callsign;
+                    Core::ProxyType<Service> Instance;
+                };
+
+            public:
+                Routing() = delete;
+                Routing(const Routing&) = delete;
+                Routing& operator=(const Routing&) = delete;
+
+                Routing(const std::map<const string, Core::ProxyType<Service>>& services, IAuthenticate* officer)
+                    : _entries()
+                    , _slots()
+                    , _mask(0)
+                    , _officer(officer)
+                {
+                    uint32_t size = 8;
+
+                    while (size < (2 * services.size())) {
+                        size <<= 1;
+                    }
+
+                    _mask = size - 1;
+                    _slots.assign(size, 0);
+                    _entries.reserve(services.size());
+
+                    for (const std::pair<const string, Core::ProxyType<Service>>& entry : services) {
+                        uint32_t slot = Hash(entry.first.c_str(), static_cast<uint32_t>(entry.first.length())) & _mask;
+
+                        while (_slots[slot] != 0) {
+                            slot = (slot + 1) & _mask;
+                        }
+
+                        _entries.push_back({ entry.first, entry.second });
+                        _slots[slot] = static_cast<uint32_t>(_entries.size());
+                    }
+                }
+                ~Routing()
+                {
+                }
+
+            public:
+                IAuthenticate* Officer() const
+                {
+                    return (_officer);
+                }
+                // The callsign as in the path, e.g. "Controller" or "Controller.1", the part after the last
+                // dot being the version asked for.
+                uint32_t Find(const TCHAR callsign[], const uint32_t length, Core::ProxyType<Service>& service) const
+                {
+                    uint32_t result = Core::ERROR_UNAVAILABLE;
+                    const Entry* entry = Lookup(callsign, length);
+
+                    if (entry != nullptr) {
+                        // Service found, did not requested specific version
+                        service = entry->Instance;
+                        result = Core::ERROR_NONE;
+                    } else {
+                        uint32_t dot = length;
+
+                        while ((dot > 0) && (callsign[dot - 1] != '.')) {
+                            dot--;
+                        }
+
+                        if ((dot > 1) && ((entry = Lookup(callsign, dot - 1)) != nullptr)) {
+                            // Requested specific version of a plugin
+                            if (entry->Instance->HasVersionSupport(string(&(callsign[dot]), length - dot)) == true) {
+                                service = entry->Instance;
+                                result = Core::ERROR_NONE;
+                            } else {
+                                result = Core::ERROR_INVALID_SIGNATURE;
+                            }
+                        }
+                    }
+
+                    return (result);
+                }
+
+            private:
+                static uint32_t Hash(const TCHAR text[], const uint32_t length)
+                {
+                    uint32_t result = 2166136261u;
+
+                    for (uint32_t index = 0; index < length; index++) {
+                        result = (result ^ static_cast<uint8_t>(text[index])) * 16777619u;
+                    }
+
+                    return (result);
+                }
+                const Entry* Lookup(const TCHAR callsign[], const uint32_t length) const
+                {
+                    const Entry* result = nullptr;
+                    uint32_t slot = Hash(callsign, length) & _mask;
+
+                    while ((result == nullptr) && (_slots[slot] != 0)) {
+                        const Entry& entry(_entries[_slots[slot] - 1]);
+
+                        if ((entry.Callsign.length() == length) && (entry.Callsign.compare(0, length, callsign, length) == 0)) {
+                            result = &entry;
+                        }
+                        slot = (slot + 1) & _mask;
+                    }
+
+                    return (result);
+                }
+
+            private:
+                std::vector<Entry> _entries;
+                std::vector<uint32_t> _slots;
+                uint32_t _mask;
+                IAuthenticate* _officer;
+            };
+
         public:
 #ifdef __WINDOWS__
 #pragma warning(disable : 4355)
@@ -1717,13 +1929,18 @@ namespace PluginHost {
                 , _adminLock()
                 , _notificationLock()
                 , _services()
+                , _remotes()
                 , _notifiers()
                 , _engine(Core::ProxyType<RPC::InvokeServer>::Create(&(server._dispatcher)))
                 , _processAdministrator(*this, config.Communicator(), config.PersistentPath(), config.SystemPath(), config.DataPath(), config.VolatilePath(), config.AppPath(), config.ProxyStubPath(), _engine)
                 , _server(server)
                 , _subSystems(this)
                 , _authenticationHandler(nullptr)
+                , _routing(new Routing(_services, nullptr))
+                , _epoch(0)
             {
+                _readers[0] = 0;
+                _readers[1] = 0;
             }
 #ifdef __WINDOWS__
 #pragma warning(default : 4355)
@@ -1732,6 +1949,8 @@ namespace PluginHost {
             {
                 // Make sure all services are deactivated before we are killed (call Destroy on this object);
                 ASSERT(_services.size() == 0);
+
+                delete _routing.load();
             }
 
         public:
@@ -1747,6 +1966,8 @@ namespace PluginHost {
                         // Remove the security from all the channels.
                         _server.Dispatcher().SecurityRevoke(_webbridgeConfig.Security());
                     }
+
+                    Publish();
                 }
 
                 _adminLock.Unlock();
@@ -1755,15 +1976,17 @@ namespace PluginHost {
             {
                 ISecurity* result;
 
-                _adminLock.Lock();
+                const uint8_t side = Enter();
+                IAuthenticate* officer = _routing.load()->Officer();
+                Leave(side);
 
-                if (_authenticationHandler != nullptr) {
-                    result = _authenticationHandler->Officer(token);
+                // The authentication handler, once there, stays till the end, no need to hold on to the table.
+                if (officer != nullptr) {
+                    result = officer->Officer(token);
                 } else {
                     result = _webbridgeConfig.Security();
                 }
 
-                _adminLock.Unlock();
                 return (result);
             }
             inline uint32_t Submit(const uint32_t id, const Core::ProxyType<Core::JSON::IElement>& response)
@@ -1850,7 +2073,42 @@ namespace PluginHost {
 
             virtual void* Instantiate(const RPC::Object& object, const uint32_t waitTime, uint32_t& sessionId, const string& className, const string& callsign) override
             {
-                return (_processAdministrator.Create(sessionId, object, className, callsign, waitTime));
+                void* result = _processAdministrator.Create(sessionId, object, className, callsign, waitTime);
+
+                if (result != nullptr) {
+                    _adminLock.Lock();
+                    _remotes[callsign] = sessionId;
+                    _adminLock.Unlock();
+                }
+
+                return (result);
+            }
+            // The process id of the host of the last out-of-process part of a plugin, 0 if there is none running.
+            uint32_t RemoteProcess(const string& callsign)
+            {
+                uint32_t result = 0;
+                uint32_t connectionId = 0;
+
+                _adminLock.Lock();
+
+                std::map<string, uint32_t>::const_iterator index(_remotes.find(callsign));
+
+                if (index != _remotes.end()) {
+                    connectionId = index->second;
+                }
+
+                _adminLock.Unlock();
+
+                if (connectionId != 0) {
+                    RPC::IRemoteConnection* connection(_processAdministrator.Connection(connectionId));
+
+                    if (connection != nullptr) {
+                        result = connection->RemoteId();
+                        connection->Release();
+                    }
+                }
+
+                return (result);
             }
             virtual void Register(RPC::IRemoteConnection::INotification* sink) override
             {
@@ -1864,6 +2122,10 @@ namespace PluginHost {
             {
                 return (connectionId != 0 ? _processAdministrator.Connection(connectionId) : nullptr);
             }
+            void Zygotes(const uint8_t size)
+            {
+                _processAdministrator.Zygotes(size);
+            }
             uint32_t Persist()
             {
                 Override infoBlob(*this, _webbridgeConfig.PersistentPath() + PluginOverrideFile);
@@ -1887,6 +2149,8 @@ namespace PluginHost {
                     // Fire up the interface. Let it handle the messages.
                     _services.insert(std::pair<const string, Core::ProxyType<Service>>(configuration.Callsign.Value(), newService));
 
+                    Publish();
+
                     _adminLock.Unlock();
                 }
 
@@ -1902,6 +2166,8 @@ namespace PluginHost {
                 if (index != _services.end()) {
                     index->second->Destroy();
                     _services.erase(index);
+
+                    Publish();
                 }
 
                 _adminLock.Unlock();
@@ -1920,6 +2186,23 @@ namespace PluginHost {
                 _server._controller->Notification(message);
             }
 #endif
+            template <typename ACTION>
+            void Visit(ACTION&& action) const
+            {
+                std::list<Core::ProxyType<Service>> duplicates;
+
+                _adminLock.Lock();
+
+                for (const std::pair<const string, Core::ProxyType<Service>>& entry : _services) {
+                    duplicates.push_back(entry.second);
+                }
+
+                _adminLock.Unlock();
+
+                for (const Core::ProxyType<Service>& service : duplicates) {
+                    action(*service);
+                }
+            }
             void GetMetaData(Core::JSON::ArrayType<MetaData::Service>& metaData) const
             {
                 _adminLock.Lock();
@@ -1941,38 +2224,17 @@ namespace PluginHost {
                     duplicates.pop_front();
                 }
             }
-            uint32_t FromIdentifier(const string& callSign, Core::ProxyType<Service>& service)
+            uint32_t FromIdentifier(const string& callSign, Core::ProxyType<Service>& service) const
             {
-                uint32_t result = Core::ERROR_UNAVAILABLE;
-
-                _adminLock.Lock();
+                return (FromIdentifier(callSign.c_str(), static_cast<uint32_t>(callSign.length()), service));
+            }
+            uint32_t FromIdentifier(const TCHAR callSign[], const uint32_t length, Core::ProxyType<Service>& service) const
+            {
+                const uint8_t side = Enter();
 
-                for (auto index : _services) {
-                    const string& source(index.first);
-                    uint32_t length = static_cast<uint32_t>(source.length());
-
-                    if (callSign.compare(0, source.length(), source) == 0) {
-                        if (callSign.length() == length) {
-                            // Service found, did not requested specific version
-                            service = index.second;
-                            result = Core::ERROR_NONE;
-                            break;
-                        } else if (callSign[length] == '.') {
-                            // Requested specific version of a plugin
-                            if (index.second->HasVersionSupport(callSign.substr(length + 1)) == true) {
-                                // Requested version of service is supported!
-                                service = index.second;
-                                result = Core::ERROR_NONE;
-                            } else {
-                                // Requested version is not supported
-                                result = Core::ERROR_INVALID_SIGNATURE;
-                            }
-                            break;
-                        }
-                    }
-                }
+                uint32_t result = _routing.load()->Find(callSign, length, service);
 
-                _adminLock.Unlock();
+                Leave(side);
 
                 return (result);
             }
@@ -2054,6 +2316,33 @@ namespace PluginHost {
             {
                 return (_server.WorkerPool());
             }
+            inline uint8_t Enter() const
+            {
+                const uint8_t side = (_epoch.load() & 1);
+
+                _readers[side]++;
+
+                return (side);
+            }
+            inline void Leave(const uint8_t side) const
+            {
+                _readers[side]--;
+            }
+            // Called with the _adminLock taken, after _services or _authenticationHandler changed.
+            void Publish()
+            {
+                Routing* previous = _routing.exchange(new Routing(_services, _authenticationHandler));
+
+                for (uint8_t round = 0; round < 2; round++) {
+                    const uint8_t side = (_epoch.fetch_add(1) & 1);
+
+                    while (_readers[side].load() != 0) {
+                        ::SleepMs(0);
+                    }
+                }
+
+                delete previous;
+            }
 
         private:
             PluginHost::Config& _webbridgeConfig;
@@ -2061,6 +2350,7 @@ namespace PluginHost {
             mutable Core::CriticalSection _adminLock;
             Core::CriticalSection _notificationLock;
             std::map<const string, Core::ProxyType<Service>> _services;
+            std::map<string, uint32_t> _remotes;
             mutable RemoteInstantiators _instantiators;
             std::list<IPlugin::INotification*> _notifiers;
             Core::ProxyType<RPC::InvokeServer> _engine;
@@ -2068,6 +2358,167 @@ namespace PluginHost {
             Server& _server;
             Core::Sink<SubSystems> _subSystems;
             IAuthenticate* _authenticationHandler;
+            std::atomic<Routing*> _routing;
+            std::atomic<uint32_t> _epoch;
+            mutable std::atomic<uint32_t> _readers[2];
+        };
+
+        // Rationale:
+        // Activating all AutoStart plugins one after the other on the main thread means that one slow
+        // Initialize (or the spawn of an out-of-process plugin) delays every plugin behind it. The
+        // StartupScheduler activates the plugins as jobs on the WorkerPool, as soon as all the plugins it
+        // depends on ("dependencies" in the plugin configuration) are activated. A plugin of which the
+        // preconditions are not met, does not hold a worker: it is parked in the PRECONDITION state and
+        // the subsystem evaluation activates it later on, as before. Its dependents follow once it is
+        // activated. Not all workers are used for activations, an out-of-process plugin needs a free worker
+        // to handle the calls its process makes, while it is being activated.
+        class EXTERNAL StartupScheduler {
+        private:
+            StartupScheduler() = delete;
+            StartupScheduler(const StartupScheduler&) = delete;
+            StartupScheduler& operator=(const StartupScheduler&) = delete;
+
+            class Sink : public PluginHost::IPlugin::INotification {
+            private:
+                Sink() = delete;
+                Sink(const Sink&) = delete;
+                Sink& operator=(const Sink&) = delete;
+
+            public:
+                Sink(StartupScheduler* parent)
+                    : _parent(*parent)
+                {
+                    ASSERT(parent != nullptr);
+                }
+                virtual ~Sink()
+                {
+                }
+
+            public:
+                virtual void StateChange(PluginHost::IShell* plugin) override
+                {
+                    if (plugin->State() == PluginHost::IShell::ACTIVATED) {
+                        _parent.Activated(plugin->Callsign());
+                    }
+                }
+
+                BEGIN_INTERFACE_MAP(Sink)
+                INTERFACE_ENTRY(PluginHost::IPlugin::INotification)
+                END_INTERFACE_MAP
+
+            private:
+                StartupScheduler& _parent;
+            };
+
+            class Job : public Core::IDispatchType<void> {
+            private:
+                Job() = delete;
+                Job(const Job&) = delete;
+                Job& operator=(const Job&) = delete;
+
+            public:
+                Job(StartupScheduler* parent, const string& callsign)
+                    : _parent(*parent)
+                    , _callsign(callsign)
+                {
+                    ASSERT(parent != nullptr);
+                }
+                virtual ~Job()
+                {
+                }
+
+            public:
+                virtual void Dispatch() override
+                {
+                    _parent.Activate(_callsign);
+                }
+
+            private:
+                StartupScheduler& _parent;
+                const string _callsign;
+            };
+
+            struct Entry {
+                Entry(const Core::ProxyType<Server::Service>& service)
+                    : Shell(service)
+                    , Dependents()
+                    , Pending(0)
+                    , Scheduled(0)
+                    , Started(0)
+                    , Released(false)
+                {
+                }
+
+                Core::ProxyType<Server::Service> Shell;
+                // Callsigns of the plugins waiting for this one.
+                std::list<string> Dependents;
+                // Number of dependencies that are not activated yet.
+                uint16_t Pending;
+                // Relative to the start, in us.
+                uint64_t Scheduled;
+                uint64_t Started;
+                bool Released;
+            };
+
+        public:
+#ifdef __WINDOWS__
+#pragma warning(disable : 4355)
+#endif
+            StartupScheduler(Server& server, const uint8_t parallel)
+                : _adminLock()
+                , _server(server)
+                , _entries()
+                , _ready()
+                , _parallel(std::min(parallel, static_cast<uint8_t>(THREADPOOL_COUNT > 1 ? THREADPOOL_COUNT - 1 : 0)))
+                , _slots(0)
+                , _running(0)
+                , _remaining(0)
+                , _start(0)
+                , _closed(false)
+                , _idle(true, true)
+                , _sink(this)
+            {
+            }
+#ifdef __WINDOWS__
+#pragma warning(default : 4355)
+#endif
+            ~StartupScheduler()
+            {
+                ASSERT(_running == 0);
+            }
+
+        public:
+            // Activate all plugins that should be started automatically. If the plugins are activated in
+            // parallel, this returns as soon as the first activations are scheduled.
+            void Open();
+            // Wait for the activations that are running and stop scheduling new ones.
+            void Close();
+            void GetMetaData(Core::JSON::ArrayType<MetaData::Timeline>& metaData) const;
+
+        private:
+            void Activate(const string& callsign);
+            void Activated(const string& callsign);
+            void Release(Entry& entry);
+            void Ready(const string& callsign, Entry& entry);
+            void Schedule();
+            inline uint64_t Elapsed() const
+            {
+                return (Core::Time::Now().Ticks() - _start);
+            }
+
+        private:
+            mutable Core::CriticalSection _adminLock;
+            Server& _server;
+            std::map<string, Entry> _entries;
+            std::list<string> _ready;
+            const uint8_t _parallel;
+            uint8_t _slots;
+            uint8_t _running;
+            uint32_t _remaining;
+            uint64_t _start;
+            bool _closed;
+            Core::Event _idle;
+            Core::Sink<Sink> _sink;
         };
 
         // Connection handler is the listening socket and keeps track of all open
@@ -2098,11 +2549,6 @@ namespace PluginHost {
                 }
 
             public:
-                void Close()
-                {
-                    TRACE(Activity, (_T("HTTP Request with direct close on [%d]"), _ID));
-                    _server->Dispatcher().Suspend(_ID);
-                }
                 bool HasService() const
                 {
                     return (_service.IsValid());
@@ -2139,10 +2585,10 @@ namespace PluginHost {
                 {
                     return (_service->Inbound(_ID, *message));
                 }
-                template <typename PACKAGE>
-                void Submit(PACKAGE package)
+                template <typename... PACKAGE>
+                void Submit(PACKAGE&&... package)
                 {
-                    _server->Dispatcher().Submit(_ID, package);
+                    _server->Dispatcher().Submit(_ID, std::forward<PACKAGE>(package)...);
                 }
 
             private:
@@ -2159,6 +2605,7 @@ namespace PluginHost {
                 WebRequestJob(Server* server)
                     : Job(server)
                     , _request()
+                    , _sequence(0)
                     , _jsonrpc(false)
                 {
                 }
@@ -2177,13 +2624,14 @@ namespace PluginHost {
                     _missingResponse->ErrorCode = Web::STATUS_INTERNAL_SERVER_ERROR;
                     _missingResponse->Message = _T("There is no response from the requested service.");
                 }
-                void Set(const uint32_t id, Core::ProxyType<Service>& service, Core::ProxyType<Web::Request>& request, const string& token, const bool JSONRPC)
+                void Set(const uint32_t id, const uint32_t sequence, Core::ProxyType<Service>& service, Core::ProxyType<Web::Request>& request, const string& token, const bool JSONRPC)
                 {
                     Job::Set(id, service);
 
                     ASSERT(_request.IsValid() == false);
 
                     _request = request;
+                    _sequence = sequence;
                     _jsonrpc = JSONRPC && (_request->HasBody() == true);
                     _token = token;
                 }
@@ -2229,14 +2677,10 @@ namespace PluginHost {
                         if (response->CacheControl.IsSet() == false)
                             response->CacheControl = _T("no-cache, private, no-store, must-revalidate, max-stale=0, post-check=0, pre-check=0");
 
-                        Job::Submit(response);
+                        Job::Submit(_sequence, response);
                     } else {
                         // Fire and forget, We are done !!!
-                        Job::Submit(_missingResponse);
-                    }
-
-                    if (_request->Connection.Value() == Web::Request::CONNECTION_CLOSE) {
-                        Job::Close();
+                        Job::Submit(_sequence, _missingResponse);
                     }
 
                     // We are done, clear all info
@@ -2248,6 +2692,7 @@ namespace PluginHost {
             private:
                 Core::ProxyType<Web::Request> _request;
                 string _token;
+                uint32_t _sequence;
                 bool _jsonrpc;
 
                 static Core::ProxyType<Web::Response> _missingResponse;
@@ -2378,6 +2823,9 @@ namespace PluginHost {
 
                 _unauthorizedRequest->ErrorCode = Web::STATUS_UNAUTHORIZED;
                 _unauthorizedRequest->Message = _T("Request needs authorization, but it was not authorized");
+
+                _congested->ErrorCode = Web::STATUS_SERVICE_UNAVAILABLE;
+                _congested->Message = _T("Too many pipelined requests are waiting for a response on this connection.");
             }
             void Revoke(PluginHost::ISecurity* baseRights)
             {
@@ -2456,6 +2904,10 @@ namespace PluginHost {
             {
                 ISecurity* security = nullptr;
 
+                // Requests are parsed ahead, while the ones before them are still handled. Whatever the request
+                // turns out to be, the response goes out under this number, so in the order of the requests.
+                const uint32_t sequence = Sequence((request->Connection.IsSet() == true) && (request->Connection.Value() == Web::Request::CONNECTION_CLOSE));
+
                 TRACE(WebFlow, (Core::proxy_cast<Web::Request>(request)));
 
                 // See if a token has been hooked up to the request, maybe we need a
@@ -2520,23 +2972,23 @@ namespace PluginHost {
                         result->Message = "Not Found";
                     }
 
-                    Submit(result);
+                    Submit(sequence, result);
 
                     break;
                 }
                 case Request::MISSING_CALLSIGN: {
                     // Report that we, at least, need a call sign.
-                    Submit(_missingCallsign);
+                    Submit(sequence, _missingCallsign);
                     break;
                 }
                 case Request::INVALID_VERSION: {
                     // Report that we, at least, need a call sign.
-                    Submit(_incorrectVersion);
+                    Submit(sequence, _incorrectVersion);
                     break;
                 }
                 case Request::UNAUTHORIZED: {
                     // Report that we, at least, need a call sign.
-                    Submit(_unauthorizedRequest);
+                    Submit(sequence, _unauthorizedRequest);
                     break;
                 }
                 case Request::COMPLETE: {
@@ -2548,7 +3000,10 @@ namespace PluginHost {
 
                     if (response.IsValid() == true) {
                         // Report that the calls sign could not be found !!
-                        Submit(response);
+                        Submit(sequence, response);
+                    } else if (IsCongested(sequence) == true) {
+                        // The client keeps on pipelining while we do not keep up, do not take on more work.
+                        Submit(sequence, _congested);
                     } else {
                         // Send the Request object out to be handled.
                         // By definition, we can issue it on a rental thread..
@@ -2558,7 +3013,7 @@ namespace PluginHost {
 
                         if (job.IsValid() == true) {
                             Core::ProxyType<Web::Request> baseRequest(Core::proxy_cast<Web::Request>(request));
-                            job->Set(Id(), service, baseRequest, _security->Token(), !request->ServiceCall());
+                            job->Set(Id(), sequence, service, baseRequest, _security->Token(), !request->ServiceCall());
                             _parent.Submit(Core::proxy_cast<Core::IDispatchType<void>>(job));
                         }
                     }
@@ -2622,15 +3077,15 @@ namespace PluginHost {
                 }
 
                 if (securityClearance == true) {
-                    // Send the JSON object out to be handled.
-                    // By definition, we can issue it on a rental thread..
+                    // Send the JSON object out to be handled, on a rental thread, but in order with the
+                    // other messages of this channel.
                     Core::ProxyType<JSONElementJob> job(_jsonJobs.Element(&_parent));
 
                     ASSERT(job.IsValid() == true);
 
                     if ((_service.IsValid() == true) && (job.IsValid() == true)) {
                         job->Set(Id(), _service, element, _security->Token(), ((State() & Channel::JSONRPC) != 0));
-                        _parent.Submit(Core::proxy_cast<Core::IDispatch>(job));
+                        _parent.Submit(Id(), Core::proxy_cast<Core::IDispatch>(job));
                     }
                 }
             }
@@ -2648,7 +3103,7 @@ namespace PluginHost {
 
                 if ((_service.IsValid() == true) && (job.IsValid() == true)) {
                     job->Set(Id(), _service, value);
-                    _parent.Submit(Core::proxy_cast<Core::IDispatch>(job));
+                    _parent.Submit(Id(), Core::proxy_cast<Core::IDispatch>(job));
                 }
             }
 
@@ -2715,6 +3170,8 @@ namespace PluginHost {
                             State(TEXT, false);
                         } else if (Protocol() == _T("jsonrpc")) {
                             State(JSONRPC, false);
+                        } else if (Protocol() == _T("jsonrpc+msgpack")) {
+                            State(JSONRPC, false, true);
                         } else {
                             // Channel is a raw communication channel.
                             // This channel allows for passing binary data back and forth
@@ -2733,7 +3190,7 @@ namespace PluginHost {
                         if (Name().length() > (JSONRPCHeader.length() + 1)) {
                             Properties(static_cast<uint32_t>(JSONRPCHeader.length()) + 1);
                         }
-                        State(JSONRPC, false);
+                        State(JSONRPC, false, (Protocol() == _T("jsonrpc+msgpack")));
 
                         // The state needs to be correct before we c
                         if (_service->Subscribe(*this) == false) {
@@ -2772,6 +3229,10 @@ namespace PluginHost {
             // If a request requires security clearance, but it is not give, for
             // whatever reason, we will report back that the request is unauthorized.
             static Core::ProxyType<Web::Response> _unauthorizedRequest;
+
+            // If the client pipelines more requests than allowed, the ones over the
+            // limit are answered without being handled.
+            static Core::ProxyType<Web::Response> _congested;
         };
         class EXTERNAL ChannelMap : public Core::SocketServerType<Channel> {
         private:
@@ -2872,6 +3333,17 @@ namespace PluginHost {
                 return (Core::SocketServerType<Channel>::Count());
             }
             void GetMetaData(Core::JSON::ArrayType<MetaData::Channel>& metaData) const;
+            template <typename ACTION>
+            void Visit(ACTION&& action) const
+            {
+                Core::SocketServerType<Channel>::Iterator index(Core::SocketServerType<Channel>::Clients());
+
+                while (index.Next() == true) {
+                    Core::ProxyType<Channel> client(index.Client());
+
+                    action(static_cast<const Channel&>(*client));
+                }
+            }
 
         private:
             void Timed()
@@ -2923,6 +3395,10 @@ namespace PluginHost {
         {
             return (_services);
         }
+        inline const StartupScheduler& Startup() const
+        {
+            return (_startup);
+        }
         inline Server::WorkerPoolImplementation& WorkerPool()
         {
             return (_dispatcher);
@@ -2931,6 +3407,10 @@ namespace PluginHost {
         {
             _dispatcher.Submit(job);
         }
+        inline void Submit(const uint32_t strand, const Core::ProxyType<Core::IDispatchType<void>>& job)
+        {
+            _dispatcher.Submit(strand, job);
+        }
         inline void Schedule(const uint64_t time, const Core::ProxyType<Core::IDispatchType<void>>& job)
         {
             _dispatcher.Schedule(time, job);
@@ -2988,6 +3468,9 @@ namespace PluginHost {
         // Maintain a list of all the loaded plugin servers. Here we can dispatch work to.
         ServiceMap _services;
 
+        // Activates the plugins that should be started automatically.
+        StartupScheduler _startup;
+
         PluginHost::InputHandler _inputHandler;
 
         // Hold on to the controller that controls the PluginHost. Using this plugin, the
@@ -127,7 +127,7 @@ namespace Process {
     class ConsoleOptions : public Core::Options {
     public:
         ConsoleOptions(int argumentCount, TCHAR* arguments[])
-            : Core::Options(argumentCount, arguments, _T("h:l:c:r:p:s:d:a:m:i:u:g:t:e:x:V:v:"))
+            : Core::Options(argumentCount, arguments, _T("h:l:c:r:p:s:d:a:m:i:u:g:t:e:x:V:v:z:"))
             , Locator(nullptr)
             , ClassName(nullptr)
             , RemoteChannel(nullptr)
@@ -144,6 +144,7 @@ namespace Process {
             , Group(nullptr)
             , Threads(1)
             , EnabledLoggings(0)
+            , Zygote(-1)
         {
             Parse();
         }
@@ -168,6 +169,7 @@ namespace Process {
         const TCHAR* Group;
         uint8_t Threads;
         uint32_t EnabledLoggings;
+        int Zygote;
 
     private:
         string Strip(const TCHAR text[]) const
@@ -233,6 +235,9 @@ namespace Process {
             case 't':
                 Threads = Core::NumberType<uint8_t>(Core::TextFragment(argument)).Value();
                 break;
+            case 'z':
+                Zygote = Core::NumberType<int>(Core::TextFragment(argument)).Value();
+                break;
             case 'h':
             default:
                 RequestUsage(true);
@@ -241,6 +246,98 @@ namespace Process {
         }
     };
 
+#ifndef __WINDOWS__
+    // A zygote is started ahead of time by the host (see RPC::ZygotePool), with only the channel to the
+    // host and the ProxyStub path. It waits there for the options of the plugin it is going to run.
+    class Zygote {
+    private:
+        static constexpr uint32_t MaxLength = 64 * 1024;
+
+    public:
+        Zygote() = delete;
+        Zygote(const Zygote&) = delete;
+        Zygote& operator=(const Zygote&) = delete;
+
+        Zygote(const TCHAR command[])
+            : _arguments()
+            , _argv()
+        {
+            _arguments.emplace_back(command);
+        }
+        ~Zygote()
+        {
+        }
+
+    public:
+        int Count() const
+        {
+            return (static_cast<int>(_arguments.size()));
+        }
+        TCHAR** Arguments()
+        {
+            return (_argv.data());
+        }
+        // Returns false if the host closed the channel without handing over any options.
+        bool Wait(const int channel, const string& proxyStubPath)
+        {
+            bool result = false;
+            uint32_t length = 0;
+
+            // Whatever plugin we are going to run, it will need the ProxyStubs.
+            if (proxyStubPath.empty() == false) {
+                RPC::Administrator::Instance().LoadProxyStubs(proxyStubPath);
+            }
+
+            if ((Receive(channel, &length, sizeof(length)) == true) && (length <= MaxLength)) {
+                string options(length, '\0');
+
+                if (Receive(channel, &(options[0]), length) == true) {
+                    string::size_type start = 0;
+                    string::size_type end;
+
+                    while ((end = options.find('\0', start)) != string::npos) {
+                        _arguments.emplace_back(options, start, end - start);
+                        start = end + 1;
+                    }
+
+                    for (string& argument : _arguments) {
+                        _argv.push_back(&(argument[0]));
+                    }
+                    _argv.push_back(nullptr);
+
+                    result = true;
+                }
+            }
+
+            ::close(channel);
+
+            return (result);
+        }
+
+    private:
+        static bool Receive(const int channel, void* data, const uint32_t length)
+        {
+            uint32_t received = 0;
+
+            while (received < length) {
+                ssize_t result = ::read(channel, &(static_cast<uint8_t*>(data)[received]), length - received);
+
+                if (result > 0) {
+                    received += static_cast<uint32_t>(result);
+                } else if ((result == 0) || (errno != EINTR)) {
+                    break;
+                }
+            }
+
+            return (received == length);
+        }
+
+    private:
+        std::vector<string> _arguments;
+        std::vector<TCHAR*> _argv;
+    };
+#endif
+
     static void* CheckInstance(const string& path, const TCHAR locator[], const TCHAR className[], const uint32_t ID, const uint32_t version)
     {
         void* result = nullptr;
@@ -342,7 +439,6 @@ public:
     ProcessFlow()
         : _server()
         , _engine()
-        , _proxyStubs()
         , _factories()
     {
         _instance = this;
@@ -374,8 +470,6 @@ public:
             // We are done, close the channel and unregister all shit we added...
             _server->Close(2 * RPC::CommunicationTimeOut);
 
-            _proxyStubs.clear();
-
             _server.Release();
         }
 
@@ -424,17 +518,10 @@ public:
         TRACE_L1("Loading ProxyStubs from %s", (pathName.empty() == false ? pathName.c_str() : _T("<< No Proxy Stubs Loaded >>")));
 
         if (pathName.empty() == false) {
-            Core::Directory index(pathName.c_str(), _T("*.so"));
-
-            while (index.Next() == true) {
-                Core::Library library(index.Current().c_str());
-
-                if (library.IsLoaded() == true) {
-                    _proxyStubs.push_back(library);
-                }
-            }
+            // The libraries themselves are loaded on the first use of one of their interfaces.
+            RPC::Administrator::Instance().LoadProxyStubs(pathName);
         }
- 
+
         if ((result = _server->Open(waitTime, interfaceId, base, sequenceId)) == Core::ERROR_NONE) {
             TRACE_L1("Process up and running: %d.", Core::ProcessInfo().Id());
             _engine->Run();
@@ -466,7 +553,6 @@ private:
 private:
     Core::ProxyType<RPC::CommunicatorClient> _server;
     Core::ProxyType<WorkerPoolImplementation> _engine;
-    std::list<Core::Library> _proxyStubs;
     FactoriesImplementation _factories;
 
     static Core::CriticalSection _lock;
@@ -476,22 +562,8 @@ private:
 /* static */ Core::CriticalSection  ProcessFlow::_lock;
 /* static */ ProcessFlow*           ProcessFlow::_instance = nullptr;
 
-} // Process
-
-} // WPEFramework
-
-using namespace WPEFramework;
-
-#ifdef __WINDOWS__
-int _tmain(int argc, _TCHAR* argv[])
-#else
-int main(int argc, char** argv)
-#endif
+static void Execute(ConsoleOptions& options, int argc, TCHAR* argv[])
 {
-    // Give the debugger time to attach to this process..
-    // Sleep(20000);
-    Process::ConsoleOptions options(argc, argv);
-
     if ((options.RequestUsage() == true) || (options.Locator == nullptr) || (options.ClassName == nullptr) || (options.RemoteChannel == nullptr) || (options.Exchange == 0)) {
         printf("Process [-h] \n");
         printf("         -l <locator>\n");
@@ -524,7 +596,7 @@ int main(int argc, char** argv)
             printf("Argument [%02d]: %s\n", teller, argv[teller]);
         }
     } else {
-        Process::ProcessFlow process;
+        ProcessFlow process;
 
         Core::NodeId remoteNode(options.RemoteChannel);
 
@@ -558,13 +630,52 @@ int main(int argc, char** argv)
             process.Startup(options.Threads, remoteNode);
 
             // Register an interface to handle incoming requests for interfaces.
-            if ((base = Process::AquireInterfaces(options)) != nullptr) {
+            if ((base = AquireInterfaces(options)) != nullptr) {
 
                 TRACE_L1("Allright time to start running");
                 process.Run(options.ProxyStubPath, options.InterfaceId, base, options.Exchange);
             }
         }
     }
+}
+
+} // Process
+
+} // WPEFramework
+
+using namespace WPEFramework;
+
+#ifdef __WINDOWS__
+int _tmain(int argc, _TCHAR* argv[])
+#else
+int main(int argc, char** argv)
+#endif
+{
+    // Give the debugger time to attach to this process..
+    // Sleep(20000);
+    Process::ConsoleOptions options(argc, argv);
+
+#ifndef __WINDOWS__
+    if (options.Zygote != -1) {
+        Process::Zygote zygote(argv[0]);
+
+        // From here on, we continue as if we were started with the options the host handed over.
+        if (zygote.Wait(options.Zygote, options.ProxyStubPath) == true) {
+            optind = 0;
+
+            Process::ConsoleOptions specialized(zygote.Count(), zygote.Arguments());
+
+            Process::Execute(specialized, zygote.Count(), zygote.Arguments());
+        } else {
+            // The host did not need us after all, clean up what was loaded up front.
+            Core::Singleton::Dispose();
+        }
+    } else {
+        Process::Execute(options, argc, argv);
+    }
+#else
+    Process::Execute(options, argc, argv);
+#endif
 
     TRACE_L1("End of Process!!!!");
     return 0;
@@ -0,0 +1,168 @@
+/*
+ * If not stated otherwise in this file or this component's LICENSE file the
+ * following copyright and licenses apply:
+ *
+ * Copyright 2020 RDK Management
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __BROADCAST_DEMUX_H
+#define __BROADCAST_DEMUX_H
+
+#include "Definitions.h"
+#include "MPEGSection.h"
+
+namespace WPEFramework {
+
+namespace Broadcast {
+
+    // Rationale:
+    // A demux section filter (e.g. /dev/dvb/adapterX/demuxY) queues complete sections back to back. Instead
+    // of reading a section in two small reads (header and body) into a private buffer, the DemuxReader
+    // drains the device with large reads into a buffer, that can be shared by all the filters handled on
+    // the same thread, and hands out views on the sections in that buffer. Only a section that is split
+    // over two reads is copied, to be completed by the next read.
+    // The section handed to the ISection is only valid for the duration of the Handle() call.
+    class DemuxReader {
+    private:
+        DemuxReader() = delete;
+        DemuxReader(const DemuxReader&) = delete;
+        DemuxReader& operator=(const DemuxReader&) = delete;
+
+    public:
+        struct Statistics {
+            uint32_t Reads;
+            uint32_t Sections;
+            uint64_t Bytes;
+            uint32_t Dropped;
+            uint32_t Overflows;
+        };
+
+    public:
+        DemuxReader(const Core::ProxyType<Core::DataStore>& buffer, ISection* callback)
+            : _buffer(buffer)
+            , _callback(callback)
+            , _pending()
+            , _statistics()
+        {
+            ASSERT(_buffer.IsValid() == true);
+            ASSERT(_callback != nullptr);
+
+            ::memset(&_statistics, 0, sizeof(_statistics));
+        }
+        ~DemuxReader()
+        {
+            _statistics.Dropped += (_pending.empty() == false ? 1 : 0);
+        }
+
+    public:
+        inline const Statistics& Counters() const
+        {
+            return (_statistics);
+        }
+
+        // Read until the descriptor has nothing more to offer. Returns ERROR_NONE, or ERROR_CONNECTION_CLOSED
+        // if the other side closed it, or ERROR_READ_ERROR if reading failed.
+        uint32_t Read(const int descriptor)
+        {
+            uint32_t result = Core::ERROR_NONE;
+            uint8_t* buffer = _buffer->Buffer();
+            const uint32_t size = _buffer->Size();
+            bool drained = false;
+
+            ASSERT(size > (2 * MaxSectionSize));
+
+            while (drained == false) {
+                const uint32_t filled = static_cast<uint32_t>(_pending.size());
+
+                if (filled > 0) {
+                    ::memcpy(buffer, _pending.data(), filled);
+                }
+
+                const int loaded = ::read(descriptor, &(buffer[filled]), size - filled);
+
+                if (loaded > 0) {
+                    _pending.clear();
+                    _statistics.Reads++;
+                    _statistics.Bytes += loaded;
+
+                    Dispatch(buffer, filled + loaded);
+
+                    // A short read means the queue is empty.
+                    drained = (static_cast<uint32_t>(loaded) < (size - filled));
+                } else {
+                    drained = true;
+
+                    if (loaded == 0) {
+                        result = Core::ERROR_CONNECTION_CLOSED;
+                        Drop();
+                    } else if (errno == EOVERFLOW) {
+                        // The device could not keep up and discarded data. Whatever is pending will never
+                        // be completed, but the next read has fresh sections again.
+                        _statistics.Overflows++;
+                        Drop();
+                        drained = false;
+                    } else if ((errno != EAGAIN) && (errno != EWOULDBLOCK) && (errno != EINTR)) {
+                        result = Core::ERROR_READ_ERROR;
+                        Drop();
+                    }
+                }
+            }
+
+            return (result);
+        }
+
+    private:
+        static constexpr uint16_t MaxSectionSize = 4096 + 3;
+
+        void Dispatch(uint8_t buffer[], const uint32_t length)
+        {
+            uint32_t offset = 0;
+
+            while ((length - offset) >= 3) {
+                const uint16_t sectionLength = (((buffer[offset + 1] & 0x0F) << 8) | buffer[offset + 2]) + 3;
+
+                if ((length - offset) < sectionLength) {
+                    break;
+                }
+
+                _statistics.Sections++;
+                _callback->Handle(MPEG::Section(Core::DataElement(sectionLength, &(buffer[offset]))));
+
+                offset += sectionLength;
+            }
+
+            if (offset < length) {
+                _pending.assign(&(buffer[offset]), &(buffer[length]));
+            }
+        }
+        void Drop()
+        {
+            if (_pending.empty() == false) {
+                _statistics.Dropped++;
+                _pending.clear();
+            }
+        }
+
+    private:
+        Core::ProxyType<Core::DataStore> _buffer;
+        ISection* _callback;
+        std::vector<uint8_t> _pending;
+        Statistics _statistics;
+    };
+
+} // namespace Broadcast
+} // namespace WPEFramework
+
+#endif // __BROADCAST_DEMUX_H
@@ -0,0 +1,599 @@
+
+ /*
+ * If not stated otherwise in this file or this component's LICENSE file the
+ * following copyright and licenses apply:
+ *
+ * Copyright 2020 RDK Management
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "Definitions.h"
+#include "MPEGSection.h"
+#include "TunerAdministrator.h"
+
+// --------------------------------------------------------------------
+// A tuner that "receives" its transport stream from a capture (.ts) file.
+// It allows to reproduce and profile the PSI/SI handling without any
+// hardware. The capture is memory mapped and replayed at a configured
+// bitrate, or as fast as possible.
+// --------------------------------------------------------------------
+namespace WPEFramework {
+namespace Broadcast {
+
+    class __attribute__((visibility("hidden"))) Tuner : public ITuner {
+    private:
+        Tuner() = delete;
+        Tuner(const Tuner&) = delete;
+        Tuner& operator=(const Tuner&) = delete;
+
+        static constexpr uint8_t PacketSize = 188;
+        static constexpr uint8_t SyncByte = 0x47;
+
+        // Number of packets handled in one go, before the filters can be changed again.
+        static constexpr uint16_t PacketsPerSlice = 512;
+
+        class Player : public Core::Thread {
+        private:
+            Player() = delete;
+            Player(const Player&) = delete;
+            Player& operator=(const Player&) = delete;
+
+        public:
+            Player(Tuner& parent)
+                : Core::Thread(Thread::DefaultStackSize(), _T("Replay"))
+                , _parent(parent)
+            {
+            }
+            ~Player() override
+            {
+                Stop();
+                Wait(Thread::STOPPED | Thread::BLOCKED, Core::infinite);
+            }
+
+        private:
+            uint32_t Worker() override
+            {
+                return (_parent.Process());
+            }
+
+        private:
+            Tuner& _parent;
+        };
+
+        // Collects the sections of a single PID, that are spread over multiple packets.
+        class Assembler {
+        private:
+            Assembler(const Assembler&) = delete;
+            Assembler& operator=(const Assembler&) = delete;
+
+        public:
+            Assembler()
+                : _buffer()
+                , _continuity(~0)
+                , _synchronized(false)
+            {
+            }
+            ~Assembler()
+            {
+            }
+
+        public:
+            template <typename ACTION>
+            void Load(const uint8_t packet[], ACTION&& action)
+            {
+                const bool start = ((packet[1] & 0x40) != 0);
+                const uint8_t adaptation = ((packet[3] >> 4) & 0x03);
+                const uint8_t continuity = (packet[3] & 0x0F);
+
+                if ((adaptation & 0x01) != 0) {
+                    uint8_t offset = 4 + ((adaptation & 0x02) != 0 ? packet[4] + 1 : 0);
+
+                    if (continuity != static_cast<uint8_t>((_continuity + 1) & 0x0F)) {
+                        // Lost a packet, whatever we were collecting is incomplete.
+                        _synchronized = false;
+                        _buffer.clear();
+                    }
+                    _continuity = continuity;
+
+                    if (offset < PacketSize) {
+                        if (start == true) {
+                            const uint8_t pointer = packet[offset++];
+                            const uint8_t end = std::min(static_cast<uint16_t>(offset + pointer), static_cast<uint16_t>(PacketSize));
+
+                            if (_synchronized == true) {
+                                _buffer.insert(_buffer.end(), &packet[offset], &packet[end]);
+                                Deliver(_buffer.data(), static_cast<uint16_t>(_buffer.size()), action);
+                            }
+
+                            _buffer.clear();
+                            _synchronized = true;
+                            offset = end;
+
+                            // All sections that fit completely in this packet, can be delivered straight from the capture.
+                            while ((offset + 3) <= PacketSize) {
+                                const uint16_t length = Length(&packet[offset]);
+
+                                if ((packet[offset] == 0xFF) || ((offset + length) > PacketSize)) {
+                                    break;
+                                }
+
+                                action(&packet[offset], length);
+                                offset += length;
+                            }
+                        }
+
+                        // Without a payload unit start, no new section can start in this packet, so we only
+                        // continue a section that is pending. Otherwise the rest is the start of a new one.
+                        if ((_synchronized == true) && (offset < PacketSize) && ((start == true) ? (packet[offset] != 0xFF) : (_buffer.empty() == false))) {
+                            _buffer.insert(_buffer.end(), &packet[offset], &packet[PacketSize]);
+
+                            if (Deliver(_buffer.data(), static_cast<uint16_t>(_buffer.size()), action) == true) {
+                                _buffer.clear();
+                            }
+                        }
+                    }
+                }
+            }
+
+        private:
+            static inline uint16_t Length(const uint8_t data[])
+            {
+                return ((((data[1] & 0x0F) << 8) | data[2]) + 3);
+            }
+            template <typename ACTION>
+            static bool Deliver(const uint8_t data[], const uint16_t size, ACTION&& action)
+            {
+                bool delivered = false;
+
+                if ((size >= 3) && (size >= Length(data))) {
+                    action(data, Length(data));
+                    delivered = true;
+                }
+
+                return (delivered);
+            }
+
+        private:
+            std::vector<uint8_t> _buffer;
+            uint8_t _continuity;
+            bool _synchronized;
+        };
+
+        typedef std::map<uint32_t, ISection*> Filters;
+        typedef std::map<uint16_t, Assembler> Streams;
+
+    public:
+        class Information {
+        private:
+            Information(const Information&) = delete;
+            Information& operator=(const Information&) = delete;
+
+        private:
+            class Config : public Core::JSON::Container {
+            private:
+                Config(const Config&);
+                Config& operator=(const Config&);
+
+            public:
+                Config()
+                    : Core::JSON::Container()
+                    , Standard(ITuner::DVB)
+                    , Annex(ITuner::A)
+                    , Modus(ITuner::Terrestrial)
+                    , Path()
+                    , Rate(0)
+                    , Loop(false)
+                {
+                    Add(_T("standard"), &Standard);
+                    Add(_T("annex"), &Annex);
+                    Add(_T("modus"), &Modus);
+                    Add(_T("path"), &Path);
+                    Add(_T("rate"), &Rate);
+                    Add(_T("loop"), &Loop);
+                }
+                ~Config()
+                {
+                }
+
+            public:
+                Core::JSON::EnumType<ITuner::DTVStandard> Standard;
+                Core::JSON::EnumType<ITuner::annex> Annex;
+                Core::JSON::EnumType<ITuner::modus> Modus;
+                Core::JSON::String Path;
+                Core::JSON::DecUInt32 Rate;
+                Core::JSON::Boolean Loop;
+            };
+
+            Information()
+                : _standard(ITuner::DVB)
+                , _annex(ITuner::A)
+                , _modus(ITuner::Terrestrial)
+                , _path()
+                , _rate(0)
+                , _loop(false)
+            {
+            }
+
+        public:
+            static Information& Instance()
+            {
+                return (_instance);
+            }
+            ~Information()
+            {
+            }
+            void Initialize(const string& configuration)
+            {
+                Config config;
+                config.FromString(configuration);
+
+                _standard = config.Standard.Value();
+                _annex = config.Annex.Value();
+                _modus = config.Modus.Value();
+                _path = config.Path.Value();
+                _rate = config.Rate.Value();
+                _loop = config.Loop.Value();
+
+                if ((_path.empty() == false) && (_path[_path.length() - 1] != '/')) {
+                    _path += '/';
+                }
+            }
+            void Deinitialize()
+            {
+            }
+
+        public:
+            inline bool IsSupported(const ITuner::modus mode) const
+            {
+                return (mode == _modus);
+            }
+            inline ITuner::DTVStandard Standard() const
+            {
+                return (_standard);
+            }
+            inline ITuner::annex Annex() const
+            {
+                return (_annex);
+            }
+            inline ITuner::modus Modus() const
+            {
+                return (_modus);
+            }
+            inline const string& Path() const
+            {
+                return (_path);
+            }
+            // Replay rate in kbit/s, 0 means as fast as possible.
+            inline uint32_t Rate() const
+            {
+                return (_rate);
+            }
+            inline bool Loop() const
+            {
+                return (_loop);
+            }
+
+        private:
+            ITuner::DTVStandard _standard;
+            ITuner::annex _annex;
+            ITuner::modus _modus;
+            string _path;
+            uint32_t _rate;
+            bool _loop;
+
+            static Information _instance;
+        };
+
+    private:
+        Tuner(const string& fileName)
+            : _adminLock()
+            , _state(IDLE)
+            , _id(0)
+            , _capture(fileName, Core::File::USER_READ)
+            , _begin(0)
+            , _position(0)
+            , _start(0)
+            , _rate(Information::Instance().Rate())
+            , _loop(Information::Instance().Loop())
+            , _filters()
+            , _streams()
+            , _player(*this)
+            , _callback(nullptr)
+        {
+            if (_capture.IsValid() == false) {
+                TRACE_L1("Can not open capture %s error: %d.", fileName.c_str(), _capture.ErrorCode());
+            } else {
+                // Find the first sync byte, captures do not always start at a packet boundary.
+                const uint8_t* data = _capture.Buffer();
+                while ((_position < _capture.Size()) && ((data[_position] != SyncByte) || (((_position + PacketSize) < _capture.Size()) && (data[_position + PacketSize] != SyncByte)))) {
+                    _position++;
+                }
+                _begin = _position;
+
+                TRACE_L1("Opened capture %s, %d bytes.", fileName.c_str(), static_cast<uint32_t>(_capture.Size()));
+            }
+
+            _callback = TunerAdministrator::Instance().Announce(this);
+        }
+
+    public:
+        ~Tuner() override
+        {
+            _player.Stop();
+            _player.Wait(Core::Thread::STOPPED | Core::Thread::BLOCKED, Core::infinite);
+
+            TunerAdministrator::Instance().Revoke(this);
+
+            _callback = nullptr;
+        }
+
+        static ITuner* Create(const string& info)
+        {
+            Tuner* result = new Tuner(((info.empty() == false) && (info[0] == '/')) ? info : Information::Instance().Path() + info);
+
+            if ((result != nullptr) && (result->IsValid() == false)) {
+                delete result;
+                result = nullptr;
+            }
+
+            return (result);
+        }
+
+    public:
+        bool IsValid() const
+        {
+            return ((_capture.IsValid() == true) && (_capture.Size() >= (_begin + PacketSize)));
+        }
+
+        uint32_t Properties() const override
+        {
+            const Information& instance = Information::Instance();
+
+            return (instance.Annex() | instance.Standard() | instance.Modus());
+        }
+
+        // Currently locked on ID
+        // This method return a unique number that will identify the locked on Transport stream. The ID will always
+        // identify the uniquely locked on to Tune request. ID => 0 is reserved and means not locked on to anything.
+        uint16_t Id() const override
+        {
+            return (_state == IDLE ? 0 : _id);
+        }
+
+        state State() const override
+        {
+            return (_state);
+        }
+
+        // The capture is the only "frequency" this tuner can lock on to, the parameters only determine the Id.
+        uint32_t Tune(const uint16_t frequency, const Modulation, const uint32_t, const uint16_t, const SpectralInversion) override
+        {
+            _player.Block();
+            _player.Wait(Core::Thread::BLOCKED | Core::Thread::STOPPED, Core::infinite);
+
+            _adminLock.Lock();
+            _id = frequency;
+            Rewind();
+            _adminLock.Unlock();
+
+            Notify(LOCKED);
+
+            _player.Run();
+
+            return (Core::ERROR_NONE);
+        }
+
+        uint32_t Prepare(const uint16_t) override
+        {
+            return (Core::ERROR_UNAVAILABLE);
+        }
+
+        // A Tuner can be used to filter PSI/SI. Using the next call a callback can be installed to receive sections associated
+        // with a table. Each valid section received will be offered as a single section on the ISection interface for the user
+        // to process.
+        uint32_t Filter(const uint16_t pid, const uint8_t tableId, ISection* callback) override
+        {
+            uint32_t result = Core::ERROR_NONE;
+            const uint32_t id = (pid << 16) | tableId;
+
+            _adminLock.Lock();
+
+            if (callback != nullptr) {
+                _filters[id] = callback;
+                _streams[pid];
+            } else {
+                Filters::iterator index(_filters.find(id));
+
+                // The stream of this PID is dropped by the player, as this might be called from a Handle() on that stream.
+                if (index == _filters.end()) {
+                    result = Core::ERROR_UNAVAILABLE;
+                } else {
+                    _filters.erase(index);
+                }
+            }
+
+            _adminLock.Unlock();
+
+            return (result);
+        }
+
+        uint32_t Attach(const uint8_t) override
+        {
+            return (Core::ERROR_UNAVAILABLE);
+        }
+        uint32_t Detach(const uint8_t) override
+        {
+            return (Core::ERROR_UNAVAILABLE);
+        }
+
+    private:
+        void Notify(const state newState)
+        {
+            _state = newState;
+
+            if (_callback != nullptr) {
+                _callback->StateChange(this);
+            }
+        }
+        void Rewind()
+        {
+            // Start all over, with empty sections on all PIDs we filter on.
+            _position = _begin;
+            _start = 0;
+            _streams.clear();
+
+            for (const std::pair<const uint32_t, ISection*>& filter : _filters) {
+                _streams[filter.first >> 16];
+            }
+        }
+        void Deliver(const uint16_t pid, const uint8_t data[], const uint16_t length)
+        {
+            Filters::iterator index(_filters.find((pid << 16) | data[0]));
+
+            if (index != _filters.end()) {
+                // The capture is mapped read-only, a Section does not modify its data.
+                MPEG::Section section(Core::DataElement(length, const_cast<uint8_t*>(data)));
+
+                if (section.IsValid() == true) {
+                    index->second->Handle(section);
+                }
+            }
+        }
+        uint32_t Process()
+        {
+            uint32_t result = 0;
+            uint64_t limit = _capture.Size() - PacketSize + 1;
+
+            _adminLock.Lock();
+
+            if (_rate != 0) {
+                // Ticks are in uS, the rate in kbit/s.
+                const uint64_t now = Core::Time::Now().Ticks();
+
+                if (_start == 0) {
+                    _start = now - (((_position - _begin) * 8000) / _rate);
+                }
+
+                // Do not run ahead of the bitrate: the number of bytes that should have been played by now.
+                limit = std::min(limit, _begin + (((now - _start) * _rate) / 8000));
+            }
+
+            uint16_t count = PacketsPerSlice;
+            const uint8_t* data = _capture.Buffer();
+
+            while ((count != 0) && (_position < limit)) {
+                const uint8_t* packet = &(data[_position]);
+
+                if (packet[0] != SyncByte) {
+                    // Out of sync, look for the next packet boundary.
+                    _position++;
+                } else {
+                    const uint16_t pid = ((packet[1] & 0x1F) << 8) | packet[2];
+                    Streams::iterator stream(_streams.find(pid));
+
+                    if ((stream != _streams.end()) && ((packet[1] & 0x80) == 0)) {
+                        stream->second.Load(packet, [this, pid](const uint8_t section[], const uint16_t length) {
+                            Deliver(pid, section, length);
+                        });
+                    }
+
+                    _position += PacketSize;
+                    count--;
+                }
+            }
+
+            // Stop collecting sections on the PIDs that lost their last filter.
+            Streams::iterator stream(_streams.begin());
+            while (stream != _streams.end()) {
+                Filters::const_iterator index(_filters.lower_bound(stream->first << 16));
+
+                if ((index == _filters.end()) || ((index->first >> 16) != stream->first)) {
+                    stream = _streams.erase(stream);
+                } else {
+                    stream++;
+                }
+            }
+
+            bool finished = ((_position + PacketSize) > _capture.Size());
+
+            if ((finished == true) && (_loop == true)) {
+                Rewind();
+                finished = false;
+            } else if ((finished == false) && (count != 0)) {
+                // Caught up with the bitrate, give it some time.
+                _player.Block();
+                result = 10;
+            }
+
+            _adminLock.Unlock();
+
+            if (finished == true) {
+                // End of the capture, it is like losing the lock on the signal.
+                _player.Block();
+                result = Core::infinite;
+
+                Notify(IDLE);
+            }
+
+            return (result);
+        }
+
+    private:
+        Core::CriticalSection _adminLock;
+        state _state;
+        uint16_t _id;
+        Core::DataElementFile _capture;
+        uint64_t _begin;
+        uint64_t _position;
+        uint64_t _start;
+        const uint32_t _rate;
+        const bool _loop;
+        Filters _filters;
+        Streams _streams;
+        Player _player;
+        TunerAdministrator::ICallback* _callback;
+    };
+
+    /* static */ Tuner::Information Tuner::Information::_instance;
+
+    // The following methods will be called before any create is called. It allows for an initialization,
+    // if requires, and a deinitialization, if the Tuners will no longer be used.
+    /* static */ uint32_t ITuner::Initialize(const string& configuration)
+    {
+        Tuner::Information::Instance().Initialize(configuration);
+
+        return (Core::ERROR_NONE);
+    }
+
+    /* static */ uint32_t ITuner::Deinitialize()
+    {
+        Tuner::Information::Instance().Deinitialize();
+        return (Core::ERROR_NONE);
+    }
+
+    // See if the tuner supports the requested mode, or is configured for the requested mode. This method
+    // only returns proper values if the Initialize has been called before.
+    /* static */ bool ITuner::IsSupported(const ITuner::modus mode)
+    {
+        return (Tuner::Information::Instance().IsSupported(mode));
+    }
+
+    // Accessor to create a tuner.
+    /* static */ ITuner* ITuner::Create(const string& configuration)
+    {
+        return (Tuner::Create(configuration));
+    }
+
+} // namespace Broadcast
+} // namespace WPEFramework
@@ -19,6 +19,7 @@
  */
 
 #include "Definitions.h"
+#include "Demux.h"
 #include "ProgramTable.h"
 #include "TunerAdministrator.h"
 
@@ -228,13 +229,11 @@ static constexpr conversion_entry _tableRollOff[] = {
             MuxFilter(const MuxFilter&) = delete;
             MuxFilter& operator= (const MuxFilter&) = delete;
 
-            MuxFilter(const string& path, const uint8_t index, const uint16_t pid, const uint8_t tableId, ISection* callback) 
+            MuxFilter(const string& path, const uint8_t index, const uint16_t pid, const uint8_t tableId, ISection* callback, const Core::ProxyType<Core::DataStore>& buffer)
                 : _mux(-1)
-                , _offset(0)
-                , _length(0)
-                , _size(1024)
-                , _buffer(reinterpret_cast<uint8_t*>(::malloc(_size)))
-                , _callback(callback) {
+                , _pid(pid)
+                , _tableId(tableId)
+                , _reader(buffer, callback) {
 
                 char deviceName[32];
 
@@ -258,6 +257,11 @@ static constexpr conversion_entry _tableRollOff[] = {
                     sctFilterParams.filter.filter[0] = tableId;
                     sctFilterParams.filter.mask[0] = 0xFF;
 
+                    // Give the kernel room to queue sections while we are busy, we drain them in one go.
+                    if (ioctl(_mux, DMX_SET_BUFFER_SIZE, DeviceBufferSize) < 0) {
+                        TRACE_L1("Could not set the buffer size of the filter[%d,%d]: %d\n", pid, tableId, errno);
+                    }
+
                     if (ioctl(_mux, DMX_SET_FILTER, &sctFilterParams) < 0) {
                         TRACE_L1("Could not configue the filter[%d,%d]: %d\n", pid, tableId, errno);
                         ::close(_mux);
@@ -272,14 +276,19 @@ static constexpr conversion_entry _tableRollOff[] = {
                 if (_mux != -1) {
                     Core::ResourceMonitor::Instance().Unregister(*this);
                     ::close(_mux);
+
+                    const DemuxReader::Statistics& counters(_reader.Counters());
+                    TRACE_L1("Filter[%d,%d] closed. Sections: %d, Reads: %d, Dropped: %d, Overflows: %d", _pid, _tableId, counters.Sections, counters.Reads, counters.Dropped, counters.Overflows);
                 }
-                ::free(_buffer);
             }
 
         public:
             bool IsValid() const {
                 return (_mux != -1);
             }
+            const DemuxReader::Statistics& Counters() const {
+                return (_reader.Counters());
+            }
             handle Descriptor() const override {
                 return (_mux);
             }
@@ -287,68 +296,23 @@ static constexpr conversion_entry _tableRollOff[] = {
                 return (POLLPRI);
             }
             void Handle(const uint16_t events) override {
-               if (LoadHeader() == true) {
-                    int loaded = ::read(_mux, &(_buffer[_offset]), (_length - (_offset - 3)));
-                    if (loaded < 0) {
-                        int result = errno;
-                        if ((result != EAGAIN) || (result != EWOULDBLOCK)) {
-                            _offset = 0;
-                        }
-                    }
-                    else {
-                        _offset += loaded;
-                        if ((_offset - 3) == _length) {
-                            MPEG::Section newSection(Core::DataElement(_offset, _buffer));
-                            _callback->Handle(newSection);
-                            _offset = 0;
-                        }
-                    }
-                }
-            }
+                const uint32_t overflows = _reader.Counters().Overflows;
 
-        private:
-            bool LoadHeader() 
-            {
-                bool moreToLoad = true;
-                if (_offset < 3) {
-                    int loaded = ::read(_mux, &(_buffer[_offset]), (3 - _offset));
-                    if (loaded < 0) {
-                        int result = errno;
-                        if ((result != EAGAIN) || (result != EWOULDBLOCK)) {
-                            _offset = 0;
-                        }
-                        moreToLoad = false;
-                    }
-                    else {
-                        _offset += loaded;
-                        if (_offset != 3) {
-                            moreToLoad = false;
-                        }
-                        else {
-                            _length = (_buffer[1] << 8) | (_buffer[2] & 0xFF);
-                            if ((_length + 3) > _size) {
-                                uint8_t copy = _buffer[0];
-                                ::free (_buffer);
-                                _size = _length + 3;
-                                _buffer = reinterpret_cast<uint8_t*>(::malloc(_size));
-                                _buffer[0] = copy;
-                                _buffer[1] = (_length >> 8) & 0xFF;
-                                _buffer[2] = _length & 0xFF;
-                            }
-                        }
-                    }
+                if (_reader.Read(_mux) != Core::ERROR_NONE) {
+                    TRACE_L1("Could not read from the filter[%d,%d]: %d\n", _pid, _tableId, errno);
+                }
+                if (overflows != _reader.Counters().Overflows) {
+                    TRACE_L1("Filter[%d,%d] overflowed, sections are lost.", _pid, _tableId);
                 }
-                return (moreToLoad);
             }
- 
 
         private:
+            static constexpr uint32_t DeviceBufferSize = 64 * 1024;
+
             int _mux;
-            uint16_t _offset;
-            uint16_t _length;
-            uint16_t _size;
-            uint8_t* _buffer;
-            ISection* _callback;
+            uint16_t _pid;
+            uint8_t _tableId;
+            DemuxReader _reader;
         };
 
     public:
@@ -482,6 +446,7 @@ static constexpr conversion_entry _tableRollOff[] = {
             , _info({ 0 })
             , _devicePath()
             , _frontindex(0)
+            , _sections(Core::ProxyType<Core::DataStore>::Create(SectionBufferSize))
             , _callback(nullptr)
         {
             _callback = TunerAdministrator::Instance().Announce(this);
@@ -682,7 +647,7 @@ static constexpr conversion_entry _tableRollOff[] = {
                 auto entry = _filters.emplace(
                                  std::piecewise_construct, 
                                  std::forward_as_tuple(id), 
-                                 std::forward_as_tuple(_devicePath, _frontindex, pid, tableId, callback)); 
+                                 std::forward_as_tuple(_devicePath, _frontindex, pid, tableId, callback, _sections)); 
 
                 if (entry.first->second.IsValid() == true) {
                     result = Core::ERROR_NONE;
@@ -789,6 +754,8 @@ static constexpr conversion_entry _tableRollOff[] = {
         }
 
     private:
+        static constexpr uint32_t SectionBufferSize = 64 * 1024;
+
         Core::StateTrigger<state> _state;
         int _frontend;
         int _transmission;
@@ -798,12 +765,15 @@ static constexpr conversion_entry _tableRollOff[] = {
         std::map<uint32_t,MuxFilter> _filters;
         string _devicePath;
         uint8_t _frontindex;
+        // All filters are handled by the ResourceMonitor thread, so they can share the buffer to read in.
+        Core::ProxyType<Core::DataStore> _sections;
         TunerAdministrator::ICallback* _callback;
         #ifdef __DEBUG__
         unsigned int _lastState;
         #endif
     };
 
+    /* static */ constexpr uint32_t Tuner::SectionBufferSize;
     /* static */ Tuner::Information Tuner::Information::_instance;
 
     // The following methods will be called before any create is called. It allows for an initialization,
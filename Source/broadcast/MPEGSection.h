@@ -62,7 +62,11 @@ namespace Broadcast {
         public:
             inline bool IsValid() const
             {
-                return ((_section.Size() >= Offset()) && (_section.Size() >= Length()) && (!HasSectionSyntax() || ValidCRC()));
+                return ((IsComplete() == true) && (!HasSectionSyntax() || ValidCRC()));
+            }
+            inline bool IsComplete() const
+            {
+                return ((_section.Size() >= Offset()) && (_section.Size() >= Length()));
             }
             inline uint8_t TableId() const { return (_section[0]); }
             inline bool HasSectionSyntax() const { return ((_section[1] & 0x80) != 0); }
@@ -82,6 +86,11 @@ namespace Broadcast {
             inline bool IsNext() const { return (!IsCurrent()); }
             inline uint8_t SectionNumber() const { return (_section[6]); }
             inline uint8_t LastSectionNumber() const { return (_section[7]); }
+            inline uint32_t CRC() const
+            {
+                // The CRC as transmitted, it is not validated!
+                return (HasSectionSyntax() ? GetNumber<uint32_t>(Length() - 4) : 0);
+            }
             inline uint32_t Hash() const
             {
                 // Extension(16)/TableId(8)/Version(5)/CurNext(1)/SectionIndex(1)
@@ -124,12 +133,26 @@ namespace Broadcast {
             Core::DataElement _section;
         };
 
+        // Rationale:
+        // The sections of a table are repeated over and over again in the carousel, while their content
+        // only changes when the version is bumped. For every section that is part of the table, its
+        // CRC is remembered, so a repetition of a section that is already in the table is recognised
+        // (version/CRC/content) without validating or copying it again. AddSection() only reports a
+        // change if the content of the table really changed, so a table is only (re)parsed when needed.
         class EXTERNAL Table {
         private:
             Table() = delete;
             Table(const Table&) = delete;
             Table& operator=(const Table&) = delete;
 
+            struct Slot {
+                uint8_t Number;
+                uint16_t Length;
+                uint32_t CRC;
+            };
+
+            typedef std::list<Slot> Slots;
+
         public:
             Table(const Core::ProxyType<Core::DataStore>& data)
                 : _extension(NUMBER_MAX_UNSIGNED(uint16_t))
@@ -157,6 +180,7 @@ namespace Broadcast {
             }
             inline uint16_t TableId() const { return (_tableId); }
             inline uint16_t Extension() const { return (_extension); }
+            inline uint8_t Version() const { return (_version); }
             template <typename TYPE>
             TYPE GetNumber(const uint16_t offset) const
             {
@@ -172,77 +196,107 @@ namespace Broadcast {
             }
             inline Core::DataElement& Data() { return (_data); }
             inline const Core::DataElement& Data() const { return (_data); }
+
+            // Returns true if the content of the table changed by adding this section.
             inline bool AddSection(const Section& section)
             {
-                bool addSection = section.IsValid();
-
-                if (addSection == true) {
-                    if (_sections.size() != 0) {
-                        // Starting something for TableId A and then continue with other
-                        // TableId's Seems to me like a programming error.
-                        if (_tableId != section.TableId()) {
-                            TRACE_L1("Will not add a section, destined for: %d in table: %d", section.TableId(), _tableId);
-                        }
+                bool changed = false;
 
-                        addSection = (_tableId == section.TableId());
+                if (IsKnown(section) == false) {
 
-                        if ((addSection == true) && (section.Version() != _version)) {
-                            // Give back all the elemts we do not use..
-                            _sections.clear();
+                    changed = section.IsValid();
+
+                    if (changed == true) {
+                        if (_sections.size() != 0) {
+                            // Starting something for TableId A and then continue with other
+                            // TableId's Seems to me like a programming error.
+                            if (_tableId != section.TableId()) {
+                                TRACE_L1("Will not add a section, destined for: %d in table: %d", section.TableId(), _tableId);
+                            }
+
+                            changed = (_tableId == section.TableId());
+
+                            if ((changed == true) && ((section.Version() != _version) || (section.Extension() != _extension))) {
+                                // Give back all the elemts we do not use..
+                                _sections.clear();
+                                _data.Size(0);
+                                _lastSectionNumber = section.LastSectionNumber();
+                                _version = section.Version();
+                                _extension = section.Extension();
+                            }
+                        } else {
+                            _tableId = section.TableId();
                             _data.Size(0);
                             _lastSectionNumber = section.LastSectionNumber();
                             _version = section.Version();
+                            _extension = section.Extension();
+                        }
 
-                            if (_extension != section.Extension()) {
-                                printf("%s, %d -> Interesting the extensions differ\n",
-                                    __FUNCTION__, __LINE__);
-                            }
+                        if (changed == true) {
+                            Load(section);
                         }
-                    } else {
-                        _tableId = section.TableId();
-                        _data.Size(0);
-                        _lastSectionNumber = section.LastSectionNumber();
-                        _version = section.Version();
-                        _extension = section.Extension();
                     }
+                }
 
-                    if (addSection == true) {
-                        uint32_t offset = 0;
-                        uint32_t slotValue = (section.SectionNumber() << 16) | section.Length();
-
-                        std::list<uint32_t>::iterator index(_sections.begin());
-
-                        while (index != _sections.end()) {
-                            uint16_t thisLength(*index & 0xFFFF);
-                            uint8_t thisSection((*index >> 16) & 0xFF);
-
-                            if (section.SectionNumber() == thisSection) {
-                                // Replace it..
-                                Insert(section.Data(), thisLength, offset);
-                                *index = slotValue;
-                                break;
-                            } else if (section.SectionNumber() < thisSection) {
-                                // We need to extend the last part
-                                Insert(section.Data(), 0, offset);
-                                index = _sections.insert(index, slotValue);
-                                break;
-                            }
-                            offset += thisLength;
-                        }
+                return (changed);
+            }
+
+        private:
+            // Is this exact section already part of this table?
+            inline bool IsKnown(const Section& section) const
+            {
+                bool known = false;
 
-                        if (index == _sections.end()) {
-                            ASSERT(offset == _data.Size());
+                if ((_sections.size() != 0) && (section.IsComplete() == true) && (section.HasSectionSyntax() == true) && (section.TableId() == _tableId) && (section.Extension() == _extension) && (section.Version() == _version)) {
+                    uint32_t offset = 0;
+                    Slots::const_iterator index(_sections.begin());
 
-                            Insert(section.Data(), 0, offset);
-                            _sections.push_back(slotValue);
-                        }
+                    while ((index != _sections.end()) && (index->Number < section.SectionNumber())) {
+                        offset += index->Length;
+                        index++;
+                    }
+
+                    if ((index != _sections.end()) && (index->Number == section.SectionNumber()) && (index->CRC == section.CRC())) {
+                        const Core::DataElement data(section.Data());
+
+                        // Same version and same CRC, the bytes will tell if it is the same section.
+                        known = ((data.Size() == index->Length) && (::memcmp(&(_data[offset]), data.Buffer(), data.Size()) == 0));
                     }
                 }
 
-                return (addSection);
+                return (known);
             }
+            inline void Load(const Section& section)
+            {
+                uint32_t offset = 0;
+                const Core::DataElement data(section.Data());
+                const Slot slot = { section.SectionNumber(), static_cast<uint16_t>(data.Size()), section.CRC() };
+
+                Slots::iterator index(_sections.begin());
+
+                while (index != _sections.end()) {
+                    if (section.SectionNumber() == index->Number) {
+                        // Replace it..
+                        Insert(data, index->Length, offset);
+                        *index = slot;
+                        break;
+                    } else if (section.SectionNumber() < index->Number) {
+                        // We need to extend the last part
+                        Insert(data, 0, offset);
+                        index = _sections.insert(index, slot);
+                        break;
+                    }
+                    offset += index->Length;
+                    index++;
+                }
 
-        private:
+                if (index == _sections.end()) {
+                    ASSERT(offset == _data.Size());
+
+                    Insert(data, 0, offset);
+                    _sections.push_back(slot);
+                }
+            }
             void Insert(const Core::DataElement& data, const uint16_t allocatedLength,
                 const uint16_t offset)
             {
@@ -272,10 +326,69 @@ namespace Broadcast {
             uint8_t _version;
             uint8_t _lastSectionNumber;
             uint8_t _tableId;
-            std::list<uint32_t> _sections;
+            Slots _sections;
             Core::DataElement _data;
         };
 
+        // A carousel of sub tables, like the SDT/NIT other or the EIT, that share the table id(s) but each
+        // have their own extension (service_id, transport_stream_id, ...). Every sub table is assembled
+        // incrementally, on its own.
+        class EXTERNAL Tables {
+        private:
+            Tables(const Tables&) = delete;
+            Tables& operator=(const Tables&) = delete;
+
+            typedef std::map<uint32_t, Table> Entries;
+
+        public:
+            Tables(const uint32_t storageSize = 512)
+                : _storageSize(storageSize)
+                , _tables()
+            {
+            }
+            ~Tables() {}
+
+        public:
+            inline uint32_t Count() const
+            {
+                return (static_cast<uint32_t>(_tables.size()));
+            }
+            inline void Clear()
+            {
+                _tables.clear();
+            }
+
+            // Returns the sub table this section belongs to, if the section completed it or changed
+            // an already complete one. As long as nothing changed, nullptr is returned.
+            inline const Table* AddSection(const Section& section)
+            {
+                const Table* result = nullptr;
+
+                if (section.IsComplete() == true) {
+                    const uint32_t key = (static_cast<uint32_t>(section.TableId()) << 16) | section.Extension();
+
+                    Entries::iterator index(_tables.find(key));
+
+                    if ((index == _tables.end()) && (section.IsValid() == true)) {
+                        index = _tables.emplace(std::piecewise_construct,
+                                           std::forward_as_tuple(key),
+                                           std::forward_as_tuple(Core::ProxyType<Core::DataStore>::Create(_storageSize)))
+                                    .first;
+                    }
+
+                    if ((index != _tables.end()) && (index->second.AddSection(section) == true) && (index->second.IsValid() == true)) {
+                        result = &(index->second);
+                    }
+                }
+
+                return (result);
+            }
+
+        private:
+            const uint32_t _storageSize;
+            Entries _tables;
+        };
+
     } // namespace MPEG
 } // namespace Broadcast
 } // namespace WPEFramework
@@ -76,8 +76,7 @@ namespace Broadcast {
             Parser(Networks& parent, ITuner* source, const bool scan, const uint16_t pid)
                 : _parent(parent)
                 , _source(source)
-                , _actual(Core::ProxyType<Core::DataStore>::Create(512))
-                , _others(Core::ProxyType<Core::DataStore>::Create(512))
+                , _tables(512)
                 , _pid(pid)
             {
                 if (scan == true) {
@@ -116,24 +115,17 @@ namespace Broadcast {
 
                 ASSERT(section.IsValid());
 
-                if (section.TableId() == DVB::NIT::ACTUAL) {
-                    _actual.AddSection(section);
-                    if (_actual.IsValid() == true) {
-                        _parent.Load(DVB::NIT(_actual));
-                    }
-                } else if (section.TableId() == DVB::NIT::OTHER) {
-                    _others.AddSection(section);
-                    if (_others.IsValid() == true) {
-                        _parent.Load(DVB::NIT(_others));
-                    }
+                const MPEG::Table* table = _tables.AddSection(section);
+
+                if (table != nullptr) {
+                    _parent.Load(DVB::NIT(*table));
                 }
             }
 
         private:
             Networks& _parent;
             ITuner* _source;
-            MPEG::Table _actual;
-            MPEG::Table _others;
+            MPEG::Tables _tables;
             uint16_t _pid;
         };
 
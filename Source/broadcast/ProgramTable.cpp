@@ -38,9 +38,8 @@ namespace Broadcast {
 
         if (section.IsValid() == true) {
             if (section.TableId() == MPEG::PAT::ID) {
-                _table.AddSection(section);
-
-                if (_table.IsValid() == true) {
+                // A repetition of a PAT section we already have, changes nothing.
+                if ((_table.AddSection(section) == true) && (_table.IsValid() == true)) {
                     // Iterator over this table and find all program Pids
                     MPEG::PAT patTable(_table);
                     MPEG::PAT::ProgramIterator index(patTable.Programs());
@@ -57,9 +56,7 @@ namespace Broadcast {
                     completedStep = true;
                 }
             } else if (section.TableId() == MPEG::PMT::ID) {
-                _table.AddSection(section);
-
-                if (_table.IsValid() == true) {
+                if ((_table.AddSection(section) == true) && (_table.IsValid() == true)) {
 
                     completedStep = true;
 
@@ -75,8 +75,7 @@ namespace Broadcast {
             Parser(Schedules& parent, ITuner* source, const bool scan)
                 : _parent(parent)
                 , _source(source)
-                , _actual(Core::ProxyType<Core::DataStore>::Create(512))
-                , _others(Core::ProxyType<Core::DataStore>::Create(512))
+                , _tables(512)
             {
                 if (scan == true) {
                     Scan(true);
@@ -114,24 +113,17 @@ namespace Broadcast {
 
                 ASSERT(section.IsValid());
 
-                if (section.TableId() == DVB::EIT::ACTUAL) {
-                    _actual.AddSection(section);
-                    if (_actual.IsValid() == true) {
-                        _parent.Load(DVB::EIT(_actual));
-                    }
-                } else if (section.TableId() == DVB::EIT::OTHER) {
-                    _others.AddSection(section);
-                    if (_others.IsValid() == true) {
-                        _parent.Load(DVB::EIT(_others));
-                    }
+                const MPEG::Table* table = _tables.AddSection(section);
+
+                if (table != nullptr) {
+                    _parent.Load(DVB::EIT(*table));
                 }
             }
 
         private:
             Schedules& _parent;
             ITuner* _source;
-            MPEG::Table _actual;
-            MPEG::Table _others;
+            MPEG::Tables _tables;
         };
 
         typedef std::list<Parser> Scanners;
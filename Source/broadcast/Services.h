@@ -75,8 +75,7 @@ namespace Broadcast {
             Parser(Services& parent, ITuner* source, const bool scan)
                 : _parent(parent)
                 , _source(source)
-                , _actual(Core::ProxyType<Core::DataStore>::Create(512))
-                , _others(Core::ProxyType<Core::DataStore>::Create(512))
+                , _tables(512)
             {
                 if (scan == true) {
                     Scan(true);
@@ -114,24 +113,18 @@ namespace Broadcast {
 
                 ASSERT(section.IsValid());
 
-                if (section.TableId() == DVB::SDT::ACTUAL) {
-                    _actual.AddSection(section);
-                    if (_actual.IsValid() == true) {
-                        _parent.Load(DVB::SDT(_actual));
-                    }
-                } else if (section.TableId() == DVB::SDT::OTHER) {
-                    _others.AddSection(section);
-                    if (_others.IsValid() == true) {
-                        _parent.Load(DVB::SDT(_others));
-                    }
+                // Only if this section changed the (sub)table, it is worth parsing it again.
+                const MPEG::Table* table = _tables.AddSection(section);
+
+                if (table != nullptr) {
+                    _parent.Load(DVB::SDT(*table));
                 }
             }
 
         private:
             Services& _parent;
             ITuner* _source;
-            MPEG::Table _actual;
-            MPEG::Table _others;
+            MPEG::Tables _tables;
         };
 
         typedef std::list<Parser> Scanners;
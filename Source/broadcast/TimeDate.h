@@ -75,6 +75,8 @@ namespace Broadcast {
             Parser(TimeDate& parent, ITuner* source, const bool scan)
                 : _parent(parent)
                 , _source(source)
+                , _tdt(~0)
+                , _tot(~0)
             {
                 if (scan == true) {
                     Scan(true);
@@ -112,16 +114,39 @@ namespace Broadcast {
 
                 ASSERT(section.IsValid());
 
+                // The time has a resolution of seconds, a repeated section changes nothing.
+                const uint64_t stamp = Stamp(section);
+
                 if (section.TableId() == DVB::TDT::ID) {
-                    _parent.Load(DVB::TDT(section));
+                    if (stamp != _tdt) {
+                        _tdt = stamp;
+                        _parent.Load(DVB::TDT(section));
+                    }
                 } else if (section.TableId() == DVB::TOT::ID) {
-                    _parent.Load(DVB::TOT(section));
+                    if (stamp != _tot) {
+                        _tot = stamp;
+                        _parent.Load(DVB::TOT(section));
+                    }
+                }
+            }
+            static uint64_t Stamp(const MPEG::Section& section)
+            {
+                uint64_t result = ~0;
+                const Core::DataElement info(section.Data());
+
+                if (info.Size() >= 5) {
+                    // MJD(16) and BCD coded hours/minutes/seconds (24)
+                    result = (static_cast<uint64_t>(info[0]) << 32) | (static_cast<uint64_t>(info[1]) << 24) | (info[2] << 16) | (info[3] << 8) | info[4];
                 }
+
+                return (result);
             }
 
         private:
             TimeDate& _parent;
             ITuner* _source;
+            uint64_t _tdt;
+            uint64_t _tot;
         };
 
         typedef std::list<Parser> Scanners;
@@ -0,0 +1,318 @@
+/*
+ * If not stated otherwise in this file or this component's LICENSE file the
+ * following copyright and licenses apply:
+ *
+ * Copyright 2020 RDK Management
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Replays a transport stream capture through the replay tuner (BROADCAST_REPLAY) and reports the
+// number of sections per second and the time it takes to handle a section, per kind of table.
+// Usage: BroadcastBenchmark <capture.ts> [rate in kbit/s, 0 (default) is as fast as possible]
+
+#include <broadcast/broadcast.h>
+#include <core/core.h>
+
+#include <cinttypes>
+
+using namespace WPEFramework;
+
+namespace {
+
+    uint64_t Now()
+    {
+        struct timespec now;
+        clock_gettime(CLOCK_MONOTONIC, &now);
+        return ((static_cast<uint64_t>(now.tv_sec) * 1000000000) + now.tv_nsec);
+    }
+
+    // Times the handling of each section by the wrapped ISection.
+    class Measure : public Broadcast::ISection {
+    private:
+        Measure() = delete;
+        Measure(const Measure&) = delete;
+        Measure& operator=(const Measure&) = delete;
+
+    public:
+        Measure(const string& name, Broadcast::ISection* actual)
+            : _name(name)
+            , _actual(actual)
+            , _samples()
+        {
+        }
+        ~Measure() override
+        {
+        }
+
+    public:
+        uint32_t Sections() const
+        {
+            return (static_cast<uint32_t>(_samples.size()));
+        }
+        void Report()
+        {
+            if (_samples.empty() == true) {
+                printf("%-12s: no sections\n", _name.c_str());
+            } else {
+                uint64_t total = 0;
+
+                std::sort(_samples.begin(), _samples.end());
+
+                for (const uint64_t sample : _samples) {
+                    total += sample;
+                }
+
+                printf("%-12s: %8u sections, min %8" PRIu64 " ns, avg %8" PRIu64 " ns, p50 %8" PRIu64 " ns, p99 %8" PRIu64 " ns, max %8" PRIu64 " ns\n",
+                    _name.c_str(),
+                    Sections(),
+                    _samples.front(),
+                    total / _samples.size(),
+                    _samples[((_samples.size() - 1) * 50) / 100],
+                    _samples[((_samples.size() - 1) * 99) / 100],
+                    _samples.back());
+            }
+        }
+
+    private:
+        void Handle(const Broadcast::MPEG::Section& section) override
+        {
+            const uint64_t start = Now();
+
+            _actual->Handle(section);
+
+            _samples.push_back(Now() - start);
+        }
+
+    private:
+        const string _name;
+        Broadcast::ISection* _actual;
+        std::vector<uint64_t> _samples;
+    };
+
+    // Assembles the (sub)tables and walks the ones that changed, like the Services and Networks do.
+    class Parser : public Broadcast::ISection {
+    private:
+        Parser(const Parser&) = delete;
+        Parser& operator=(const Parser&) = delete;
+
+    public:
+        Parser()
+            : _tables(1024)
+            , _parsed(0)
+            , _entries(0)
+        {
+        }
+        ~Parser() override
+        {
+        }
+
+    public:
+        uint32_t Parsed() const
+        {
+            return (_parsed);
+        }
+        uint32_t Entries() const
+        {
+            return (_entries);
+        }
+
+    private:
+        void Handle(const Broadcast::MPEG::Section& section) override
+        {
+            if (section.HasSectionSyntax() == false) {
+                // The TDT/TOT are single sections without a version, there is nothing to assemble.
+                _parsed++;
+            } else {
+                const Broadcast::MPEG::Table* table = _tables.AddSection(section);
+
+                if (table != nullptr) {
+                    _parsed++;
+
+                    if ((table->TableId() == Broadcast::DVB::SDT::ACTUAL) || (table->TableId() == Broadcast::DVB::SDT::OTHER)) {
+                        Broadcast::DVB::SDT::ServiceIterator index(Broadcast::DVB::SDT(*table).Services());
+                        while (index.Next() == true) {
+                            _entries++;
+                        }
+                    } else if ((table->TableId() == Broadcast::DVB::NIT::ACTUAL) || (table->TableId() == Broadcast::DVB::NIT::OTHER)) {
+                        Broadcast::DVB::NIT::NetworkIterator index(Broadcast::DVB::NIT(*table).Networks());
+                        while (index.Next() == true) {
+                            _entries++;
+                        }
+                    }
+                }
+            }
+        }
+
+    private:
+        Broadcast::MPEG::Tables _tables;
+        uint32_t _parsed;
+        uint32_t _entries;
+    };
+
+    // Follows the ProgramTable from the PAT to all the PMTs.
+    class Monitor : public Broadcast::IMonitor {
+    private:
+        Monitor() = delete;
+        Monitor(const Monitor&) = delete;
+        Monitor& operator=(const Monitor&) = delete;
+
+    public:
+        Monitor(Broadcast::ITuner* tuner)
+            : _tuner(tuner)
+            , _pid(~0)
+            , _measure(nullptr)
+        {
+        }
+        ~Monitor() override
+        {
+        }
+
+    public:
+        void Start(Measure* measure)
+        {
+            _measure = measure;
+            _tuner->Filter(0x00, Broadcast::MPEG::PAT::ID, _measure);
+        }
+
+    private:
+        void ChangePid(const uint16_t newpid, Broadcast::ISection*) override
+        {
+            if (_pid != static_cast<uint16_t>(~0)) {
+                _tuner->Filter(_pid, Broadcast::MPEG::PMT::ID, nullptr);
+            } else {
+                _tuner->Filter(0x00, Broadcast::MPEG::PAT::ID, nullptr);
+            }
+
+            _pid = newpid;
+
+            if (_pid != 0xFFFF) {
+                _tuner->Filter(_pid, Broadcast::MPEG::PMT::ID, _measure);
+            }
+        }
+
+    private:
+        Broadcast::ITuner* _tuner;
+        uint16_t _pid;
+        Measure* _measure;
+    };
+
+    class EndOfStream : public Broadcast::ITuner::ICallback {
+    private:
+        EndOfStream() = delete;
+        EndOfStream(const EndOfStream&) = delete;
+        EndOfStream& operator=(const EndOfStream&) = delete;
+
+    public:
+        EndOfStream(Broadcast::ITuner* tuner)
+            : _tuner(tuner)
+            , _event(false, true)
+        {
+        }
+        ~EndOfStream() override
+        {
+        }
+
+    public:
+        void Wait()
+        {
+            _event.Lock(Core::infinite);
+        }
+
+    private:
+        void StateChange() override
+        {
+            if (_tuner->State() == Broadcast::ITuner::IDLE) {
+                _event.SetEvent();
+            }
+        }
+
+    private:
+        Broadcast::ITuner* _tuner;
+        Core::Event _event;
+    };
+}
+
+int main(int argc, const char* argv[])
+{
+    if (argc < 2) {
+        printf("Usage: %s <capture.ts> [rate in kbit/s, 0 is as fast as possible]\n", argv[0]);
+        return (1);
+    }
+
+    const uint32_t rate = (argc > 2 ? atoi(argv[2]) : 0);
+
+    Broadcast::ITuner::Initialize(_T("{ \"rate\": ") + Core::NumberType<uint32_t>(rate).Text() + _T(" }"));
+
+    Broadcast::ITuner* tuner = Broadcast::ITuner::Create(argv[1]);
+
+    if (tuner == nullptr) {
+        printf("Could not open capture: %s\n", argv[1]);
+    } else {
+        // The ProgramTable needs the Id of the stream, the frequency we "tune" to.
+        const uint16_t frequency = 1;
+        Monitor monitor(tuner);
+        Parser sdt, nit, eit, tdt;
+        Measure program(_T("PAT/PMT"), Broadcast::ProgramTable::Instance().Register(&monitor, frequency));
+        Measure sdtMeasure(_T("SDT"), &sdt);
+        Measure nitMeasure(_T("NIT"), &nit);
+        Measure eitMeasure(_T("EIT"), &eit);
+        Measure tdtMeasure(_T("TDT/TOT"), &tdt);
+        EndOfStream end(tuner);
+
+        tuner->Callback(&end);
+
+        tuner->Filter(0x10, Broadcast::DVB::NIT::ACTUAL, &nitMeasure);
+        tuner->Filter(0x10, Broadcast::DVB::NIT::OTHER, &nitMeasure);
+        tuner->Filter(0x11, Broadcast::DVB::SDT::ACTUAL, &sdtMeasure);
+        tuner->Filter(0x11, Broadcast::DVB::SDT::OTHER, &sdtMeasure);
+        for (uint8_t tableId = 0x4E; tableId <= 0x6F; tableId++) {
+            tuner->Filter(0x12, tableId, &eitMeasure);
+        }
+        tuner->Filter(0x14, Broadcast::DVB::TDT::ID, &tdtMeasure);
+        tuner->Filter(0x14, Broadcast::DVB::TOT::ID, &tdtMeasure);
+        monitor.Start(&program);
+
+        const uint64_t start = Now();
+
+        tuner->Tune(frequency, Broadcast::MODULATION_UNKNOWN, 0, Broadcast::FEC_INNER_UNKNOWN, Broadcast::Auto);
+
+        end.Wait();
+
+        const uint64_t elapsed = Now() - start;
+        const uint32_t sections = program.Sections() + sdtMeasure.Sections() + nitMeasure.Sections() + eitMeasure.Sections() + tdtMeasure.Sections();
+
+        printf("Replayed %s in %" PRIu64 " ms: %u sections, %.0f sections/s\n",
+            argv[1], elapsed / 1000000, sections, (sections * 1000000000.0) / elapsed);
+
+        program.Report();
+        sdtMeasure.Report();
+        nitMeasure.Report();
+        eitMeasure.Report();
+        tdtMeasure.Report();
+
+        printf("Tables parsed: SDT %u (%u services), NIT %u (%u networks), EIT %u, TDT/TOT %u\n",
+            sdt.Parsed(), sdt.Entries(), nit.Parsed(), nit.Entries(), eit.Parsed(), tdt.Parsed());
+
+        Broadcast::ProgramTable::Instance().Unregister(&monitor);
+        tuner->Callback(nullptr);
+
+        delete tuner;
+    }
+
+    Broadcast::ITuner::Deinitialize();
+
+    Core::Singleton::Dispose();
+
+    return (0);
+}
@@ -23,17 +23,126 @@
 namespace WPEFramework {
 namespace RPC {
 
+    // Rationale:
+    // Loading all ProxyStub libraries up front costs every process the relocation, the static initialisation
+    // and the memory of hundreds of interfaces it will never use. Instead, the Administrator keeps an index
+    // from interface id to the library that announces it and loads that library the first time the interface
+    // is looked up. The index is built by loading all libraries in the directory once, recording what each
+    // of them announces, and is cached in a file next to the libraries (or in the temporary directory if the
+    // ProxyStub directory is read-only). The cache is only used as long as the set of libraries and their
+    // sizes and modification times did not change, otherwise the directory is scanned again.
+    namespace {
+
+        constexpr uint8_t IndexVersion = 1;
+        constexpr TCHAR IndexFileName[] = _T("proxystubs.index");
+
+        class ProxyStubIndex : public Core::JSON::Container {
+        private:
+            ProxyStubIndex(const ProxyStubIndex&) = delete;
+            ProxyStubIndex& operator=(const ProxyStubIndex&) = delete;
+
+        public:
+            class Entry : public Core::JSON::Container {
+            private:
+                Entry& operator=(const Entry&) = delete;
+
+            public:
+                Entry()
+                    : Core::JSON::Container()
+                    , Name()
+                    , Size(0)
+                    , Modified(0)
+                    , Interfaces()
+                {
+                    Add(_T("name"), &Name);
+                    Add(_T("size"), &Size);
+                    Add(_T("modified"), &Modified);
+                    Add(_T("interfaces"), &Interfaces);
+                }
+                Entry(const Entry& copy)
+                    : Core::JSON::Container()
+                    , Name(copy.Name)
+                    , Size(copy.Size)
+                    , Modified(copy.Modified)
+                    , Interfaces(copy.Interfaces)
+                {
+                    Add(_T("name"), &Name);
+                    Add(_T("size"), &Size);
+                    Add(_T("modified"), &Modified);
+                    Add(_T("interfaces"), &Interfaces);
+                }
+                ~Entry() override
+                {
+                }
+
+            public:
+                Core::JSON::String Name;
+                Core::JSON::DecUInt64 Size;
+                Core::JSON::DecUInt64 Modified;
+                Core::JSON::ArrayType<Core::JSON::HexUInt32> Interfaces;
+            };
+
+        public:
+            ProxyStubIndex()
+                : Core::JSON::Container()
+                , Version(0)
+                , Libraries()
+            {
+                Add(_T("version"), &Version);
+                Add(_T("libraries"), &Libraries);
+            }
+            ~ProxyStubIndex() override
+            {
+            }
+
+        public:
+            Core::JSON::DecUInt8 Version;
+            Core::JSON::ArrayType<Entry> Libraries;
+        };
+
+        // The primary location is the ProxyStub directory itself, the fallback is used if that is read-only.
+        string IndexLocation(const string& pathName, const bool fallback)
+        {
+            string result;
+
+            if (fallback == false) {
+                result = pathName + IndexFileName;
+            } else {
+                string tempPath;
+                string name(pathName);
+
+                if (Core::SystemInfo::GetEnvironment(_T("TMPDIR"), tempPath) == false) {
+                    tempPath = _T("/tmp");
+                }
+
+                std::replace(name.begin(), name.end(), '/', '_');
+
+                result = Core::Directory::Normalize(tempPath) + _T("WPEFramework") + name + IndexFileName;
+            }
+
+            return (result);
+        }
+    }
+
     Administrator::Administrator()
         : _adminLock()
         , _stubs()
         , _proxy()
         , _factory(8)
         , _channelProxyMap()
+        , _channelReferenceMap()
+        , _loaderLock()
+        , _proxyStubPaths()
+        , _index()
+        , _libraries()
     {
     }
 
     /* virtual */ Administrator::~Administrator()
     {
+        // Unloading the libraries recalls their interfaces, do this before the left overs are cleaned up.
+        _libraries.clear();
+
         for (std::pair<uint32_t, IMetadata*> proxy : _proxy) {
             delete proxy.second;
         }
@@ -52,11 +161,10 @@ namespace RPC {
 
     void Administrator::AddRef(Core::ProxyType<Core::IPCChannel>& channel, void* impl, const uint32_t interfaceId)
     {
-        // stub are loaded before any action is taken and destructed if the process closes down, so no need to lock..
-        std::map<uint32_t, ProxyStub::UnknownStub*>::iterator index(_stubs.find(interfaceId));
+        ProxyStub::UnknownStub* stub(Stub(interfaceId));
 
-        if (index != _stubs.end()) {
-            Core::IUnknown* implementation(index->second->Convert(impl));
+        if (stub != nullptr) {
+            Core::IUnknown* implementation(stub->Convert(impl));
 
             ASSERT(implementation != nullptr);
 
@@ -72,11 +180,10 @@ namespace RPC {
 
     void Administrator::Release(Core::ProxyType<Core::IPCChannel>& channel, void* impl, const uint32_t interfaceId)
     {
-        // stub are loaded before any action is taken and destructed if the process closes down, so no need to lock..
-        std::map<uint32_t, ProxyStub::UnknownStub*>::iterator index(_stubs.find(interfaceId));
+        ProxyStub::UnknownStub* stub(Stub(interfaceId));
 
-        if (index != _stubs.end()) {
-            Core::IUnknown* implementation(index->second->Convert(impl));
+        if (stub != nullptr) {
+            Core::IUnknown* implementation(stub->Convert(impl));
 
             ASSERT(implementation != nullptr);
 
@@ -124,18 +231,20 @@ namespace RPC {
 
     void Administrator::Invoke(Core::ProxyType<Core::IPCChannel>& channel, Core::ProxyType<InvokeMessage>& message)
     {
+        const uint64_t start = Core::Metrics::Now();
         uint32_t interfaceId(message->Parameters().InterfaceId());
+        uint32_t methodId(message->Parameters().MethodId());
 
-        // stub are loaded before any action is taken and destructed if the process closes down, so no need to lock..
-        std::map<uint32_t, ProxyStub::UnknownStub*>::iterator index(_stubs.find(interfaceId));
+        ProxyStub::UnknownStub* stub(Stub(interfaceId));
 
-        if (index != _stubs.end()) {
-            uint32_t methodId(message->Parameters().MethodId());
-            index->second->Handle(methodId, channel, message);
+        if (stub != nullptr) {
+            stub->Handle(methodId, channel, message);
         } else {
             // Oops this is an unknown interface, Do not think this could happen.
             TRACE_L1("Unknown interface. %d", interfaceId);
         }
+
+        Core::Metrics::Instance().Find(interfaceId, methodId).Record(Core::Metrics::Now() - start, (stub == nullptr), message->Parameters().Length(), message->Response().Length());
     }
     ProxyStub::UnknownProxy* Administrator::ProxyFind(const Core::ProxyType<Core::IPCChannel>& channel, const instance_id& impl, const uint32_t id, void*& interface)
     {
@@ -171,6 +280,9 @@ namespace RPC {
 
         if (impl) {
 
+            // Resolve the factory up front, it might require loading its library, which is not done under the lock.
+            IMetadata* factory(Factory(id));
+
             _adminLock.Lock();
 
             ChannelMap::iterator index(_channelProxyMap.find(channel.operator->()));
@@ -192,11 +304,9 @@ namespace RPC {
             }
 
             if (result == nullptr) {
-                std::map<uint32_t, IMetadata*>::iterator factory(_proxy.find(id));
+                if (factory != nullptr) {
 
-                if (factory != _proxy.end()) {
-
-                    result = factory->second->CreateProxy(channel, impl, outbound);
+                    result = factory->CreateProxy(channel, impl, outbound);
 
                     ASSERT(result != nullptr);
 
@@ -247,8 +357,219 @@ namespace RPC {
 
     Core::IUnknown* Administrator::Convert(void* rawImplementation, const uint32_t id) 
     {
-        std::map<uint32_t, ProxyStub::UnknownStub*>::const_iterator index (_stubs.find(id));
-        return(index != _stubs.end() ? index->second->Convert(rawImplementation) : nullptr);
+        ProxyStub::UnknownStub* stub(Stub(id));
+        return(stub != nullptr ? stub->Convert(rawImplementation) : nullptr);
+    }
+
+    void Administrator::LoadProxyStubs(const string& proxyStubPath)
+    {
+        const string pathName(Core::Directory::Normalize(proxyStubPath));
+
+        _loaderLock.Lock();
+
+        if (std::find(_proxyStubPaths.begin(), _proxyStubPaths.end(), pathName) == _proxyStubPaths.end()) {
+            LibraryFiles files;
+            Core::Directory index(pathName.c_str(), _T("*.so"));
+
+            _proxyStubPaths.push_back(pathName);
+
+            while (index.Next() == true) {
+                Core::File file(index.Current());
+
+                if ((file.Exists() == true) && (file.IsDirectory() == false)) {
+                    files.emplace(index.Name(), std::pair<uint64_t, uint64_t>(file.Size(), file.ModificationTime().Ticks()));
+                }
+            }
+
+            if (ReadIndex(pathName, files) == false) {
+                ScanIndex(pathName, files);
+            }
+        }
+
+        _loaderLock.Unlock();
+    }
+
+    ProxyStub::UnknownStub* Administrator::Stub(const uint32_t id)
+    {
+        ProxyStub::UnknownStub* result = nullptr;
+        bool loaded = false;
+
+        do {
+            _adminLock.Lock();
+
+            std::map<uint32_t, ProxyStub::UnknownStub*>::const_iterator index(_stubs.find(id));
+
+            if (index != _stubs.end()) {
+                result = index->second;
+            }
+
+            _adminLock.Unlock();
+
+        } while ((result == nullptr) && (loaded == false) && ((loaded = Load(id)) == true));
+
+        return (result);
+    }
+
+    Administrator::IMetadata* Administrator::Factory(const uint32_t id)
+    {
+        IMetadata* result = nullptr;
+        bool loaded = false;
+
+        do {
+            _adminLock.Lock();
+
+            std::map<uint32_t, IMetadata*>::const_iterator index(_proxy.find(id));
+
+            if (index != _proxy.end()) {
+                result = index->second;
+            }
+
+            _adminLock.Unlock();
+
+        } while ((result == nullptr) && (loaded == false) && ((loaded = Load(id)) == true));
+
+        return (result);
+    }
+
+    // Returns true if the library that, according to the index, announces this interface is loaded.
+    bool Administrator::Load(const uint32_t id)
+    {
+        bool result = false;
+
+        _loaderLock.Lock();
+
+        std::map<uint32_t, string>::const_iterator entry(_index.find(id));
+
+        if (entry != _index.end()) {
+            std::map<string, Core::Library>::iterator library(_libraries.find(entry->second));
+
+            if (library == _libraries.end()) {
+                // Remember failures as well, no need to try again on every lookup.
+                library = _libraries.emplace(entry->second, Core::Library(entry->second.c_str())).first;
+
+                TRACE_L1("Loaded ProxyStub library %s for interface 0x%X.", entry->second.c_str(), id);
+            }
+
+            result = library->second.IsLoaded();
+        }
+
+        _loaderLock.Unlock();
+
+        return (result);
+    }
+
+    bool Administrator::ReadIndex(const string& pathName, const LibraryFiles& files)
+    {
+        bool result = false;
+        ProxyStubIndex content;
+
+        for (uint8_t attempt = 0; (attempt < 2) && (result == false); attempt++) {
+            Core::File indexFile(IndexLocation(pathName, (attempt != 0)));
+
+            if ((indexFile.Exists() == true) && (indexFile.Open(true) == true)) {
+
+                if ((content.IElement::FromFile(indexFile) == true) && (content.Version.Value() == IndexVersion) && (content.Libraries.Length() == files.size())) {
+                    Core::JSON::ArrayType<ProxyStubIndex::Entry>::Iterator index(content.Libraries.Elements());
+
+                    result = true;
+
+                    while ((result == true) && (index.Next() == true)) {
+                        LibraryFiles::const_iterator file(files.find(index.Current().Name.Value()));
+
+                        result = (file != files.end()) && (file->second.first == index.Current().Size.Value()) && (file->second.second == index.Current().Modified.Value());
+                    }
+                }
+
+                indexFile.Close();
+            }
+        }
+
+        if (result == true) {
+            Core::JSON::ArrayType<ProxyStubIndex::Entry>::Iterator index(content.Libraries.Elements());
+
+            while (index.Next() == true) {
+                Core::JSON::ArrayType<Core::JSON::HexUInt32>::Iterator loop(index.Current().Interfaces.Elements());
+                const string library(pathName + index.Current().Name.Value());
+
+                while (loop.Next() == true) {
+                    _index.emplace(loop.Current().Value(), library);
+                }
+            }
+        }
+
+        return (result);
+    }
+
+    void Administrator::ScanIndex(const string& pathName, const LibraryFiles& files)
+    {
+        ProxyStubIndex content;
+        bool complete = true;
+
+        content.Version = IndexVersion;
+
+        for (const std::pair<const string, std::pair<uint64_t, uint64_t>>& file : files) {
+            const string location(pathName + file.first);
+
+            if (_libraries.find(location) == _libraries.end()) {
+                std::list<uint32_t> announced;
+
+                // What this library announces is what was added to the administration by loading it.
+                _adminLock.Lock();
+                std::map<uint32_t, ProxyStub::UnknownStub*> before(_stubs);
+                _adminLock.Unlock();
+
+                Core::Library library(location.c_str());
+
+                if (library.IsLoaded() == true) {
+                    _libraries.emplace(location, library);
+
+                    _adminLock.Lock();
+                    for (const std::pair<const uint32_t, ProxyStub::UnknownStub*>& stub : _stubs) {
+                        if (before.find(stub.first) == before.end()) {
+                            announced.push_back(stub.first);
+                        }
+                    }
+                    _adminLock.Unlock();
+                }
+
+                ProxyStubIndex::Entry& entry(content.Libraries.Add());
+
+                entry.Name = file.first;
+                entry.Size = file.second.first;
+                entry.Modified = file.second.second;
+
+                for (const uint32_t id : announced) {
+                    entry.Interfaces.Add() = id;
+                    _index.emplace(id, location);
+                }
+            } else {
+                // Loaded before, through an other path, we can not tell what it announces.
+                complete = false;
+            }
+        }
+
+        if (complete == true) {
+            bool stored = false;
+
+            for (uint8_t attempt = 0; (attempt < 2) && (stored == false); attempt++) {
+                // Write it aside and move it in place, other processes might be reading it at the same time.
+                const string location(IndexLocation(pathName, (attempt != 0)));
+                Core::File indexFile(location + '.' + Core::NumberType<uint32_t>(Core::ProcessInfo().Id()).Text());
+
+                if (indexFile.Create(Core::File::USER_READ | Core::File::USER_WRITE | Core::File::GROUP_READ | Core::File::OTHERS_READ) == true) {
+                    stored = content.IElement::ToFile(indexFile);
+
+                    if ((stored == false) || (indexFile.Move(location) == false)) {
+                        indexFile.Destroy();
+                        stored = false;
+                    }
+                }
+            }
+
+            if (stored == false) {
+                TRACE_L1("Could not store the ProxyStub index for %s.", pathName.c_str());
+            }
+        }
     }
 
     void Administrator::DeleteChannel(const Core::ProxyType<Core::IPCChannel>& channel, std::list<ProxyStub::UnknownProxy*>& pendingProxies)
@@ -49,6 +49,8 @@ namespace RPC {
         typedef std::list<ProxyStub::UnknownProxy*> ProxyList;
         typedef std::map<const Core::IPCChannel*, ProxyList> ChannelMap;
         typedef std::map<const Core::IPCChannel*, std::list< std::pair<uint32_t, Core::IUnknown*> > > ReferenceMap;
+        // Size and modification time (in ticks) of the ProxyStub libraries in a directory, by full path.
+        typedef std::map<string, std::pair<uint64_t, uint64_t>> LibraryFiles;
 
         struct EXTERNAL IMetadata {
             virtual ~IMetadata(){};
@@ -195,7 +197,14 @@ namespace RPC {
             }
         }
         void UnregisterProxy(const ProxyStub::UnknownProxy& proxy);
-        
+
+        // ----------------------------------------------------------------------------------------------------
+        // Methods for the ProxyStub libraries
+        // ----------------------------------------------------------------------------------------------------
+        // Makes the ProxyStubs found in the given directory available to this process. A library is only
+        // loaded once one of its interfaces is used, see the Rationale in the implementation.
+        void LoadProxyStubs(const string& pathName);
+
    private:
         // ----------------------------------------------------------------------------------------------------
         // Methods for the Stub Environment
@@ -203,6 +212,13 @@ namespace RPC {
         Core::IUnknown* Convert(void* rawImplementation, const uint32_t id);
        void RegisterUnknownInterface(Core::ProxyType<Core::IPCChannel>& channel, Core::IUnknown* source, const uint32_t id);
 
+    private:
+        ProxyStub::UnknownStub* Stub(const uint32_t id);
+        IMetadata* Factory(const uint32_t id);
+        bool Load(const uint32_t id);
+        bool ReadIndex(const string& pathName, const LibraryFiles& files);
+        void ScanIndex(const string& pathName, const LibraryFiles& files);
+
     private:
         // Seems like we have enough information, open up the Process communcication Channel.
         Core::CriticalSection _adminLock;
@@ -211,6 +227,13 @@ namespace RPC {
         Core::ProxyPoolType<InvokeMessage> _factory;
         ChannelMap _channelProxyMap;
         ReferenceMap _channelReferenceMap;
+
+        // The ProxyStub libraries are loaded under their own lock, never while holding the _adminLock, as
+        // loading them announces their interfaces.
+        Core::CriticalSection _loaderLock;
+        std::list<string> _proxyStubPaths;
+        std::map<uint32_t, string> _index;
+        std::map<string, Core::Library> _libraries;
     };
 
     class EXTERNAL Job : public Core::IDispatch {
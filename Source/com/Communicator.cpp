@@ -211,29 +211,6 @@ namespace RPC {
 
     /* static */ std::atomic<uint32_t> Communicator::RemoteConnection::_sequenceId(1);
 
-    static void LoadProxyStubs(const string& pathName)
-    {
-        static std::list<Core::Library> processProxyStubs;
-
-        Core::Directory index(pathName.c_str(), _T("*.so"));
-
-        while (index.Next() == true) {
-            // Check if this ProxySTub file is already loaded in this process space..
-            std::list<Core::Library>::const_iterator loop(processProxyStubs.begin());
-            while ((loop != processProxyStubs.end()) && (loop->Name() != index.Current())) {
-                loop++;
-            }
-
-            if (loop == processProxyStubs.end()) {
-                Core::Library library(index.Current().c_str());
-
-                if (library.IsLoaded() == true) {
-                    processProxyStubs.push_back(library);
-                }
-            }
-        }
-    }
-
     /* virtual */ uint32_t Communicator::RemoteConnection::Id() const
     {
         return (_id);
@@ -311,9 +288,10 @@ namespace RPC {
     Communicator::Communicator(const Core::NodeId& node, const string& proxyStubPath)
         : _connectionMap(*this)
         , _ipcServer(node, _connectionMap, proxyStubPath)
+        , _zygotes(nullptr)
     {
         if (proxyStubPath.empty() == false) {
-            RPC::LoadProxyStubs(proxyStubPath);
+            RPC::Administrator::Instance().LoadProxyStubs(proxyStubPath);
         }
         // These are the elements we are expecting to receive over the IPC channels.
         _ipcServer.CreateFactory<AnnounceMessage>(1);
@@ -326,9 +304,10 @@ namespace RPC {
         const Core::ProxyType<Core::IIPCServer>& handler)
         : _connectionMap(*this)
         , _ipcServer(node, _connectionMap, proxyStubPath, handler)
+        , _zygotes(nullptr)
     {
         if (proxyStubPath.empty() == false) {
-            RPC::LoadProxyStubs(proxyStubPath);
+            RPC::Administrator::Instance().LoadProxyStubs(proxyStubPath);
         }
         // These are the elements we are expecting to receive over the IPC channels.
         _ipcServer.CreateFactory<AnnounceMessage>(1);
@@ -344,7 +323,211 @@ namespace RPC {
         _ipcServer.Close(Core::infinite);
 
         // Warn but we need to clos up existing connections..
-        _connectionMap.Destroy();
+        Destroy();
+    }
+
+    void Communicator::Zygotes(const string& hostApplication, const string& proxyStubPath, const uint8_t size)
+    {
+        if (_zygotes != nullptr) {
+            delete _zygotes;
+            _zygotes = nullptr;
+        }
+
+        if (size != 0) {
+            _zygotes = new ZygotePool(hostApplication, proxyStubPath, size);
+
+            TRACE_L1("Started %d of %d zygotes for %s.", _zygotes->Available(), size, hostApplication.c_str());
+        }
+    }
+
+    // ===========================================================================
+    // class ZygotePool
+    // ===========================================================================
+
+    namespace {
+
+        // Time (in ms) between handing out a zygote and starting its replacement.
+        constexpr uint32_t RefillDelay = 500;
+
+#ifndef __WINDOWS__
+        bool Send(const int channel, const void* data, const uint32_t length)
+        {
+            uint32_t sent = 0;
+
+            while (sent < length) {
+                // The zygote might be gone, that should not take us down with a SIGPIPE.
+                ssize_t result = ::send(channel, &(static_cast<const uint8_t*>(data)[sent]), length - sent, MSG_NOSIGNAL);
+
+                if (result > 0) {
+                    sent += static_cast<uint32_t>(result);
+                } else if ((result == 0) || (errno != EINTR)) {
+                    break;
+                }
+            }
+
+            return (sent == length);
+        }
+#endif
+    }
+
+#ifdef __WINDOWS__
+#pragma warning(disable : 4355)
+#endif
+    ZygotePool::ZygotePool(const string& hostApplication, const string& proxyStubPath, const uint8_t size)
+        : _adminLock()
+        , _hostApplication(hostApplication)
+        , _proxyStubPath(proxyStubPath)
+        , _size(size)
+        , _idle()
+        , _refill(*this)
+    {
+        // The first ones are started right away, the plugins activated at startup can use them.
+        Dispatch();
+    }
+#ifdef __WINDOWS__
+#pragma warning(default : 4355)
+#endif
+
+    ZygotePool::~ZygotePool()
+    {
+        _refill.Revoke();
+
+#ifndef __WINDOWS__
+        // A zygote that sees its channel closed, without having received any options, exits.
+        for (const Zygote& zygote : _idle) {
+            ::close(zygote.Channel);
+        }
+#endif
+
+        _idle.clear();
+    }
+
+    uint8_t ZygotePool::Available() const
+    {
+        _adminLock.Lock();
+
+        uint8_t result = static_cast<uint8_t>(_idle.size());
+
+        _adminLock.Unlock();
+
+        return (result);
+    }
+
+    uint32_t ZygotePool::Launch(const Core::Process::Options& options, uint32_t& id)
+    {
+        uint32_t result = Core::ERROR_UNAVAILABLE;
+
+#ifndef __WINDOWS__
+        Core::Process::Options::Iterator index(options.Get());
+        string message;
+        bool available = true;
+
+        // The options as the zygote should parse them, each one terminated by a '\0'.
+        while (index.Next() == true) {
+            message.append(index.Current());
+            message.push_back('\0');
+        }
+
+        const uint32_t length = static_cast<uint32_t>(message.length());
+
+        while ((result != Core::ERROR_NONE) && (available == true)) {
+            Zygote zygote = { 0, -1 };
+
+            _adminLock.Lock();
+
+            available = (_idle.empty() == false);
+
+            if (available == true) {
+                zygote = _idle.front();
+                _idle.pop_front();
+            }
+
+            _adminLock.Unlock();
+
+            if (available == true) {
+                if ((Send(zygote.Channel, &length, sizeof(length)) == true) && (Send(zygote.Channel, message.c_str(), length) == true)) {
+                    id = zygote.Id;
+                    result = Core::ERROR_NONE;
+                } else {
+                    TRACE_L1("Zygote %d is not listening anymore.", zygote.Id);
+                }
+
+                ::close(zygote.Channel);
+            }
+        }
+
+        // Give the process we just handed out a head start, before the replacement competes with it.
+        _refill.Schedule(Core::Time::Now().Add(RefillDelay));
+#else
+        DEBUG_VARIABLE(options);
+        DEBUG_VARIABLE(id);
+#endif
+
+        return (result);
+    }
+
+    void ZygotePool::Dispatch()
+    {
+        uint8_t missing;
+
+        do {
+            Zygote zygote = { 0, -1 };
+
+            _adminLock.Lock();
+
+            missing = (_size - static_cast<uint8_t>(_idle.size()));
+
+            _adminLock.Unlock();
+
+            if (missing != 0) {
+                if (Spawn(zygote) == Core::ERROR_NONE) {
+                    _adminLock.Lock();
+                    _idle.push_back(zygote);
+                    _adminLock.Unlock();
+                } else {
+                    // Do not keep on trying, the next launch will try again.
+                    missing = 0;
+                }
+            }
+
+        } while (missing != 0);
+    }
+
+    uint32_t ZygotePool::Spawn(Zygote& zygote) const
+    {
+        uint32_t result = Core::ERROR_UNAVAILABLE;
+
+#ifndef __WINDOWS__
+        int channel[2];
+
+        if (::socketpair(AF_UNIX, SOCK_STREAM, 0, channel) == 0) {
+            Core::Process::Options options(_hostApplication);
+            Core::Process fork(false);
+
+            // Only the end of the zygote should survive the exec.
+            ::fcntl(channel[0], F_SETFD, FD_CLOEXEC);
+
+            options.Add(_T("-z")).Add(Core::NumberType<int>(channel[1]).Text());
+
+            if (_proxyStubPath.empty() == false) {
+                options.Add(_T("-m")).Add('"' + _proxyStubPath + '"');
+            }
+
+            result = fork.Launch(options, &zygote.Id);
+
+            ::close(channel[1]);
+
+            if (result == Core::ERROR_NONE) {
+                zygote.Channel = channel[0];
+            } else {
+                ::close(channel[0]);
+            }
+        }
+#else
+        DEBUG_VARIABLE(zygote);
+#endif
+
+        return (result);
     }
 
     CommunicatorClient::CommunicatorClient(
@@ -494,8 +677,8 @@ namespace RPC {
 
             string proxyStubPath(announceMessage->Response().ProxyStubPath());
             if (proxyStubPath.empty() == false) {
-                // Also load the ProxyStubs before we do anything else
-                RPC::LoadProxyStubs(proxyStubPath);
+                // Make the ProxyStubs available before we do anything else
+                RPC::Administrator::Instance().LoadProxyStubs(proxyStubPath);
             }
         }
 
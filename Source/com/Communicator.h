@@ -280,6 +280,58 @@ namespace RPC {
         string _proxyStub;
     };
 
+    // Rationale: before an out-of-process plugin can even start its Initialize, the host application has
+    // to be forked and exec'ed, the core, tracing and COM libraries have to be linked in and the ProxyStubs
+    // have to be read. A zygote is a host application that did all of this ahead of time and waits, on a
+    // channel it got from the host, for the arguments of the plugin it is going to run. From there on it
+    // continues as if it was started with these arguments, so the user/group switch, the trace buffer
+    // and the loading of the plugin still happen as before. A zygote taken from the pool is replaced from
+    // the WorkerPool, a little later, so the replacement does not compete with the plugin that is starting.
+    // Zygotes inherit the environment as it was when they were started.
+    class EXTERNAL ZygotePool {
+    private:
+        struct Zygote {
+            uint32_t Id;
+            int Channel;
+        };
+
+    public:
+        ZygotePool() = delete;
+        ZygotePool(const ZygotePool&) = delete;
+        ZygotePool& operator=(const ZygotePool&) = delete;
+
+        ZygotePool(const string& hostApplication, const string& proxyStubPath, const uint8_t size);
+        ~ZygotePool();
+
+    public:
+        inline const string& HostApplication() const
+        {
+            return (_hostApplication);
+        }
+        inline uint8_t Size() const
+        {
+            return (_size);
+        }
+        uint8_t Available() const;
+
+        // Hands the options over to a waiting zygote. Returns ERROR_UNAVAILABLE if none is waiting.
+        uint32_t Launch(const Core::Process::Options& options, uint32_t& id);
+
+        // Refills the pool, runs on the WorkerPool.
+        void Dispatch();
+
+    private:
+        uint32_t Spawn(Zygote& zygote) const;
+
+    private:
+        mutable Core::CriticalSection _adminLock;
+        const string _hostApplication;
+        const string _proxyStubPath;
+        const uint8_t _size;
+        std::list<Zygote> _idle;
+        Core::IWorkerPool::JobType<ZygotePool&> _refill;
+    };
+
     class EXTERNAL Process {
     public:
         Process() = delete;
@@ -340,15 +392,24 @@ namespace RPC {
         {
             return (_options.Get());
         }
-        uint32_t Launch(uint32_t& id)
+        uint32_t Launch(uint32_t& id, ZygotePool* zygotes = nullptr)
         {
+            uint32_t result = Core::ERROR_UNAVAILABLE;
             uint32_t loggingSettings = (Logging::LoggingType<Logging::Startup>::IsEnabled() ? 0x01 : 0) | (Logging::LoggingType<Logging::Shutdown>::IsEnabled() ? 0x02 : 0) | (Logging::LoggingType<Logging::Notification>::IsEnabled() ? 0x04 : 0);
-            _options.Add(_T("-e")).Add(Core::NumberType<uint32_t>(loggingSettings).Text());
+            Core::Process::Options options(_options);
 
-            // Start the external process launch..
-            Core::Process fork(false);
+            options.Add(_T("-e")).Add(Core::NumberType<uint32_t>(loggingSettings).Text());
 
-            uint32_t result = fork.Launch(_options, &id);
+            if ((zygotes != nullptr) && (zygotes->HostApplication() == options.Command())) {
+                result = zygotes->Launch(options, id);
+            }
+
+            if (result != Core::ERROR_NONE) {
+                // Start the external process launch..
+                Core::Process fork(false);
+
+                result = fork.Launch(options, &id);
+            }
 
             if ((result == Core::ERROR_NONE) && (_priority != 0)) {
                 Core::ProcessInfo newProcess(id);
@@ -491,10 +552,11 @@ namespace RPC {
 
             LocalRemoteProcess(const LocalRemoteProcess&) = delete;
             LocalRemoteProcess& operator=(const LocalRemoteProcess&) = delete;
-            LocalRemoteProcess(const Config& config, const Object& instance)
+            LocalRemoteProcess(const Config& config, const Object& instance, ZygotePool* zygotes)
                 : _callsign(instance.Callsign())
                 , _id(0)
                 , _process(RemoteConnection::Id(), config, instance)
+                , _zygotes(zygotes)
             {
             }
             ~LocalRemoteProcess() = default;
@@ -506,7 +568,7 @@ namespace RPC {
             }
             uint32_t Launch() override
             {
-                return (_process.Launch(_id));
+                return (_process.Launch(_id, _zygotes));
             }
             const string& Command() const
             {
@@ -530,6 +592,7 @@ namespace RPC {
             string _callsign;
             uint32_t _id;
             Process _process;
+            ZygotePool* _zygotes;
         };
 #ifdef PROCESSCONTAINERS_ENABLED
 
@@ -655,7 +718,7 @@ namespace RPC {
             RemoteConnection* result = nullptr;
 
             if (instance.Type() == Object::HostType::LOCAL) {
-                result = Core::Service<LocalRemoteProcess>::Create<RemoteConnection>(config, instance);
+                result = Core::Service<LocalRemoteProcess>::Create<RemoteConnection>(config, instance, _zygotes);
             }
             else if (instance.Type() == Object::HostType::CONTAINER) {
 #ifdef PROCESSCONTAINERS_ENABLED
@@ -1269,9 +1332,14 @@ namespace RPC {
         }
         void Destroy()
         {
+            Zygotes(string(), string(), 0);
+
             _connectionMap.Destroy();
         }
 
+        // Keeps size host applications started ahead of time, for the out-of-process plugins to run in.
+        void Zygotes(const string& hostApplication, const string& proxyStubPath, const uint8_t size);
+
     private:
         void Closed(const Core::ProxyType<Core::IPCChannel>& channel)
         {
@@ -1306,6 +1374,7 @@ namespace RPC {
     private:
         RemoteConnectionMap _connectionMap;
         ChannelServer _ipcServer;
+        ZygotePool* _zygotes;
     };
 
     class EXTERNAL CommunicatorClient : public Core::IPCChannelClientType<Core::Void, false, true>, public Core::IDispatchType<Core::IIPC> {
@@ -0,0 +1,195 @@
+/*
+ * If not stated otherwise in this file or this component's LICENSE file the
+ * following copyright and licenses apply:
+ *
+ * Copyright 2020 RDK Management
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "CRC32.h"
+
+#if (defined(__x86_64__) || defined(__i386__)) && defined(__GNUC__)
+#define CRC32_PCLMUL 1
+#include <immintrin.h>
+#endif
+
+namespace WPEFramework {
+namespace Core {
+
+    namespace {
+
+        constexpr uint32_t Polynomial = 0x04C11DB7;
+
+        typedef uint32_t Table[8][256];
+        typedef uint32_t (*Implementation)(const Table& table, uint32_t crc, const uint8_t data[], uint32_t length);
+
+        // Slicing-by-8: table[n][i] holds the CRC of byte i followed by n zero bytes, so 8 bytes are
+        // processed with 8 independent lookups.
+        uint32_t Slicing(const Table& table, uint32_t crc, const uint8_t data[], uint32_t length)
+        {
+            while (length >= 8) {
+                const uint32_t first = crc ^ ((data[0] << 24) | (data[1] << 16) | (data[2] << 8) | data[3]);
+                const uint32_t second = ((data[4] << 24) | (data[5] << 16) | (data[6] << 8) | data[7]);
+
+                crc = table[7][first >> 24] ^ table[6][(first >> 16) & 0xFF] ^ table[5][(first >> 8) & 0xFF] ^ table[4][first & 0xFF] ^ table[3][second >> 24] ^ table[2][(second >> 16) & 0xFF] ^ table[1][(second >> 8) & 0xFF] ^ table[0][second & 0xFF];
+
+                data += 8;
+                length -= 8;
+            }
+
+            while (length-- != 0) {
+                crc = (crc << 8) ^ table[0][((crc >> 24) ^ *data++) & 0xFF];
+            }
+
+            return (crc);
+        }
+
+#ifdef CRC32_PCLMUL
+        // Folding with carry-less multiplication, see "Fast CRC Computation for Generic Polynomials Using
+        // PCLMULQDQ Instruction" (Intel). The data is loaded byte swapped, so bit n of a register is the
+        // coefficient of x^n. A 128 bits remainder R, followed by a block B at distance n bits, is folded as
+        // R.high * (x^(n+64) mod P) + R.low * (x^n mod P) + B. The last remainder is reduced by the tables.
+        __attribute__((target("pclmul,ssse3"))) inline __m128i Fold(const __m128i remainder, const __m128i constants)
+        {
+            return (_mm_xor_si128(_mm_clmulepi64_si128(remainder, constants, 0x11), _mm_clmulepi64_si128(remainder, constants, 0x00)));
+        }
+
+        __attribute__((target("pclmul,ssse3"))) uint32_t CarryLess(const Table& table, uint32_t crc, const uint8_t data[], uint32_t length)
+        {
+            if (length >= 64) {
+                const __m128i swap = _mm_setr_epi8(15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0);
+                const __m128i fold128 = _mm_set_epi64x(0xC5B9CD4C /* x^192 mod P */, 0xE8A45605 /* x^128 mod P */);
+                const __m128i fold512 = _mm_set_epi64x(0x8833794C /* x^576 mod P */, 0xE6228B11 /* x^512 mod P */);
+
+                // The running CRC is aligned with the first 32 bits of the data.
+                __m128i x0 = _mm_xor_si128(_mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(data)), swap), _mm_set_epi32(crc, 0, 0, 0));
+
+                if (length >= 128) {
+                    // Four independent lanes, to hide the latency of the multiplications.
+                    __m128i x1 = _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(data + 16)), swap);
+                    __m128i x2 = _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(data + 32)), swap);
+                    __m128i x3 = _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(data + 48)), swap);
+
+                    data += 64;
+                    length -= 64;
+
+                    while (length >= 64) {
+                        x0 = _mm_xor_si128(Fold(x0, fold512), _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(data)), swap));
+                        x1 = _mm_xor_si128(Fold(x1, fold512), _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(data + 16)), swap));
+                        x2 = _mm_xor_si128(Fold(x2, fold512), _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(data + 32)), swap));
+                        x3 = _mm_xor_si128(Fold(x3, fold512), _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(data + 48)), swap));
+
+                        data += 64;
+                        length -= 64;
+                    }
+
+                    x0 = _mm_xor_si128(Fold(x0, fold128), x1);
+                    x0 = _mm_xor_si128(Fold(x0, fold128), x2);
+                    x0 = _mm_xor_si128(Fold(x0, fold128), x3);
+                } else {
+                    data += 16;
+                    length -= 16;
+                }
+
+                while (length >= 16) {
+                    x0 = _mm_xor_si128(Fold(x0, fold128), _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(data)), swap));
+
+                    data += 16;
+                    length -= 16;
+                }
+
+                // The CRC of the remainder (with a zero start value) is the CRC of all data folded so far.
+                uint8_t remainder[16];
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(remainder), _mm_shuffle_epi8(x0, swap));
+                crc = Slicing(table, 0, remainder, sizeof(remainder));
+            }
+
+            return (Slicing(table, crc, data, length));
+        }
+#endif
+
+        class CRCEngine {
+        private:
+            CRCEngine(const CRCEngine&) = delete;
+            CRCEngine& operator=(const CRCEngine&) = delete;
+
+            CRCEngine()
+                : _implementation(Slicing)
+                , _name(_T("slicing-by-8"))
+            {
+                for (uint32_t index = 0; index < 256; index++) {
+                    uint32_t crc = (index << 24);
+
+                    for (uint8_t bit = 0; bit < 8; bit++) {
+                        crc = ((crc & 0x80000000) != 0 ? (crc << 1) ^ Polynomial : (crc << 1));
+                    }
+
+                    _table[0][index] = crc;
+                }
+
+                for (uint32_t index = 0; index < 256; index++) {
+                    for (uint8_t slice = 1; slice < 8; slice++) {
+                        const uint32_t previous = _table[slice - 1][index];
+
+                        _table[slice][index] = (previous << 8) ^ _table[0][previous >> 24];
+                    }
+                }
+
+#ifdef CRC32_PCLMUL
+                if ((__builtin_cpu_supports("pclmul") != 0) && (__builtin_cpu_supports("ssse3") != 0)) {
+                    _implementation = CarryLess;
+                    _name = _T("pclmul");
+                }
+#endif
+            }
+
+        public:
+            static const CRCEngine& Instance()
+            {
+                static CRCEngine singleton;
+
+                return (singleton);
+            }
+            ~CRCEngine()
+            {
+            }
+
+        public:
+            inline uint32_t Calculate(const uint32_t crc, const uint8_t data[], const uint32_t length) const
+            {
+                return (_implementation(_table, crc, data, length));
+            }
+            inline const TCHAR* Name() const
+            {
+                return (_name);
+            }
+
+        private:
+            Table _table;
+            Implementation _implementation;
+            const TCHAR* _name;
+        };
+    }
+
+    /* static */ uint32_t CRC32::Calculate(const uint32_t crc, const uint8_t data[], const uint32_t length)
+    {
+        return (CRCEngine::Instance().Calculate(crc, data, length));
+    }
+
+    /* static */ const TCHAR* CRC32::Engine()
+    {
+        return (CRCEngine::Instance().Name());
+    }
+}
+} // namespace WPEFramework::Core
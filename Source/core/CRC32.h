@@ -0,0 +1,78 @@
+/*
+ * If not stated otherwise in this file or this component's LICENSE file the
+ * following copyright and licenses apply:
+ *
+ * Copyright 2020 RDK Management
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "Module.h"
+#include "Portability.h"
+
+namespace WPEFramework {
+namespace Core {
+
+    // Rationale:
+    // CRC-32 as used by MPEG-2 (and DVB) sections: polynomial 0x04C11DB7, processed MSB first, initial
+    // value 0xFFFFFFFF and no final XOR. The calculation is done by the fastest engine available on the
+    // running CPU (carry-less multiplication folding if supported, slicing-by-8 otherwise). The engine
+    // is selected once, at first use.
+    // The CRC can be calculated incrementally, feeding the data in parts, through Input().
+    class EXTERNAL CRC32 {
+    private:
+        CRC32(const CRC32&) = delete;
+        CRC32& operator=(const CRC32&) = delete;
+
+    public:
+        static constexpr uint32_t InitialValue = 0xFFFFFFFF;
+
+        inline CRC32()
+            : _crc(InitialValue)
+        {
+        }
+        inline CRC32(const uint8_t data[], const uint32_t length)
+            : _crc(Calculate(InitialValue, data, length))
+        {
+        }
+        inline ~CRC32()
+        {
+        }
+
+    public:
+        inline void Reset()
+        {
+            _crc = InitialValue;
+        }
+        inline void Input(const uint8_t data[], const uint32_t length)
+        {
+            _crc = Calculate(_crc, data, length);
+        }
+        inline uint32_t Result() const
+        {
+            return (_crc);
+        }
+
+        // Continue a CRC calculation, started with InitialValue, over the next length bytes.
+        static uint32_t Calculate(const uint32_t crc, const uint8_t data[], const uint32_t length);
+
+        // Name of the engine doing the calculations, for logging/benchmarking purposes.
+        static const TCHAR* Engine();
+
+    private:
+        uint32_t _crc;
+    };
+}
+} // namespace WPEFramework::Core
@@ -49,8 +49,8 @@ namespace Core {
             ASSERT (_buffer.IsValid() == true);
 
 #ifndef __WINDOWS__
-            _administration->_signal = PTHREAD_COND_INITIALIZER;
-            _administration->_mutex = PTHREAD_MUTEX_INITIALIZER;
+            _administration->_mutex.Initialize();
+            _administration->_signal.Initialize();
 #endif
 
             std::atomic_init(&(_administration->_head), static_cast<uint32_t>(0));
@@ -100,7 +100,8 @@ namespace Core {
     void CyclicBuffer::AdminLock()
     {
 #ifdef __POSIX__
-        pthread_mutex_lock(&(_administration->_mutex));
+        // If the previous owner died while holding it, the lock is taken over (and reported) by the SharedMutex.
+        _administration->_mutex.Lock(Core::infinite);
 #else
 #ifdef __DEBUG__
         if (::WaitForSingleObjectEx(_mutex, 2000, FALSE) != WAIT_OBJECT_0) {
@@ -114,33 +115,17 @@ namespace Core {
     }
 
     // This is in MS...
-    uint32_t CyclicBuffer::SignalLock(const uint32_t waitTime)
+    uint32_t CyclicBuffer::SignalLock(const uint32_t sequence VARIABLE_IS_NOT_USED, const uint32_t waitTime)
     {
 
         uint32_t result = waitTime;
 
         if (waitTime != Core::infinite) {
 #ifdef __POSIX__
-            struct timespec structTime;
+            result = _administration->_signal.Wait(sequence, waitTime);
 
-            clock_gettime(CLOCK_REALTIME, &structTime);
-
-            structTime.tv_nsec += ((waitTime % 1000) * 1000 * 1000); /* remainder, milliseconds to nanoseconds */
-            structTime.tv_sec += (waitTime / 1000); // + (structTime.tv_nsec / 1000000000); /* milliseconds to seconds */
-            structTime.tv_nsec = structTime.tv_nsec % 1000000000;
-
-            if (pthread_cond_timedwait(&(_administration->_signal), &(_administration->_mutex), &structTime) != 0) {
-                struct timespec nowTime;
-
-                clock_gettime(CLOCK_REALTIME, &nowTime);
-                if (nowTime.tv_nsec > structTime.tv_nsec) {
-
-                    result = (nowTime.tv_sec - structTime.tv_sec) * 1000 + ((nowTime.tv_nsec - structTime.tv_nsec) / 1000000);
-                } else {
-
-                    result = (nowTime.tv_sec - structTime.tv_sec - 1) * 1000 + ((1000000000 - (structTime.tv_nsec - nowTime.tv_nsec)) / 1000000);
-                }
-                TRACE_L1("End wait. %d\n", result);
+            if (result == 0) {
+                TRACE_L1("End wait. %d\n", waitTime);
             }
 #else
             if (::WaitForSingleObjectEx(_signal, waitTime, FALSE) == WAIT_OBJECT_0) {
@@ -154,7 +139,7 @@ namespace Core {
             ASSERT(result <= waitTime);
         } else {
 #ifdef __POSIX__
-            pthread_cond_wait(&(_administration->_signal), &(_administration->_mutex));
+            _administration->_signal.Wait(sequence, Core::infinite);
 #else
             ::WaitForSingleObjectEx(_signal, INFINITE, FALSE);
 #endif
@@ -165,7 +150,7 @@ namespace Core {
     void CyclicBuffer::AdminUnlock()
     {
 #ifdef __POSIX__
-        pthread_mutex_unlock(&(_administration->_mutex));
+        _administration->_mutex.Unlock();
 #else
         ReleaseSemaphore(_mutex, 1, nullptr);
 #endif
@@ -181,9 +166,7 @@ namespace Core {
         if (_administration->_agents.load() > 0) {
 
 #ifdef __POSIX__
-            for (int index = _administration->_agents.load(); index != 0; index--) {
-                pthread_cond_signal(&(_administration->_signal));
-            }
+            _administration->_signal.Signal();
 #else
             ReleaseSemaphore(_signal, _administration->_agents.load(), nullptr);
 #endif
@@ -422,11 +405,18 @@ namespace Core {
                 result = Core::ERROR_NONE;
             } else if (timeLeft > 0) {
 
+#ifdef __POSIX__
+                // Take the snapshot while we still hold the administration lock, no signal can get lost.
+                const uint32_t sequence = _administration->_signal.Sequence();
+#else
+                const uint32_t sequence = 0;
+#endif
+
                 _administration->_agents++;
 
                 AdminUnlock();
 
-                timeLeft = SignalLock(timeLeft);
+                timeLeft = SignalLock(sequence, timeLeft);
 
                 _administration->_agents--;
 
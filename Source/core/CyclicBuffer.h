@@ -25,10 +25,7 @@
 // ---- Include local include files ----
 #include "DataElementFile.h"
 #include "Module.h"
-
-#ifndef __WINDOWS__
-#include <semaphore.h>
-#endif
+#include "SharedSync.h"
 
 // ---- Referenced classes and types ----
 
@@ -248,7 +245,7 @@ namespace Core {
         void AdminLock();
         void AdminUnlock();
         void Reevaluate();
-        uint32_t SignalLock(const uint32_t waitTime);
+        uint32_t SignalLock(const uint32_t sequence, const uint32_t waitTime);
 
     private:
         enum state {
@@ -273,9 +270,8 @@ namespace Core {
         // Shared data over the processes...
         struct control {
 #ifndef __WINDOWS__
-            pthread_mutex_t _mutex;
-            pthread_cond_t _signal;
-
+            SharedMutex _mutex;
+            SharedSignal _signal;
 #endif
 
             std::atomic<uint32_t> _head;
@@ -64,6 +64,196 @@ namespace Core { template<> EXTERNAL const typename Core::EnumerateConversion<EN
         uint32_t length;
     };
 
+    // Rationale:
+    // The conversion tables are written as plain arrays in the translation unit owning the enum, so they can
+    // not be indexed at compile time, and looking a name up by walking the table, comparing every name, is
+    // what the HTTP headers and JSON enums did for every keyword and value they read. The index is built
+    // once, on the first conversion, from that same table: an open addressed hash on the (ASCII case folded)
+    // names and, when the values are close enough together, an array from value to entry. Entries are added
+    // in table order, so a name or value that is in the table more than once still resolves to its first
+    // entry, as the walk did. The index is never released, conversions may still be done from destructors
+    // of statics (traces) after it would have been destructed.
+    template <typename ENUMERATE>
+    class EnumerateIndex {
+    private:
+        static constexpr uint32_t DenseRange = 1024;
+        static constexpr uint16_t Free = 0;
+
+        struct Slot {
+            uint32_t hash;
+            uint32_t length;
+            uint16_t entry;
+        };
+
+    public:
+        EnumerateIndex() = delete;
+        EnumerateIndex(const EnumerateIndex<ENUMERATE>&) = delete;
+        EnumerateIndex<ENUMERATE>& operator=(const EnumerateIndex<ENUMERATE>&) = delete;
+
+        explicit EnumerateIndex(const EnumerateConversion<ENUMERATE> table[])
+            : _table(table)
+            , _slots(nullptr)
+            , _mask(0)
+            , _values(nullptr)
+            , _lowest(0)
+            , _range(0)
+        {
+            uint16_t count = 0;
+            uint32_t highest = 0;
+
+            if (table != nullptr) {
+                _lowest = ~0;
+                while (table[count].name != nullptr) {
+                    const uint32_t value = static_cast<uint32_t>(table[count].value);
+                    _lowest = std::min(_lowest, value);
+                    highest = std::max(highest, value);
+                    count++;
+                }
+            }
+
+            if (count > 0) {
+                uint32_t size = 4;
+
+                while (size < (2 * static_cast<uint32_t>(count))) {
+                    size <<= 1;
+                }
+
+                _mask = size - 1;
+                _slots = new Slot[size];
+
+                for (uint32_t index = 0; index < size; index++) {
+                    _slots[index].entry = Free;
+                }
+
+                for (uint16_t index = 0; index < count; index++) {
+                    Add(index);
+                }
+
+                if (((highest - _lowest) < DenseRange) || ((highest - _lowest) < (4 * static_cast<uint32_t>(count)))) {
+                    _range = (highest - _lowest) + 1;
+                    _values = new uint16_t[_range];
+
+                    for (uint32_t index = 0; index < _range; index++) {
+                        _values[index] = Free;
+                    }
+                    for (uint16_t index = count; index > 0; index--) {
+                        _values[static_cast<uint32_t>(table[index - 1].value) - _lowest] = index;
+                    }
+                }
+            }
+        }
+
+    public:
+        template <bool CASESENSITIVE>
+        const EnumerateConversion<ENUMERATE>* Find(const TCHAR text[], const uint32_t length) const
+        {
+            const EnumerateConversion<ENUMERATE>* result = nullptr;
+
+            if (_slots != nullptr) {
+                const uint32_t hash = Hash(text, length);
+                uint32_t slot = hash & _mask;
+
+                while ((result == nullptr) && (_slots[slot].entry != Free)) {
+                    if ((_slots[slot].hash == hash) && (_slots[slot].length == length)) {
+                        const EnumerateConversion<ENUMERATE>& entry = _table[_slots[slot].entry - 1];
+
+                        if (Equal<CASESENSITIVE>(entry.name, text, length) == true) {
+                            result = &entry;
+                        }
+                    }
+                    slot = (slot + 1) & _mask;
+                }
+            }
+
+            return (result);
+        }
+        const EnumerateConversion<ENUMERATE>* Find(const ENUMERATE value) const
+        {
+            const EnumerateConversion<ENUMERATE>* result = nullptr;
+
+            if (_values != nullptr) {
+                const uint32_t offset = static_cast<uint32_t>(value) - _lowest;
+
+                if ((offset < _range) && (_values[offset] != Free)) {
+                    result = &(_table[_values[offset] - 1]);
+                }
+            } else if (_table != nullptr) {
+                const EnumerateConversion<ENUMERATE>* runner = _table;
+
+                while ((runner->name != nullptr) && (runner->value != value)) {
+                    runner++;
+                }
+
+                result = (runner->name != nullptr ? runner : nullptr);
+            }
+
+            return (result);
+        }
+
+    private:
+        static inline TCHAR Fold(const TCHAR character)
+        {
+            return (((character >= 'A') && (character <= 'Z')) ? static_cast<TCHAR>(character + ('a' - 'A')) : character);
+        }
+        static uint32_t Hash(const TCHAR text[], const uint32_t length)
+        {
+            // FNV-1a over the length and the first, middle and last (folded) character: the same hash for
+            // any case, and no need to go over the whole text twice, the names in a table hardly ever share
+            // all of these and the hash is checked with a full compare anyway.
+            uint32_t result = (2166136261u ^ length) * 16777619u;
+
+            if (length > 0) {
+                result = (result ^ static_cast<uint32_t>(Fold(text[0]))) * 16777619u;
+                result = (result ^ static_cast<uint32_t>(Fold(text[length >> 1]))) * 16777619u;
+                result = (result ^ static_cast<uint32_t>(Fold(text[length - 1]))) * 16777619u;
+            }
+
+            return (result);
+        }
+        template <bool CASESENSITIVE>
+        static bool Equal(const TCHAR lhs[], const TCHAR rhs[], const uint32_t length)
+        {
+            bool result;
+
+            if (CASESENSITIVE == true) {
+                result = (::memcmp(lhs, rhs, length * sizeof(TCHAR)) == 0);
+            } else {
+                uint32_t index = 0;
+
+                while ((index < length) && (Fold(lhs[index]) == Fold(rhs[index]))) {
+                    index++;
+                }
+
+                result = (index == length);
+            }
+
+            return (result);
+        }
+        void Add(const uint16_t index)
+        {
+            // Not all tables have the length right (some take the sizeof a pointer), measure the name.
+            const uint32_t length = static_cast<uint32_t>(_tcslen(_table[index].name));
+            const uint32_t hash = Hash(_table[index].name, length);
+            uint32_t slot = hash & _mask;
+
+            while (_slots[slot].entry != Free) {
+                slot = (slot + 1) & _mask;
+            }
+
+            _slots[slot].hash = hash;
+            _slots[slot].length = length;
+            _slots[slot].entry = index + 1;
+        }
+
+    private:
+        const EnumerateConversion<ENUMERATE>* _table;
+        Slot* _slots;
+        uint32_t _mask;
+        uint16_t* _values;
+        uint32_t _lowest;
+        uint32_t _range;
+    };
+
     template <typename ENUMERATE>
     class EnumerateType {
     private:
@@ -240,51 +430,28 @@ namespace Core { template<> EXTERNAL const typename Core::EnumerateConversion<EN
         // Attach a table to this global parameter to get string conversions
         static const EnumerateConversion<ENUMERATE>* Table(const uint16_t index);
 
-        template <bool CASESENSITIVE>
-        const EnumerateConversion<ENUMERATE>* Find(const Core::TextFragment& value) const
+        static const EnumerateIndex<ENUMERATE>& Index()
         {
-            const struct EnumerateConversion<ENUMERATE>* runner = Table(0);
+            static const EnumerateIndex<ENUMERATE>& index = *(new EnumerateIndex<ENUMERATE>(Table(0)));
 
-            if (CASESENSITIVE == true) {
-                while ((runner->name != nullptr) && (value != Core::TextFragment(runner->name, 0, runner->length))) {
-                    runner++;
-                }
-            } else {
-                while ((runner->name != nullptr) && (value.EqualText(Core::TextFragment(runner->name, runner->length)) == false)) {
-                    runner++;
-                }
-            }
+            return (index);
+        }
 
-            return ((runner->name != nullptr) ? runner : nullptr);
+        template <bool CASESENSITIVE>
+        const EnumerateConversion<ENUMERATE>* Find(const Core::TextFragment& value) const
+        {
+            return (Index().template Find<CASESENSITIVE>(value.Data(), value.Length()));
         }
 
         template <bool CASESENSITIVE>
         const EnumerateConversion<ENUMERATE>* Find(const TCHAR value[]) const
         {
-            const struct EnumerateConversion<ENUMERATE>* runner = Table(0);
-
-            if (CASESENSITIVE == true) {
-                while ((runner->name != nullptr) && (_tcscmp(runner->name, value) != 0)) {
-                    runner++;
-                }
-            } else {
-                while ((runner->name != nullptr) && (_tcsicmp(runner->name, value) != 0)) {
-                    runner++;
-                }
-            }
-
-            return ((runner->name != nullptr) ? runner : nullptr);
+            return (Index().template Find<CASESENSITIVE>(value, static_cast<uint32_t>(_tcslen(value))));
         }
 
         const EnumerateConversion<ENUMERATE>* Find(const uint32_t value) const
         {
-            const struct EnumerateConversion<ENUMERATE>* runner = Table(0);
-
-            while ((runner->name != nullptr) && (runner->value != static_cast<ENUMERATE>(value))) {
-                runner++;
-            }
-
-            return ((runner->name != nullptr) ? runner : nullptr);
+            return (Index().Find(static_cast<ENUMERATE>(value)));
         }
     };
 }
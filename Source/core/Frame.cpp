@@ -0,0 +1,131 @@
+/*
+ * If not stated otherwise in this file or this component's LICENSE file the
+ * following copyright and licenses apply:
+ *
+ * Copyright 2020 RDK Management
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "Frame.h"
+
+namespace WPEFramework {
+namespace Core {
+
+    constexpr uint32_t FrameStorage::LargestSize;
+    constexpr uint32_t FrameStorage::CacheSize;
+    constexpr uint8_t FrameStorage::Depth;
+
+    namespace {
+
+        constexpr uint8_t SmallestBits = 6;
+        constexpr uint8_t LargestBits = 23;
+        constexpr uint8_t Classes = (LargestBits - SmallestBits + 1);
+
+        static_assert((1u << LargestBits) == FrameStorage::LargestSize, "The largest class should hold FrameStorage::LargestSize");
+
+        // Plain data, so it needs no construction and is still usable once the thread started its cleanup
+        // (the main thread destructs its thread locals before the statics, which may still release frames).
+        struct Cache {
+            uint8_t* Buffers[Classes][FrameStorage::Depth];
+            uint8_t Count[Classes];
+            uint32_t Size;
+            uint8_t State;
+        };
+
+        enum state : uint8_t {
+            UNUSED = 0,
+            ACTIVE = 1,
+            DISPOSED = 2
+        };
+
+        thread_local Cache _cache;
+
+        class Cleanup {
+        public:
+            Cleanup(const Cleanup&) = delete;
+            Cleanup& operator=(const Cleanup&) = delete;
+
+            Cleanup() = default;
+            ~Cleanup()
+            {
+                for (uint8_t index = 0; index < Classes; index++) {
+                    while (_cache.Count[index] != 0) {
+                        _cache.Count[index]--;
+                        ::free(_cache.Buffers[index][_cache.Count[index]]);
+                    }
+                }
+                _cache.Size = 0;
+                _cache.State = DISPOSED;
+            }
+        };
+
+        inline uint8_t Class(const uint32_t size)
+        {
+            return (size <= (1u << SmallestBits) ? 0 : static_cast<uint8_t>((32 - __builtin_clz(size - 1)) - SmallestBits));
+        }
+    }
+
+    /* static */ uint8_t* FrameStorage::Allocate(uint32_t& size)
+    {
+        uint8_t* result = nullptr;
+
+        if (size > LargestSize) {
+            // Too big to be kept, round up to whole pages.
+            size = ((size + 0xFFF) & ~0xFFF);
+        } else {
+            const uint8_t index = Class(size);
+
+            size = (1u << (index + SmallestBits));
+
+            if (_cache.Count[index] != 0) {
+                _cache.Count[index]--;
+                _cache.Size -= size;
+                result = _cache.Buffers[index][_cache.Count[index]];
+            }
+        }
+
+        if (result == nullptr) {
+            result = reinterpret_cast<uint8_t*>(::malloc(size));
+        }
+
+        ASSERT(result != nullptr);
+
+        return (result);
+    }
+
+    /* static */ void FrameStorage::Release(uint8_t buffer[], const uint32_t size)
+    {
+        ASSERT(buffer != nullptr);
+
+        if (_cache.State == UNUSED) {
+            // First use on this thread, have the cache emptied when the thread ends.
+            static thread_local Cleanup cleanup;
+            _cache.State = ACTIVE;
+        }
+
+        const uint8_t index = Class(size);
+
+        if ((_cache.State == ACTIVE) && (size <= LargestSize) && (_cache.Count[index] < Depth) && ((_cache.Size + size) <= CacheSize)) {
+            ASSERT(size == (1u << (index + SmallestBits)));
+
+            _cache.Buffers[index][_cache.Count[index]] = buffer;
+            _cache.Count[index]++;
+            _cache.Size += size;
+        } else {
+            ::free(buffer);
+        }
+    }
+}
+}
@@ -25,6 +25,28 @@
 namespace WPEFramework {
 namespace Core {
 
+    // Storage for the growable frames. Buffers come in power of two sizes and the ones that are given back
+    // are kept, per size, in a small cache of the thread that returns them, so a message that is filled,
+    // sent and released over and over again (the COM-RPC InvokeMessages) does not go to the heap for it.
+    // Rationale: a per thread cache needs no locking, the buffers are plain heap memory so they may be
+    // returned on another thread than the one that took them. The cache is bounded (FrameStorage::Depth
+    // buffers per size, FrameStorage::CacheSize bytes in total), anything beyond that is freed.
+    class EXTERNAL FrameStorage {
+    public:
+        static constexpr uint32_t LargestSize = (8 * 1024 * 1024);
+        static constexpr uint32_t CacheSize = (16 * 1024 * 1024);
+        static constexpr uint8_t Depth = 4;
+
+    public:
+        FrameStorage() = delete;
+        FrameStorage(const FrameStorage&) = delete;
+        FrameStorage& operator=(const FrameStorage&) = delete;
+
+        // Returns a buffer of at least size bytes, size is updated to what is actually available.
+        static uint8_t* Allocate(uint32_t& size);
+        static void Release(uint8_t buffer[], const uint32_t size);
+    };
+
     template <const uint16_t BLOCKSIZE>
     class FrameType {
     private:
@@ -33,16 +55,20 @@ namespace Core {
         private:
             AllocatorType<STARTSIZE> operator=(const AllocatorType<STARTSIZE>&) = delete;
 
+            // Buffers that grew beyond this are given back to the FrameStorage when the frame is cleared,
+            // so long living (pooled) frames do not all keep the memory of the largest message they carried.
+            static constexpr uint32_t RetainSize = (16 * 1024);
+
         public:
             AllocatorType()
                 : _bufferSize(STARTSIZE)
-                , _data(reinterpret_cast<uint8_t*>(::malloc(_bufferSize)))
+                , _data(FrameStorage::Allocate(_bufferSize))
             {
                 static_assert(STARTSIZE != 0, "This method can only be called if you specify an initial blocksize");
             }
             AllocatorType(const AllocatorType<STARTSIZE>& copy)
                 : _bufferSize(copy._bufferSize)
-                , _data(STARTSIZE == 0 ? copy._data : reinterpret_cast<uint8_t*>(::malloc(_bufferSize)))
+                , _data(STARTSIZE == 0 ? copy._data : FrameStorage::Allocate(_bufferSize))
             {
 
                 if (STARTSIZE != 0) {
@@ -58,18 +84,18 @@ namespace Core {
             ~AllocatorType()
             {
                 if ((STARTSIZE != 0) && (_data != nullptr)) {
-                    ::free(_data);
+                    FrameStorage::Release(_data, _bufferSize);
                 }
             }
 
         public:
-            inline uint8_t& operator[](const uint16_t index)
+            inline uint8_t& operator[](const uint32_t index)
             {
                 ASSERT(_data != nullptr);
                 ASSERT(index < _bufferSize);
                 return (_data[index]);
             }
-            inline const uint8_t& operator[](const uint16_t index) const
+            inline const uint8_t& operator[](const uint32_t index) const
             {
                 ASSERT(_data != nullptr);
                 ASSERT(index < _bufferSize);
@@ -79,6 +105,15 @@ namespace Core {
             {
                 RealAllocate<STARTSIZE>(requiredSize, TemplateIntToType<STARTSIZE>());
             }
+            inline void Trim()
+            {
+                if ((STARTSIZE != 0) && (_bufferSize > RetainSize)) {
+                    FrameStorage::Release(_data, _bufferSize);
+
+                    _bufferSize = STARTSIZE;
+                    _data = FrameStorage::Allocate(_bufferSize);
+                }
+            }
 
         private:
             template <const uint16_t NONZEROSIZE>
@@ -86,10 +121,16 @@ namespace Core {
             {
                 if (requiredSize > _bufferSize) {
 
-                    _bufferSize = static_cast<uint16_t>(((requiredSize / (STARTSIZE ? STARTSIZE : 1)) + 1) * STARTSIZE);
+                    // Grow by (at least) doubling, filling a frame piece by piece, as the IPC channel does with
+                    // what it receives, then takes a logarithmic number of copies instead of one per block.
+                    uint32_t size = (_bufferSize > (0xFFFFFFFF >> 1) ? requiredSize : std::max(requiredSize, (_bufferSize << 1)));
+                    uint8_t* data = FrameStorage::Allocate(size);
+
+                    ::memcpy(data, _data, _bufferSize);
+                    FrameStorage::Release(_data, _bufferSize);
 
-                    // oops we need to "reallocate".
-                    _data = reinterpret_cast<uint8_t*>(::realloc(_data, _bufferSize));
+                    _bufferSize = size;
+                    _data = data;
                 }
             }
             inline void RealAllocate(const uint32_t requiredSize, const TemplateIntToType<0>& /* For compile time diffrentiation */)
@@ -98,7 +139,7 @@ namespace Core {
             }
 
         private:
-            uint16_t _bufferSize;
+            uint32_t _bufferSize;
             uint8_t* _data;
         };
 
@@ -116,7 +157,7 @@ namespace Core {
                 , _container(nullptr)
             {
             }
-            Reader(const FrameType& data, const uint16_t offset)
+            Reader(const FrameType& data, const uint32_t offset)
                 : _offset(offset)
                 , _container(&data)
             {
@@ -135,7 +176,7 @@ namespace Core {
             {
                 return ((_container != nullptr) && (_offset < _container->Size()));
             }
-            inline uint16_t Length() const
+            inline uint32_t Length() const
             {
                 return (_container == nullptr ? 0 : _container->Size() - _offset);
             }
@@ -161,7 +202,7 @@ namespace Core {
             template <typename TYPENAME>
             TYPENAME Buffer(const TYPENAME maxLength, uint8_t buffer[]) const
             {
-                uint16_t result;
+                uint32_t result;
 
                 ASSERT(_container != nullptr);
 
@@ -170,7 +211,7 @@ namespace Core {
 
                 return (static_cast<TYPENAME>(result - sizeof(TYPENAME)));
             }
-            void Copy(const uint16_t length, uint8_t buffer[]) const
+            void Copy(const uint32_t length, uint8_t buffer[]) const
             {
                 ASSERT(_container != nullptr);
 
@@ -225,7 +266,7 @@ namespace Core {
 #endif
 
         private:
-            mutable uint16_t _offset;
+            mutable uint32_t _offset;
             const FrameType* _container;
         };
         class Writer {
@@ -239,7 +280,7 @@ namespace Core {
             {
             }
             // TODO: should we make offset 0 by default?
-            Writer(FrameType& data, const uint16_t offset)
+            Writer(FrameType& data, const uint32_t offset)
                 : _offset(offset)
                 , _container(&data)
             {
@@ -254,7 +295,7 @@ namespace Core {
             }
 
         public:
-            inline uint16_t Offset() const
+            inline uint32_t Offset() const
             {
                 return (_offset);
             }
@@ -265,7 +306,7 @@ namespace Core {
 
                 _offset += _container->SetBuffer<TYPENAME>(_offset, length, buffer);
             }
-            void Copy(const uint16_t length, const uint8_t buffer[])
+            void Copy(const uint32_t length, const uint8_t buffer[])
             {
                 ASSERT(_container != nullptr);
 
@@ -298,7 +339,7 @@ namespace Core {
             }
 
         private:
-            uint16_t _offset;
+            uint32_t _offset;
             FrameType* _container;
         };
 
@@ -328,29 +369,30 @@ namespace Core {
         inline void Clear()
         {
             _size = 0;
+            _data.Trim();
         }
         inline uint32_t Size() const
         {
             return (_size);
         }
-        inline uint8_t& operator[](const uint16_t index)
+        inline uint8_t& operator[](const uint32_t index)
         {
             return _data[index];
         }
-        inline const uint8_t& operator[](const uint16_t index) const
+        inline const uint8_t& operator[](const uint32_t index) const
         {
             return _data[index];
         }
-        void Size(uint16_t size)
+        void Size(const uint32_t size)
         {
             _data.Allocate(size);
 
             _size = size;
         }
         template <typename TYPENAME>
-        uint16_t SetBuffer(const uint16_t offset, const TYPENAME& length, const uint8_t buffer[])
+        uint32_t SetBuffer(const uint32_t offset, const TYPENAME& length, const uint8_t buffer[])
         {
-            uint16_t requiredLength(static_cast<uint16_t>(sizeof(TYPENAME) + length));
+            const uint32_t requiredLength(static_cast<uint32_t>(sizeof(TYPENAME) + length));
 
             if ((offset + requiredLength) >= _size) {
                 Size(offset + requiredLength);
@@ -362,7 +404,7 @@ namespace Core {
             return (requiredLength);
         }
 
-        uint16_t Copy(const uint16_t offset, const uint16_t length, uint8_t buffer[]) const
+        uint32_t Copy(const uint32_t offset, const uint32_t length, uint8_t buffer[]) const
         {
             ASSERT(offset + length <= _size);
 
@@ -370,7 +412,7 @@ namespace Core {
 
             return (length);
         }
-        uint16_t Copy(const uint16_t offset, const uint16_t length, const uint8_t buffer[])
+        uint32_t Copy(const uint32_t offset, const uint32_t length, const uint8_t buffer[])
         {
             Size(offset + length);
 
@@ -378,16 +420,16 @@ namespace Core {
 
             return (length);
         }
-        uint16_t SetText(const uint16_t offset, const string& value)
+        uint32_t SetText(const uint32_t offset, const string& value)
         {
             std::string convertedText(Core::ToString(value));
             return (SetBuffer<uint16_t>(offset, static_cast<uint16_t>(convertedText.length()), reinterpret_cast<const uint8_t*>(convertedText.c_str())));
         }
 
-        uint16_t SetNullTerminatedText(const uint16_t offset, const string& value)
+        uint32_t SetNullTerminatedText(const uint32_t offset, const string& value)
         {
             std::string convertedText(Core::ToString(value));
-            uint16_t requiredLength(convertedText.length() + 1);
+            const uint32_t requiredLength(static_cast<uint32_t>(convertedText.length() + 1));
 
             if ((offset + requiredLength) >= _size) {
                 Size(offset + requiredLength);
@@ -399,7 +441,7 @@ namespace Core {
         }
 
         template <typename TYPENAME>
-        uint16_t GetBuffer(const uint16_t offset, const TYPENAME length, uint8_t buffer[]) const
+        uint32_t GetBuffer(const uint32_t offset, const TYPENAME length, uint8_t buffer[]) const
         {
             TYPENAME textLength;
 
@@ -410,15 +452,15 @@ namespace Core {
             ASSERT((textLength + offset + sizeof(TYPENAME)) <= _size);
 
             if ((textLength + offset + sizeof(TYPENAME)) > _size) {
-                textLength = (_size - (offset + static_cast<uint16_t>(sizeof(TYPENAME))));
+                textLength = static_cast<TYPENAME>(_size - (offset + static_cast<uint32_t>(sizeof(TYPENAME))));
             }
 
             memcpy(buffer, &(_data[offset + sizeof(TYPENAME)]), (textLength > length ? length : textLength));
 
-            return (static_cast<uint16_t>(sizeof(TYPENAME) + textLength));
+            return (static_cast<uint32_t>(sizeof(TYPENAME) + textLength));
         }
 
-        uint16_t GetText(const uint16_t offset, string& result) const
+        uint32_t GetText(const uint32_t offset, string& result) const
         {
             uint16_t textLength;
             ASSERT((offset + sizeof(uint16_t)) <= _size);
@@ -438,14 +480,14 @@ namespace Core {
             return (sizeof(uint16_t) + textLength);
         }
 
-        uint16_t GetNullTerminatedText(const uint16_t offset, string& result) const
+        uint32_t GetNullTerminatedText(const uint32_t offset, string& result) const
         {
             const char* text = reinterpret_cast<const char*>(&(_data[offset]));
             result = text;
             return (result.length() + 1);
         }
 
-        uint16_t SetBoolean(const uint16_t offset, const bool value)
+        uint32_t SetBoolean(const uint32_t offset, const bool value)
         {
             if ((offset + 1) >= _size) {
                 Size(offset + 1);
@@ -456,7 +498,7 @@ namespace Core {
             return (1);
         }
 
-        uint16_t GetBoolean(const uint16_t offset, bool& value) const
+        uint32_t GetBoolean(const uint32_t offset, bool& value) const
         {
             ASSERT(offset < _size);
 
@@ -466,13 +508,13 @@ namespace Core {
         }
 
         template <typename TYPENAME>
-        inline uint16_t SetNumber(const uint16_t offset, const TYPENAME number)
+        inline uint32_t SetNumber(const uint32_t offset, const TYPENAME number)
         {
             return (SetNumber(offset, number, TemplateIntToType<sizeof(TYPENAME) == 1>()));
         }
 
         template <typename TYPENAME>
-        inline uint16_t GetNumber(const uint16_t offset, TYPENAME& number) const
+        inline uint32_t GetNumber(const uint32_t offset, TYPENAME& number) const
         {
             return (GetNumber(offset, number, TemplateIntToType<sizeof(TYPENAME) == 1>()));
         }
@@ -482,7 +524,7 @@ namespace Core {
         {
             static const TCHAR character[] = "0123456789ABCDEF";
             string info;
-            uint16_t index = offset;
+            uint32_t index = offset;
 
             while (index < _size) {
                 if (info.empty() == false) {
@@ -498,7 +540,7 @@ namespace Core {
 
     private:
         template <typename TYPENAME>
-        uint16_t SetNumber(const uint16_t offset, const TYPENAME number, const TemplateIntToType<true>&)
+        uint32_t SetNumber(const uint32_t offset, const TYPENAME number, const TemplateIntToType<true>&)
         {
             if ((offset + 1) >= _size) {
                 Size(offset + 1);
@@ -510,7 +552,7 @@ namespace Core {
         }
 
         template <typename TYPENAME>
-        uint16_t SetNumber(const uint16_t offset, const TYPENAME number, const TemplateIntToType<false>&)
+        uint32_t SetNumber(const uint32_t offset, const TYPENAME number, const TemplateIntToType<false>&)
         {
             if ((offset + sizeof(TYPENAME)) >= _size) {
                 Size(offset + sizeof(TYPENAME));
@@ -562,7 +604,7 @@ namespace Core {
         }
 
         template <typename TYPENAME>
-        uint16_t GetNumber(const uint16_t offset, TYPENAME& number, const TemplateIntToType<true>&) const
+        uint32_t GetNumber(const uint32_t offset, TYPENAME& number, const TemplateIntToType<true>&) const
         {
             // Only on package level allowed to pass the boundaries!!!
             ASSERT((offset + sizeof(TYPENAME)) <= _size);
@@ -573,7 +615,7 @@ namespace Core {
         }
 
         template <typename TYPENAME>
-        inline uint16_t GetNumber(const uint16_t offset, TYPENAME& value, const TemplateIntToType<false>&) const
+        inline uint32_t GetNumber(const uint32_t offset, TYPENAME& value, const TemplateIntToType<false>&) const
         {
             TYPENAME result;
 
@@ -629,7 +671,7 @@ namespace Core {
         }
 
     private:
-        mutable uint16_t _size;
+        mutable uint32_t _size;
         AllocatorType<BLOCKSIZE> _data;
     };
 }
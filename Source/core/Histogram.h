@@ -0,0 +1,174 @@
+/*
+ * If not stated otherwise in this file or this component's LICENSE file the
+ * following copyright and licenses apply:
+ *
+ * Copyright 2020 RDK Management
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "Module.h"
+#include "Portability.h"
+
+#include <algorithm>
+#include <atomic>
+
+namespace WPEFramework {
+namespace Core {
+
+    // Rationale:
+    // The MeasurementType keeps a min/max/average, which says little about the tail of a distribution.
+    // This histogram keeps a count per bucket, where the buckets are log-linear (HDR style): every power
+    // of two is split in SubBuckets equally sized buckets. So every recorded value lands in a bucket that
+    // is at most 1/SubBuckets (6.25%) wider than the value itself, for a fixed 2.4KB per histogram.
+    // Recording is lock free, a few relaxed atomic increments, so it can be done from any thread on a hot
+    // path. Reading is not a snapshot: a value recorded during a read may be partially reflected.
+    class Histogram {
+    public:
+        static constexpr uint8_t SubBucketBits = 4;
+        static constexpr uint32_t SubBuckets = (1 << SubBucketBits);
+        // Values from 2^MaxBits on are counted in the last bucket.
+        static constexpr uint8_t MaxBits = 40;
+        static constexpr uint32_t Buckets = (MaxBits - SubBucketBits + 1) * SubBuckets;
+
+    public:
+        Histogram(const Histogram&) = delete;
+        Histogram& operator=(const Histogram&) = delete;
+
+        Histogram()
+        {
+            Reset();
+        }
+        ~Histogram()
+        {
+        }
+
+    public:
+        inline void Record(const uint64_t value)
+        {
+            _buckets[Index(value)].fetch_add(1, std::memory_order_relaxed);
+            _count.fetch_add(1, std::memory_order_relaxed);
+            _sum.fetch_add(value, std::memory_order_relaxed);
+
+            uint64_t current = _min.load(std::memory_order_relaxed);
+            while ((value < current) && (_min.compare_exchange_weak(current, value, std::memory_order_relaxed) == false)) {
+            }
+            current = _max.load(std::memory_order_relaxed);
+            while ((value > current) && (_max.compare_exchange_weak(current, value, std::memory_order_relaxed) == false)) {
+            }
+        }
+        void Reset()
+        {
+            for (std::atomic<uint32_t>& bucket : _buckets) {
+                bucket.store(0, std::memory_order_relaxed);
+            }
+            _count.store(0, std::memory_order_relaxed);
+            _sum.store(0, std::memory_order_relaxed);
+            _min.store(~0, std::memory_order_relaxed);
+            _max.store(0, std::memory_order_relaxed);
+        }
+        inline uint64_t Count() const
+        {
+            return (_count.load(std::memory_order_relaxed));
+        }
+        inline uint64_t Sum() const
+        {
+            return (_sum.load(std::memory_order_relaxed));
+        }
+        inline uint64_t Min() const
+        {
+            uint64_t result = _min.load(std::memory_order_relaxed);
+            return (result == static_cast<uint64_t>(~0) ? 0 : result);
+        }
+        inline uint64_t Max() const
+        {
+            return (_max.load(std::memory_order_relaxed));
+        }
+        inline uint64_t Average() const
+        {
+            uint64_t count = Count();
+            return (count == 0 ? 0 : Sum() / count);
+        }
+        // The highest value of the bucket holding the given percentile (0-100), so the actual value is at
+        // most 1/SubBuckets lower. Never more than the largest value recorded.
+        uint64_t Percentile(const uint8_t percentage) const
+        {
+            uint64_t total = 0;
+            uint64_t result = 0;
+
+            for (const std::atomic<uint32_t>& bucket : _buckets) {
+                total += bucket.load(std::memory_order_relaxed);
+            }
+
+            if (total != 0) {
+                const uint64_t rank = std::max(static_cast<uint64_t>(1), ((total * std::min(percentage, static_cast<uint8_t>(100))) + 99) / 100);
+                uint64_t seen = 0;
+                uint32_t index = 0;
+
+                while ((index < Buckets) && ((seen += _buckets[index].load(std::memory_order_relaxed)) < rank)) {
+                    index++;
+                }
+
+                result = std::min(Highest(std::min(index, Buckets - 1)), Max());
+            }
+
+            return (result);
+        }
+
+        static inline uint32_t Index(const uint64_t value)
+        {
+            uint32_t result;
+
+            if (value < SubBuckets) {
+                result = static_cast<uint32_t>(value);
+            } else if (value >= (static_cast<uint64_t>(1) << MaxBits)) {
+                result = Buckets - 1;
+            } else {
+#ifdef __WINDOWS__
+                unsigned long msb;
+                _BitScanReverse64(&msb, value);
+#else
+                const uint8_t msb = static_cast<uint8_t>(63 - __builtin_clzll(value));
+#endif
+                const uint8_t shift = msb - SubBucketBits;
+
+                result = ((shift + 1) * SubBuckets) + static_cast<uint32_t>((value >> shift) & (SubBuckets - 1));
+            }
+
+            return (result);
+        }
+        static inline uint64_t Lowest(const uint32_t index)
+        {
+            const uint32_t group = index / SubBuckets;
+            const uint64_t sub = index % SubBuckets;
+
+            return (group == 0 ? sub : ((SubBuckets + sub) << (group - 1)));
+        }
+        static inline uint64_t Highest(const uint32_t index)
+        {
+            const uint32_t group = index / SubBuckets;
+
+            return (group == 0 ? Lowest(index) : (Lowest(index) + (static_cast<uint64_t>(1) << (group - 1)) - 1));
+        }
+
+    private:
+        std::atomic<uint32_t> _buckets[Buckets];
+        std::atomic<uint64_t> _count;
+        std::atomic<uint64_t> _sum;
+        std::atomic<uint64_t> _min;
+        std::atomic<uint64_t> _max;
+    };
+}
+} // namespace WPEFramework::Core
@@ -105,7 +105,7 @@ namespace Core {
                     ASSERT(loaded <= sizeof(buffer));
                     DEBUG_VARIABLE(loaded);
 
-                    text += string(buffer, loaded);
+                    text.append(buffer, loaded);
 
                 } while ((offset != 0) && (loaded == sizeof(buffer)));
 
@@ -763,27 +763,37 @@ namespace Core {
                         _set = (1 << (header - 0xCC)) << 12;
                         offset = 1;
                     } else if ((header >= 0xD0) && (header <= 0xD3)) {
-                        _set = (1 << (header - 0xD0)) << 12;
+                        // Signed, once all bytes are in, the sign is extended.
+                        _set = ((1 << (header - 0xD0)) << 12) | NEGATIVE;
                         offset = 1;
                     } else if ((header & 0x80) == 0) {
                         _value = (header & 0x7F);
+                        _set = SET;
                     } else if ((header & 0xE0) == 0xE0) {
-                        _value = (header & 0x0F);
-                        _set = NEGATIVE;
+                        _value = static_cast<TYPE>(static_cast<int8_t>(header));
+                        _set = SET;
                     } else {
                         _set = ERROR;
                     }
                 }
 
                 while ((loaded < maxLength) && (offset != 0)) {
-                    _value = _value << 8;
+                    const uint8_t bytes = ((_set >> 12) & 0xF);
+
+                    _value = static_cast<TYPE>(_value << 8);
                     _value += stream[loaded++];
-                    offset = (offset == ((_set >> 12) & 0xF) ? 0 : offset + 1);
-                }
 
-                if (_value != 0) {
-                    _set |= SET;
+                    if (offset == bytes) {
+                        if (((_set & NEGATIVE) != 0) && (bytes < sizeof(TYPE)) && (((_value >> ((8 * bytes) - 1)) & 1) != 0)) {
+                            _value |= static_cast<TYPE>(~((static_cast<uint64_t>(1) << (8 * bytes)) - 1));
+                        }
+                        _set = SET;
+                        offset = 0;
+                    } else {
+                        offset++;
+                    }
                 }
+
                 return (loaded);
             }
 
@@ -835,15 +845,12 @@ namespace Core {
             uint16_t Convert(uint8_t stream[], const uint16_t maxLength, uint16_t& offset, const TemplateIntToType<false>& /* For compile time diffrentiation */) const
             {
                 uint8_t loaded = 0;
-                uint8_t bytes = (_value <= 0x7F ? 0 : _value < 0xFF ? 1 : _value < 0xFFFF ? 2 : _value < 0xFFFFFFFF ? 4 : 8);
+                uint8_t bytes = (_value <= 0x7F ? 0 : _value <= 0xFF ? 1 : _value <= 0xFFFF ? 2 : _value <= 0xFFFFFFFF ? 4 : 8);
 
                 if (offset == 0) {
                     if (bytes == 0) {
-                        if (_value != 0) {
-                            stream[loaded++] = static_cast<uint8_t>(_value);
-                        } else {
-                            stream[loaded++] = IMessagePack::NullValue;
-                        }
+                        // Positive fixint, 0 included, nil is for a value that is null.
+                        stream[loaded++] = static_cast<uint8_t>(_value);
                     } else {
                         switch (bytes) {
                         case 1:
@@ -878,11 +885,12 @@ namespace Core {
             uint16_t Convert(uint8_t stream[], const uint16_t maxLength, uint16_t& offset, const TemplateIntToType<true>& /* For c ompile time diffrentiation */) const
             {
                 uint8_t loaded = 0;
-                uint8_t bytes = (((_value < 16) && (_value > -15)) ? 0 : ((_value < 128) && (_value > -127)) ? 1 : ((_value < 32767) && (_value > -32766)) ? 2 : ((_value < 2147483647) && (_value > -2147483646)) ? 4 : 8);
+                uint8_t bytes = (((_value >= -32) && (_value <= 127)) ? 0 : ((_value >= -128) && (_value <= 127)) ? 1 : ((_value >= -32768) && (_value <= 32767)) ? 2 : ((_value >= (-2147483647 - 1)) && (_value <= 2147483647)) ? 4 : 8);
 
                 if (offset == 0) {
                     if (bytes == 0) {
-                        stream[loaded++] = (_value & 0x1F) | 0xE0;
+                        // Positive or negative fixint, the two's complement byte is the encoding of both.
+                        stream[loaded++] = static_cast<uint8_t>(_value);
                     } else {
                         switch (bytes) {
                         case 1:
@@ -2950,7 +2958,8 @@ namespace Core {
                     } else if ((stream[0] & 0xF0) == 0x90) {
                         _count = (stream[0] & 0x0F);
                         offset = PARSE;
-                    } else if (stream[0] & 0xDC) {
+                    } else if (stream[0] == 0xDC) {
+                        _count = 0;
                         offset = 1;
                     }
                 }
@@ -3426,10 +3435,11 @@ namespace Core {
                 if (offset == 0) {
                     if (stream[0] == IMessagePack::NullValue) {
                         _state = UNDEFINED;
-                    } else if ((stream[0] & 0x80) == 0x80) {
+                    } else if ((stream[0] & 0xF0) == 0x80) {
                         _count = (stream[0] & 0x0F);
                         offset = (_count > 0 ? PARSE : 0);
-                    } else if (stream[0] & 0xDE) {
+                    } else if (stream[0] == 0xDE) {
+                        _count = 0;
                         offset = 1;
                     }
                     loaded = 1;
@@ -4184,7 +4194,7 @@ namespace Core {
 
                     ASSERT(loaded <= SIZE);
 
-                    value += string(_buffer, loaded);
+                    value.append(_buffer, loaded);
 
                 } while ((loaded == SIZE) && (offset != 0));
 
@@ -0,0 +1,445 @@
+/*
+ * If not stated otherwise in this file or this component's LICENSE file the
+ * following copyright and licenses apply:
+ *
+ * Copyright 2020 RDK Management
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "Module.h"
+#include "JSONFlat.h"
+#include "TextFragment.h"
+
+namespace WPEFramework {
+namespace Core {
+namespace JSON {
+
+    // Rationale:
+    // A VariantContainer builds the whole document, every value a heap allocated Variant (and string), also
+    // when only a few fields of a big document (a configuration override, the DataModel, a large Controller
+    // response) are needed. The Cursor walks over the text in place: every call to Next() yields the next
+    // token (an event), the text of it points into the document, and a complete object or array can be
+    // skipped, which only looks at the quotes and brackets in it. Nothing is allocated, the nesting is kept
+    // in a bit stack, so the documents can be nested MaxDepth deep. The values are read with the scanner
+    // of the Flat classes, so they are read as the JSON classes read them (quoted numbers, escapes).
+    // Find() is the path query on top of it: "a.b[2].c" walks to that value, skipping all the rest.
+    // As nothing is copied, the text has to outlive the cursor.
+    class Cursor {
+    public:
+        static constexpr uint8_t MaxDepth = 64;
+
+        enum token : uint8_t {
+            BEGIN_OBJECT,
+            END_OBJECT,
+            BEGIN_ARRAY,
+            END_ARRAY,
+            LABEL,
+            STRING,
+            NUMBER,
+            BOOLEAN,
+            NULL_VALUE,
+            END, // the document is done
+            ERROR // the text is not valid JSON, the cursor stays here
+        };
+
+    private:
+        enum expect : uint8_t {
+            ROOT, // the value of the document
+            VALUE, // the value after a label
+            FIRST, // the first member or element, or the end of the object or array just entered
+            SEPARATOR, // a comma, or the end of the object or array
+            DONE
+        };
+
+    public:
+        Cursor() = delete;
+        Cursor(const Cursor&) = delete;
+        Cursor& operator=(const Cursor&) = delete;
+
+        explicit Cursor(const string& text)
+            : _begin(text.c_str())
+            , _end(text.c_str() + text.length())
+        {
+            Reset();
+        }
+        Cursor(const TCHAR text[], const uint32_t length)
+            : _begin(text)
+            , _end(text + length)
+        {
+            Reset();
+        }
+        ~Cursor()
+        {
+        }
+
+    public:
+        inline token Current() const
+        {
+            return (_token);
+        }
+        inline bool IsValid() const
+        {
+            return (_token != ERROR);
+        }
+        // The objects and arrays the cursor is in.
+        inline uint8_t Depth() const
+        {
+            return (_depth);
+        }
+        // The text of the current label or value, as it is in the document: strings without the quotes but
+        // still escaped. Use Get() to have them unescaped.
+        inline TextFragment Text() const
+        {
+            const bool quoted = ((_token == LABEL) || (_token == STRING));
+
+            return (TextFragment(_text + (quoted ? 1 : 0), _length - (quoted ? 2 : 0)));
+        }
+
+        void Reset()
+        {
+            _current = _begin;
+            _text = _begin;
+            _length = 0;
+            _nesting = 0;
+            _depth = 0;
+            _state = ROOT;
+            _token = END;
+        }
+
+        token Next()
+        {
+            if ((_token != ERROR) && (_state != DONE)) {
+                Space();
+
+                switch (_state) {
+                case ROOT:
+                case VALUE:
+                    Value();
+                    break;
+                case FIRST:
+                    if (Close() == false) {
+                        Member();
+                    }
+                    break;
+                case SEPARATOR:
+                    if (_depth == 0) {
+                        _token = (_current == _end ? END : ERROR);
+                        _state = DONE;
+                    } else if (Close() == false) {
+                        if ((_current != _end) && (*_current == ',')) {
+                            _current++;
+                            Space();
+                            Member();
+                        } else {
+                            Fail();
+                        }
+                    }
+                    break;
+                default:
+                    break;
+                }
+            }
+
+            return (_token);
+        }
+
+        // On the start of an object or an array: goes to its end (the current token becomes END_OBJECT or
+        // END_ARRAY), on a label: over its value (the current token becomes the value, or the end of it).
+        // Only the strings and brackets of what is skipped are looked at.
+        void Skip()
+        {
+            if (_token == LABEL) {
+                Next();
+            }
+            if ((_token == BEGIN_OBJECT) || (_token == BEGIN_ARRAY)) {
+                uint32_t level = 1;
+
+                while ((_current != _end) && (level != 0)) {
+                    switch (*_current) {
+                    case '\"':
+                        String();
+                        break;
+                    case '{':
+                    case '[':
+                        level++;
+                        _current++;
+                        break;
+                    case '}':
+                    case ']':
+                        level--;
+                        _current += (level != 0 ? 1 : 0);
+                        break;
+                    default:
+                        _current++;
+                        break;
+                    }
+                }
+
+                if ((level != 0) || (Close() == false)) {
+                    Fail();
+                }
+            }
+        }
+
+        // Goes, from the start of the document, to the value at the path: labels separated by dots, array
+        // elements by their index in brackets, e.g. "plugins[3].configuration.root". The cursor is on the
+        // (first token of the) value when found, it can be read with Get(), or walked into with Next().
+        bool Find(const TCHAR path[])
+        {
+            bool result = true;
+
+            Reset();
+            Next();
+
+            while ((*path != '\0') && (result == true) && (_token != ERROR)) {
+                if (*path == '[') {
+                    uint32_t index = 0;
+
+                    path++;
+                    while ((*path >= '0') && (*path <= '9')) {
+                        index = (index * 10) + (*path - '0');
+                        path++;
+                    }
+                    if ((*path != ']') || (_token != BEGIN_ARRAY)) {
+                        result = false;
+                    } else {
+                        path++;
+
+                        Next();
+                        while ((index != 0) && (_token != END_ARRAY) && (_token != ERROR)) {
+                            Skip();
+                            Next();
+                            index--;
+                        }
+                        result = (_token != END_ARRAY);
+                    }
+                } else {
+                    path += (*path == '.' ? 1 : 0);
+
+                    const TCHAR* label = path;
+
+                    while ((*path != '\0') && (*path != '.') && (*path != '[')) {
+                        path++;
+                    }
+
+                    const uint32_t length = static_cast<uint32_t>(path - label);
+
+                    if (_token != BEGIN_OBJECT) {
+                        result = false;
+                    } else {
+                        while ((Next() == LABEL) && (((_length - 2) != length) || (::memcmp(&(_text[1]), label, length * sizeof(TCHAR)) != 0))) {
+                            Skip();
+                        }
+                        result = (_token == LABEL);
+                        if (result == true) {
+                            Next();
+                        }
+                    }
+                }
+            }
+
+            return ((result == true) && (*path == '\0') && (IsValue() == true));
+        }
+
+        // The current value, false if it is null or can not be read as the type.
+        template <typename TYPE>
+        bool Get(TYPE& value) const
+        {
+            bool result = false;
+
+            if ((_token >= STRING) && (_token <= NULL_VALUE)) {
+                Flat::Reader reader(_text, _length);
+                result = reader.Value(value);
+            }
+
+            return (result);
+        }
+        // The value at the path, see Find().
+        template <typename TYPE>
+        bool Get(const TCHAR path[], TYPE& value)
+        {
+            return ((Find(path) == true) && (Get(value) == true));
+        }
+
+    private:
+        inline bool IsValue() const
+        {
+            return ((_token == BEGIN_OBJECT) || (_token == BEGIN_ARRAY) || ((_token >= STRING) && (_token <= NULL_VALUE)));
+        }
+        void Fail()
+        {
+            _token = ERROR;
+            _current = _end;
+        }
+        void Space()
+        {
+            while ((_current != _end) && ((*_current == ' ') || (*_current == '\n') || (*_current == '\r') || (*_current == '\t'))) {
+                _current++;
+            }
+        }
+        // The cursor is on the opening quote, false (and at the end) if the string does not end. Most of what
+        // is skipped is in strings, so the quotes are looked for with memchr, a quote is escaped when there
+        // is an odd number of backslashes in front of it.
+        bool String()
+        {
+            static_assert(sizeof(TCHAR) == sizeof(char), "The cursor scans the text as bytes");
+
+            const TCHAR* const start = ++_current;
+            bool result = false;
+
+            while ((result == false) && (_current != _end)) {
+                const TCHAR* quote = static_cast<const TCHAR*>(::memchr(_current, '\"', _end - _current));
+
+                if (quote == nullptr) {
+                    _current = _end;
+                } else {
+                    const TCHAR* escapes = quote;
+
+                    while ((escapes != start) && (escapes[-1] == '\\')) {
+                        escapes--;
+                    }
+
+                    _current = quote + 1;
+                    result = (((quote - escapes) & 0x01) == 0);
+                }
+            }
+
+            return (result);
+        }
+        bool Literal(const TCHAR literal[], const uint8_t length)
+        {
+            const bool result = ((static_cast<uint32_t>(_end - _current) >= length) && (::memcmp(_current, literal, length * sizeof(TCHAR)) == 0));
+
+            _current += (result ? length : 0);
+
+            return (result);
+        }
+        // The end of the object or array the cursor is in.
+        bool Close()
+        {
+            bool result = false;
+
+            if ((_current != _end) && (_depth != 0)) {
+                const bool object = (((_nesting >> (_depth - 1)) & 0x01) != 0);
+
+                if (*_current == (object ? '}' : ']')) {
+                    _text = _current++;
+                    _length = 1;
+                    _token = (object ? END_OBJECT : END_ARRAY);
+                    _nesting &= ~(static_cast<uint64_t>(1) << (_depth - 1));
+                    _depth--;
+                    _state = SEPARATOR;
+                    result = true;
+                }
+            }
+
+            return (result);
+        }
+        void Member()
+        {
+            if (((_nesting >> (_depth - 1)) & 0x01) == 0) {
+                Value();
+            } else if ((_current == _end) || (*_current != '\"')) {
+                Fail();
+            } else {
+                _text = _current;
+
+                if (String() == false) {
+                    Fail();
+                } else {
+                    _length = static_cast<uint32_t>(_current - _text);
+
+                    Space();
+
+                    if ((_current == _end) || (*_current != ':')) {
+                        Fail();
+                    } else {
+                        _current++;
+                        _token = LABEL;
+                        _state = VALUE;
+                    }
+                }
+            }
+        }
+        void Value()
+        {
+            _text = _current;
+            _state = SEPARATOR;
+
+            if (_current == _end) {
+                Fail();
+            } else {
+                switch (*_current) {
+                case '{':
+                case '[':
+                    if (_depth == MaxDepth) {
+                        Fail();
+                    } else {
+                        _nesting |= (*_current == '{' ? (static_cast<uint64_t>(1) << _depth) : 0);
+                        _depth++;
+                        _token = (*_current == '{' ? BEGIN_OBJECT : BEGIN_ARRAY);
+                        _state = FIRST;
+                        _current++;
+                    }
+                    break;
+                case '\"':
+                    _token = (String() == true ? STRING : ERROR);
+                    break;
+                case 't':
+                    _token = (Literal(_T("true"), 4) == true ? BOOLEAN : ERROR);
+                    break;
+                case 'f':
+                    _token = (Literal(_T("false"), 5) == true ? BOOLEAN : ERROR);
+                    break;
+                case 'n':
+                    _token = (Literal(_T("null"), 4) == true ? NULL_VALUE : ERROR);
+                    break;
+                default:
+                    if ((*_current == '-') || ((*_current >= '0') && (*_current <= '9'))) {
+                        _current++;
+                        while ((_current != _end) && (((*_current >= '0') && (*_current <= '9')) || (*_current == '.') || (*_current == 'e') || (*_current == 'E') || (*_current == '+') || (*_current == '-'))) {
+                            _current++;
+                        }
+                        _token = NUMBER;
+                    } else {
+                        _token = ERROR;
+                    }
+                    break;
+                }
+
+                if (_token == ERROR) {
+                    Fail();
+                }
+            }
+
+            _length = static_cast<uint32_t>(_current - _text);
+        }
+
+    private:
+        const TCHAR* const _begin;
+        const TCHAR* const _end;
+        const TCHAR* _current;
+        const TCHAR* _text;
+        uint32_t _length;
+        uint64_t _nesting; // a bit per level, set for an object
+        uint8_t _depth;
+        expect _state;
+        token _token;
+    };
+
+} // namespace JSON
+} // namespace Core
+} // namespace WPEFramework
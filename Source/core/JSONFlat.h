@@ -0,0 +1,895 @@
+/*
+ * If not stated otherwise in this file or this component's LICENSE file the
+ * following copyright and licenses apply:
+ *
+ * Copyright 2020 RDK Management
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "Module.h"
+#include "Enumerate.h"
+#include "Portability.h"
+#include "TextFragment.h"
+
+#include <cmath>
+#include <type_traits>
+#include <vector>
+
+namespace WPEFramework {
+namespace Core {
+namespace JSON {
+namespace Flat {
+
+    // Rationale:
+    // A JSON::Container registers every member (a list node per field) when it is constructed and reaches
+    // the members through the IElement interface, a virtual call per field per (partial) buffer. For the
+    // data classes generated from a schema the members are known at compile time, so the JsonGenerator
+    // can also emit (--flat) plain structs: the members below carry no interface, the labels are a constexpr
+    // table and the (de)serializer is a switch over that table, writing to/reading from the text directly.
+    // The text is the one the JSON classes produce for the same values: members that are not set are left
+    // out, strings are escaped/unescaped the same way, and numbers may be quoted (hex/octal) or null when
+    // read. The structs have ToString/FromString, so they can be used with the JSON-RPC Register/Property
+    // templates in the place of the container classes.
+
+    struct Field {
+        const TCHAR* Name;
+        uint8_t Length;
+    };
+
+    // Objects are anything that is not a number, a bool, an enum or a string.
+    template <typename TYPE>
+    struct Kind {
+        enum { value = (std::is_enum<TYPE>::value ? 1 : std::is_floating_point<TYPE>::value ? 2 : std::is_integral<TYPE>::value ? (std::is_signed<TYPE>::value ? 3 : 4) : 0) };
+    };
+
+    inline void Reset(string& value)
+    {
+        // Keep the buffer, the next value is likely to fit as well.
+        value.clear();
+    }
+    template <typename TYPE>
+    inline typename std::enable_if<std::is_class<TYPE>::value == false>::type Reset(TYPE& value)
+    {
+        value = TYPE();
+    }
+    template <typename TYPE>
+    inline typename std::enable_if<std::is_class<TYPE>::value == true>::type Reset(TYPE& value)
+    {
+        value.Clear();
+    }
+
+    class Reader;
+
+    template <typename TYPE>
+    class Scalar {
+    private:
+        friend class Reader;
+
+    public:
+        Scalar()
+            : _value()
+            , _set(false)
+        {
+        }
+        Scalar(const Scalar<TYPE>&) = default;
+        Scalar<TYPE>& operator=(const Scalar<TYPE>&) = default;
+        ~Scalar() = default;
+
+        Scalar<TYPE>& operator=(const TYPE& value)
+        {
+            _value = value;
+            _set = true;
+            return (*this);
+        }
+
+    public:
+        inline const TYPE& Value() const
+        {
+            return (_value);
+        }
+        inline operator const TYPE&() const
+        {
+            return (_value);
+        }
+        inline bool IsSet() const
+        {
+            return (_set);
+        }
+        inline void Clear()
+        {
+            Reset(_value);
+            _set = false;
+        }
+
+    private:
+        TYPE _value;
+        bool _set;
+    };
+
+    // A member of which the schema does not tell the layout, kept (and written) as the JSON text it is.
+    class Opaque {
+    public:
+        Opaque()
+            : _value()
+        {
+        }
+        Opaque(const Opaque&) = default;
+        Opaque& operator=(const Opaque&) = default;
+        ~Opaque() = default;
+
+        Opaque& operator=(const string& value)
+        {
+            _value = value;
+            return (*this);
+        }
+
+    public:
+        inline const string& Value() const
+        {
+            return (_value);
+        }
+        inline bool IsSet() const
+        {
+            return (_value.empty() == false);
+        }
+        inline void Clear()
+        {
+            _value.clear();
+        }
+
+    private:
+        friend class Reader;
+
+        string _value;
+    };
+
+    // The elements are kept when the array is cleared, so reading into the same array again reuses them.
+    template <typename ELEMENT>
+    class Array {
+    public:
+        typedef typename std::vector<ELEMENT>::iterator iterator;
+        typedef typename std::vector<ELEMENT>::const_iterator const_iterator;
+
+    public:
+        Array()
+            : _elements()
+            , _count(0)
+        {
+        }
+        Array(const Array<ELEMENT>&) = default;
+        Array<ELEMENT>& operator=(const Array<ELEMENT>&) = default;
+        ~Array() = default;
+
+    public:
+        ELEMENT& Add()
+        {
+            if (_count == _elements.size()) {
+                _elements.emplace_back();
+            } else {
+                Reset(_elements[_count]);
+            }
+            return (_elements[_count++]);
+        }
+        ELEMENT& Add(const ELEMENT& element)
+        {
+            ELEMENT& result(Add());
+            result = element;
+            return (result);
+        }
+        inline uint32_t Length() const
+        {
+            return (_count);
+        }
+        inline ELEMENT& operator[](const uint32_t index)
+        {
+            ASSERT(index < _count);
+            return (_elements[index]);
+        }
+        inline const ELEMENT& operator[](const uint32_t index) const
+        {
+            ASSERT(index < _count);
+            return (_elements[index]);
+        }
+        inline iterator begin()
+        {
+            return (_elements.begin());
+        }
+        inline iterator end()
+        {
+            return (_elements.begin() + _count);
+        }
+        inline const_iterator begin() const
+        {
+            return (_elements.begin());
+        }
+        inline const_iterator end() const
+        {
+            return (_elements.begin() + _count);
+        }
+        inline bool IsSet() const
+        {
+            return (_count != 0);
+        }
+        inline void Clear()
+        {
+            _count = 0;
+        }
+
+    private:
+        std::vector<ELEMENT> _elements;
+        uint32_t _count;
+    };
+
+    class Writer {
+    public:
+        Writer() = delete;
+        Writer(const Writer&) = delete;
+        Writer& operator=(const Writer&) = delete;
+
+        explicit Writer(string& text)
+            : _text(text)
+            , _first(true)
+        {
+            _text.push_back('{');
+        }
+        ~Writer()
+        {
+        }
+
+    public:
+        template <typename TYPE>
+        void Write(const Field& field, const TYPE& member)
+        {
+            if (member.IsSet() == true) {
+                if (_first == false) {
+                    _text.push_back(',');
+                }
+                _first = false;
+                _text.push_back('\"');
+                _text.append(field.Name, field.Length);
+                _text.append(_T("\":"), 2);
+                Value(_text, member);
+            }
+        }
+        void End()
+        {
+            _text.push_back('}');
+        }
+
+    private:
+        template <typename TYPE>
+        static void Value(string& text, const Scalar<TYPE>& member)
+        {
+            Value(text, member.Value());
+        }
+        template <typename ELEMENT>
+        static void Value(string& text, const Array<ELEMENT>& member)
+        {
+            text.push_back('[');
+            for (uint32_t index = 0; index < member.Length(); index++) {
+                if (index != 0) {
+                    text.push_back(',');
+                }
+                Value(text, member[index]);
+            }
+            text.push_back(']');
+        }
+        static void Value(string& text, const Opaque& member)
+        {
+            text.append(member.Value());
+        }
+        static void Value(string& text, const bool value)
+        {
+            if (value == true) {
+                text.append(_T("true"), 4);
+            } else {
+                text.append(_T("false"), 5);
+            }
+        }
+        static void Value(string& text, const string& value)
+        {
+            // As the JSON::String does: only a quote that is not escaped yet gets escaped.
+            const TCHAR* start = value.c_str();
+            const TCHAR* const end = start + value.length();
+            const TCHAR* current = start;
+
+            text.push_back('\"');
+            while (current != end) {
+                if ((*current == '\"') && ((current == value.c_str()) || (current[-1] != '\\'))) {
+                    text.append(start, current - start);
+                    text.push_back('\\');
+                    start = current;
+                }
+                current++;
+            }
+            text.append(start, end - start);
+            text.push_back('\"');
+        }
+        template <typename TYPE>
+        static void Value(string& text, const TYPE& value)
+        {
+            Convert(text, value, TemplateIntToType<Kind<TYPE>::value>());
+        }
+
+        template <typename TYPE>
+        static void Convert(string& text, const TYPE& value, const TemplateIntToType<0>&)
+        {
+            value.Serialize(text);
+        }
+        template <typename TYPE>
+        static void Convert(string& text, const TYPE value, const TemplateIntToType<1>&)
+        {
+            const TCHAR* name = Core::EnumerateType<TYPE>(value).Data();
+
+            if (name == nullptr) {
+                text.append(_T("null"), 4);
+            } else {
+                text.push_back('\"');
+                text.append(name);
+                text.push_back('\"');
+            }
+        }
+        template <typename TYPE>
+        static void Convert(string& text, const TYPE value, const TemplateIntToType<2>&)
+        {
+            if ((std::isinf(value) == true) || (std::isnan(value) == true)) {
+                text.append(_T("null"), 4);
+            } else {
+                char buffer[32];
+                const int length = ::snprintf(buffer, sizeof(buffer), "%g", static_cast<double>(value));
+                text.append(buffer, (length > 0 ? length : 0));
+            }
+        }
+        template <typename TYPE>
+        static void Convert(string& text, const TYPE value, const TemplateIntToType<3>&)
+        {
+            typedef typename std::make_unsigned<TYPE>::type UNSIGNED;
+
+            if (value < 0) {
+                text.push_back('-');
+                Digits(text, static_cast<UNSIGNED>(~static_cast<UNSIGNED>(value) + 1));
+            } else {
+                Digits(text, static_cast<UNSIGNED>(value));
+            }
+        }
+        template <typename TYPE>
+        static void Convert(string& text, const TYPE value, const TemplateIntToType<4>&)
+        {
+            Digits(text, value);
+        }
+        template <typename TYPE>
+        static void Digits(string& text, TYPE value)
+        {
+            TCHAR buffer[24];
+            TCHAR* const end = &(buffer[sizeof(buffer) / sizeof(TCHAR)]);
+            TCHAR* position = end;
+
+            do {
+                *(--position) = static_cast<TCHAR>('0' + (value % 10));
+                value /= 10;
+            } while (value != 0);
+
+            text.append(position, end - position);
+        }
+
+    private:
+        string& _text;
+        bool _first;
+    };
+
+    class Reader {
+    public:
+        Reader() = delete;
+        Reader(const Reader&) = delete;
+        Reader& operator=(const Reader&) = delete;
+
+        explicit Reader(const string& text)
+            : _current(text.c_str())
+            , _end(text.c_str() + text.length())
+            , _valid(true)
+        {
+        }
+        Reader(const TCHAR text[], const uint32_t length)
+            : _current(text)
+            , _end(text + length)
+            , _valid(true)
+        {
+        }
+        ~Reader()
+        {
+        }
+
+    public:
+        inline bool IsValid() const
+        {
+            return (_valid);
+        }
+
+        // Enters an object, false if it is null or empty (or not an object at all, which makes the reader invalid).
+        bool Begin()
+        {
+            bool result = false;
+
+            Space();
+
+            if ((_current != _end) && (*_current == '{')) {
+                _current++;
+                result = true;
+            } else if ((_current != _end) && (Null() == false)) {
+                Fail();
+            }
+
+            return (result);
+        }
+
+        // The next label of the object entered, index is where it is in the fields, or count if not
+        // found. False at the end of the object, or when the text is not valid.
+        bool Next(const Field fields[], const uint8_t count, uint8_t& index)
+        {
+            bool result = false;
+
+            Space();
+
+            if ((_valid == true) && (_current != _end)) {
+                if (*_current == '}') {
+                    _current++;
+                } else {
+                    if (*_current == ',') {
+                        _current++;
+                        Space();
+                    }
+                    if ((_current == _end) || (*_current != '\"')) {
+                        Fail();
+                    } else {
+                        const TCHAR* label = ++_current;
+
+                        while ((_current != _end) && (*_current != '\"')) {
+                            _current += ((*_current == '\\') && ((_current + 1) != _end) ? 2 : 1);
+                        }
+
+                        const uint32_t length = static_cast<uint32_t>(_current - label);
+
+                        Space(1);
+
+                        if ((_current == _end) || (*_current != ':')) {
+                            Fail();
+                        } else {
+                            _current++;
+
+                            index = 0;
+                            while ((index < count) && ((fields[index].Length != length) || (::memcmp(fields[index].Name, label, length * sizeof(TCHAR)) != 0))) {
+                                index++;
+                            }
+
+                            Space();
+                            result = true;
+                        }
+                    }
+                }
+            } else {
+                Fail();
+            }
+
+            return (result);
+        }
+
+        template <typename TYPE>
+        void Read(Scalar<TYPE>& member)
+        {
+            if (Null() == true) {
+                member.Clear();
+            } else {
+                member._set = Parse(member._value);
+            }
+        }
+        template <typename ELEMENT>
+        void Read(Array<ELEMENT>& member)
+        {
+            if (Null() == true) {
+                member.Clear();
+            } else {
+                Parse(member);
+            }
+        }
+        void Read(Opaque& member)
+        {
+            Parse(member);
+        }
+        template <typename TYPE>
+        void Read(TYPE& member)
+        {
+            member.Deserialize(*this);
+        }
+
+        // A single value that is not a member, false if it is null or not of the type (the JSON::Cursor reads
+        // its values with this).
+        template <typename TYPE>
+        bool Value(TYPE& value)
+        {
+            Space();
+
+            return ((Null() == false) && (Parse(value) == true) && (_valid == true));
+        }
+
+        // A value of a label that is not in the fields.
+        void Skip()
+        {
+            uint32_t depth = 0;
+
+            Space();
+
+            do {
+                if (_current == _end) {
+                    Fail();
+                } else if (*_current == '\"') {
+                    String();
+                } else if ((*_current == '{') || (*_current == '[')) {
+                    depth++;
+                    _current++;
+                } else if ((*_current == '}') || (*_current == ']')) {
+                    if (depth == 0) {
+                        Fail();
+                    } else {
+                        depth--;
+                        _current++;
+                    }
+                } else if (depth == 0) {
+                    Token();
+                } else {
+                    _current++;
+                }
+            } while ((depth != 0) && (_valid == true));
+        }
+
+    private:
+        void Fail()
+        {
+            _valid = false;
+            _current = _end;
+        }
+        void Space(const uint8_t skip = 0)
+        {
+            _current += ((_current != _end) ? skip : 0);
+            while ((_current != _end) && (::isspace(*_current) != 0)) {
+                _current++;
+            }
+        }
+        bool Null()
+        {
+            bool result = false;
+
+            if (((_end - _current) >= 4) && (::memcmp(_current, _T("null"), 4 * sizeof(TCHAR)) == 0)) {
+                _current += 4;
+                result = true;
+            }
+
+            return (result);
+        }
+        // An unquoted value, up to the next separator.
+        uint32_t Token()
+        {
+            const TCHAR* start = _current;
+
+            while ((_current != _end) && (*_current != ',') && (*_current != '}') && (*_current != ']') && (::isspace(*_current) == 0)) {
+                _current++;
+            }
+
+            return (static_cast<uint32_t>(_current - start));
+        }
+        // A quoted value, without unescaping it, the reader is on the opening quote.
+        void String()
+        {
+            _current++;
+
+            while ((_current != _end) && (*_current != '\"')) {
+                _current += ((*_current == '\\') && ((_current + 1) != _end) ? 2 : 1);
+            }
+
+            if (_current == _end) {
+                Fail();
+            } else {
+                _current++;
+            }
+        }
+
+        bool Parse(bool& value)
+        {
+            bool result = true;
+            const TCHAR* start = _current;
+            const uint32_t length = Token();
+
+            if ((length == 4) && (::memcmp(start, _T("true"), 4 * sizeof(TCHAR)) == 0)) {
+                value = true;
+            } else if ((length == 5) && (::memcmp(start, _T("false"), 5 * sizeof(TCHAR)) == 0)) {
+                value = false;
+            } else {
+                result = false;
+                Fail();
+            }
+
+            return (result);
+        }
+        bool Parse(string& value)
+        {
+            bool result = true;
+
+            value.clear();
+
+            if ((_current == _end) || (*_current != '\"')) {
+                // Unquoted, taken as is, as the JSON::String does.
+                const TCHAR* start = _current;
+                value.assign(start, Token());
+            } else {
+                // Unescaped as the JSON::String does: \uXXXX is kept as is.
+                const TCHAR* start = ++_current;
+
+                while ((_current != _end) && (*_current != '\"')) {
+                    if (*_current != '\\') {
+                        _current++;
+                    } else if ((_current + 1) == _end) {
+                        _current++;
+                    } else {
+                        TCHAR replacement = _current[1];
+
+                        switch (replacement) {
+                        case 'n':
+                            replacement = '\n';
+                            break;
+                        case 'r':
+                            replacement = '\r';
+                            break;
+                        case 't':
+                            replacement = '\t';
+                            break;
+                        case 'f':
+                            replacement = '\f';
+                            break;
+                        case 'b':
+                            replacement = '\b';
+                            break;
+                        case 'u':
+                            replacement = '\0';
+                            break;
+                        case '\"':
+                        case '\\':
+                        case '/':
+                            break;
+                        default:
+                            result = false;
+                            break;
+                        }
+
+                        if (result == false) {
+                            break;
+                        } else if (replacement == '\0') {
+                            _current += 2;
+                        } else {
+                            value.append(start, _current - start);
+                            value.push_back(replacement);
+                            _current += 2;
+                            start = _current;
+                        }
+                    }
+                }
+
+                if ((result == false) || (_current == _end)) {
+                    result = false;
+                    Fail();
+                } else {
+                    value.append(start, _current - start);
+                    _current++;
+                }
+            }
+
+            return (result);
+        }
+        template <typename ELEMENT>
+        bool Parse(Array<ELEMENT>& value)
+        {
+            value.Clear();
+
+            if ((_current == _end) || (*_current != '[')) {
+                Fail();
+            } else {
+                _current++;
+                Space();
+
+                while ((_current != _end) && (*_current != ']')) {
+                    if (*_current == ',') {
+                        _current++;
+                        Space();
+                    }
+                    if (Null() == false) {
+                        Parse(value.Add());
+                    } else {
+                        value.Add();
+                    }
+                    Space();
+                }
+
+                if (_current == _end) {
+                    Fail();
+                } else {
+                    _current++;
+                }
+            }
+
+            return (_valid);
+        }
+        bool Parse(Opaque& value)
+        {
+            const TCHAR* start = _current;
+
+            value._value.clear();
+
+            if (Null() == false) {
+                Skip();
+
+                if (_valid == true) {
+                    value._value.assign(start, _current - start);
+                }
+            }
+
+            return (_valid);
+        }
+        template <typename TYPE>
+        bool Parse(TYPE& value)
+        {
+            return (Parse(value, TemplateIntToType<Kind<TYPE>::value>()));
+        }
+
+        template <typename TYPE>
+        bool Parse(TYPE& value, const TemplateIntToType<0>&)
+        {
+            value.Deserialize(*this);
+            return (_valid);
+        }
+        template <typename TYPE>
+        bool Parse(TYPE& value, const TemplateIntToType<1>&)
+        {
+            bool result = false;
+            const TCHAR* start = _current;
+
+            if ((_current != _end) && (*_current == '\"')) {
+                String();
+            } else {
+                Token();
+            }
+
+            if (_valid == true) {
+                const bool quoted = (*start == '\"');
+                const TextFragment name(start, (quoted ? 1 : 0), static_cast<uint32_t>(_current - start) - (quoted ? 2 : 0));
+                const Core::EnumerateType<TYPE> converted(name, false);
+
+                // An unknown name leaves the value undefined, as the JSON::EnumType does.
+                if (converted.IsSet() == true) {
+                    value = converted.Value();
+                    result = true;
+                }
+            }
+
+            return (result);
+        }
+        template <typename TYPE>
+        bool Parse(TYPE& value, const TemplateIntToType<2>&)
+        {
+            bool result = false;
+            const bool quoted = ((_current != _end) && (*_current == '\"'));
+            const TCHAR* start = (quoted == true ? _current + 1 : _current);
+
+            if (quoted == true) {
+                String();
+            } else {
+                Token();
+            }
+
+            const uint32_t length = static_cast<uint32_t>(_current - start) - (quoted ? 1 : 0);
+            TCHAR buffer[64];
+
+            if ((_valid == true) && (length > 0) && (length < (sizeof(buffer) / sizeof(TCHAR)))) {
+                TCHAR* end = nullptr;
+
+                ::memcpy(buffer, start, length * sizeof(TCHAR));
+                buffer[length] = '\0';
+                value = static_cast<TYPE>(::strtod(buffer, &end));
+                result = (end == &(buffer[length]));
+            }
+            if (result == false) {
+                Fail();
+            }
+
+            return (result);
+        }
+        template <typename TYPE>
+        bool Parse(TYPE& value, const TemplateIntToType<3>&)
+        {
+            return (Number(value));
+        }
+        template <typename TYPE>
+        bool Parse(TYPE& value, const TemplateIntToType<4>&)
+        {
+            return (Number(value));
+        }
+        // Decimal, or when quoted also hexadecimal (0x) and octal (leading 0), as the JSON::NumberType reads.
+        template <typename TYPE>
+        bool Number(TYPE& value)
+        {
+            typedef typename std::make_unsigned<TYPE>::type UNSIGNED;
+
+            const bool quoted = ((_current != _end) && (*_current == '\"'));
+            bool negative = false;
+            uint8_t base = 10;
+            uint8_t digits = 0;
+            UNSIGNED magnitude = 0;
+
+            _current += (quoted ? 1 : 0);
+
+            if ((_current != _end) && (*_current == '-')) {
+                negative = true;
+                _current++;
+            }
+            if ((quoted == true) && ((_end - _current) >= 2) && (*_current == '0')) {
+                if (::toupper(_current[1]) == 'X') {
+                    base = 16;
+                    _current += 2;
+                } else if (::isdigit(_current[1]) != 0) {
+                    base = 8;
+                    _current++;
+                }
+            }
+            while (_current != _end) {
+                const TCHAR current = *_current;
+                uint8_t digit;
+
+                if (::isdigit(current) != 0) {
+                    digit = static_cast<uint8_t>(current - '0');
+                } else if ((base == 16) && (::isxdigit(current) != 0)) {
+                    digit = static_cast<uint8_t>(::toupper(current) - 'A' + 10);
+                } else {
+                    break;
+                }
+
+                magnitude = static_cast<UNSIGNED>((magnitude * base) + digit);
+                digits++;
+                _current++;
+            }
+            if (quoted == true) {
+                if ((_current != _end) && (*_current == '\"')) {
+                    _current++;
+                } else {
+                    digits = 0;
+                }
+            }
+
+            if ((digits == 0) || ((negative == true) && (std::is_signed<TYPE>::value == false))) {
+                Fail();
+            } else {
+                value = (negative == true ? static_cast<TYPE>(~magnitude + 1) : static_cast<TYPE>(magnitude));
+            }
+
+            return (_valid);
+        }
+
+    private:
+        const TCHAR* _current;
+        const TCHAR* const _end;
+        bool _valid;
+    };
+
+} // namespace Flat
+} // namespace JSON
+} // namespace Core
+} // namespace WPEFramework
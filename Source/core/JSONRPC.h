@@ -21,7 +21,9 @@
 
 #include "JSON.h"
 #include "Module.h"
+#include "Time.h"
 #include "TypeTraits.h"
+#include "WorkerPool.h"
 
 #include <cctype>
 #include <functional>
@@ -385,6 +387,11 @@ namespace Core {
                 Observer(const uint32_t id, const string& designator)
                     : _id(id)
                     , _designator(designator)
+                    , _coalesce(false)
+                    , _interval(0)
+                    , _next(0)
+                    , _pending(false)
+                    , _parameters()
                 {
                 }
                 ~Observer()
@@ -408,10 +415,58 @@ namespace Core {
                 {
                     return (_designator);
                 }
+                // Coalescing defers the delivery to the workerpool, an interval (in ticks) limits the rate.
+                void Throttle(const bool coalesce, const uint64_t interval)
+                {
+                    _coalesce = coalesce;
+                    _interval = interval;
+                }
+                bool IsThrottled() const
+                {
+                    return ((_coalesce == true) || (_interval != 0));
+                }
+                bool IsPending() const
+                {
+                    return (_pending);
+                }
+                uint64_t Deadline() const
+                {
+                    return (_next);
+                }
+                // Returns false if the event is to be sent right away, otherwise it takes the pending slot, the
+                // last value wins.
+                bool Hold(const uint64_t now, const string& parameters)
+                {
+                    bool result = true;
+
+                    if ((_coalesce == false) && (_pending == false) && (now >= _next)) {
+                        _next = now + _interval;
+                        result = false;
+                    } else {
+                        _pending = true;
+                        _parameters = parameters;
+                    }
+
+                    return (result);
+                }
+                string Release(const uint64_t now)
+                {
+                    ASSERT(_pending == true);
+
+                    _pending = false;
+                    _next = now + _interval;
+
+                    return (std::move(_parameters));
+                }
 
             private:
                 uint32_t _id;
                 string _designator;
+                bool _coalesce;
+                uint64_t _interval;
+                uint64_t _next;
+                bool _pending;
+                string _parameters;
             };
 
             typedef std::map<const string, Entry> HandlerMap;
@@ -499,6 +554,8 @@ namespace Core {
                 , _observers()
                 , _notificationFunction(notificationFunction)
                 , _versions(versions)
+                , _job(nullptr)
+                , _scheduled(0)
             {
             }
             Handler(const NotificationFunction& notificationFunction, const std::vector<uint8_t>& versions, const Handler& copy)
@@ -507,10 +564,15 @@ namespace Core {
                 , _observers()
                 , _notificationFunction(notificationFunction)
                 , _versions(versions)
+                , _job(nullptr)
+                , _scheduled(0)
             {
             }
             ~Handler()
             {
+                if (_job != nullptr) {
+                    delete _job;
+                }
             }
 
         public:
@@ -673,6 +735,37 @@ namespace Core {
 
                 _adminLock.Unlock();
             }
+            // Rationale:
+            // Some events are sent at a high rate (input, playback position, signal strength), where most observers
+            // only need the latest value. An observer can ask for its event to be coalesced, delivered from the
+            // workerpool so a burst collapses in the latest value, and/or for a maximum number of deliveries per
+            // second, where the events in between are held in one pending slot, the last value wins. The value
+            // held is delivered when the interval expires, so the last event is never lost.
+            uint32_t Throttle(const uint32_t id, const string& eventId, const string& callsign, const bool coalesce, const uint16_t maxRate)
+            {
+                uint32_t result = Core::ERROR_UNKNOWN_KEY;
+
+                _adminLock.Lock();
+
+                ObserverMap::iterator index = _observers.find(eventId);
+
+                if (index != _observers.end()) {
+                    ObserverList::iterator loop = std::find(index->second.begin(), index->second.end(), Observer(id, callsign));
+
+                    if (loop != index->second.end()) {
+                        if (Core::IWorkerPool::IsAvailable() == false) {
+                            result = Core::ERROR_UNAVAILABLE;
+                        } else {
+                            loop->Throttle(coalesce, (maxRate != 0 ? (Core::Time::TicksPerMillisecond * 1000) / maxRate : 0));
+                            result = Core::ERROR_NONE;
+                        }
+                    }
+                }
+
+                _adminLock.Unlock();
+
+                return (result);
+            }
             void Unsubscribe(const uint32_t id, const string& eventId, const string& callsign, Core::JSONRPC::Message& response)
             {
                 _adminLock.Lock();
@@ -1032,6 +1125,7 @@ namespace Core {
                 if (index != _observers.end()) {
                     ObserverList& clients = index->second;
                     ObserverList::iterator loop = clients.begin();
+                    uint64_t now = 0;
 
                     result = Core::ERROR_NONE;
 
@@ -1040,7 +1134,18 @@ namespace Core {
 
                         if (!sendifmethod || sendifmethod(designator)) {
 
-                            _notificationFunction(loop->Id(), (designator.empty() == false ? designator + '.' + event : event), parameters);
+                            if (loop->IsThrottled() == false) {
+                                _notificationFunction(loop->Id(), (designator.empty() == false ? designator + '.' + event : event), parameters);
+                            } else {
+                                if (now == 0) {
+                                    now = Core::Time::Now().Ticks();
+                                }
+                                if (loop->Hold(now, parameters) == false) {
+                                    _notificationFunction(loop->Id(), (designator.empty() == false ? designator + '.' + event : event), parameters);
+                                } else {
+                                    Reschedule(std::max(loop->Deadline(), now));
+                                }
+                            }
                         }
 
                         loop++;
@@ -1052,12 +1157,62 @@ namespace Core {
                 return (result);
             }
 
+            friend class Core::ThreadPool::JobType<Handler&>;
+
+            // Delivers the pending events of which the time has come, from the workerpool.
+            void Dispatch()
+            {
+                const uint64_t now = Core::Time::Now().Ticks();
+                uint64_t next = ~0;
+
+                _adminLock.Lock();
+
+                _scheduled = 0;
+
+                for (std::pair<const string, ObserverList>& entry : _observers) {
+                    for (Observer& observer : entry.second) {
+                        if (observer.IsPending() == true) {
+                            if (observer.Deadline() <= now) {
+                                const string& designator(observer.Designator());
+
+                                _notificationFunction(observer.Id(), (designator.empty() == false ? designator + '.' + entry.first : entry.first), observer.Release(now));
+                            } else if (observer.Deadline() < next) {
+                                next = observer.Deadline();
+                            }
+                        }
+                    }
+                }
+
+                if (next != static_cast<uint64_t>(~0)) {
+                    Reschedule(next);
+                }
+
+                _adminLock.Unlock();
+            }
+            // Should be called with the _adminLock taken.
+            void Reschedule(const uint64_t deadline)
+            {
+                if ((_scheduled == 0) || (deadline < _scheduled)) {
+                    if (_job == nullptr) {
+                        _job = new Core::IWorkerPool::JobType<Handler&>(*this);
+                    } else if (_scheduled != 0) {
+                        // Do not wait for a run in progress, it takes the lock we hold and reschedules anyway.
+                        Core::IWorkerPool::Instance().Revoke(_job->Reset(), 0);
+                    }
+
+                    _scheduled = deadline;
+                    _job->Schedule(Core::Time(deadline));
+                }
+            }
+
         private:
             Core::CriticalSection _adminLock;
             HandlerMap _handlers;
             ObserverMap _observers;
             NotificationFunction _notificationFunction;
             const std::vector<uint8_t> _versions;
+            Core::IWorkerPool::JobType<Handler&>* _job;
+            uint64_t _scheduled;
         };
 
         using Error = Message::Info;
@@ -0,0 +1,98 @@
+/*
+ * If not stated otherwise in this file or this component's LICENSE file the
+ * following copyright and licenses apply:
+ *
+ * Copyright 2020 RDK Management
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "Metrics.h"
+
+namespace WPEFramework {
+namespace Core {
+
+    Metrics::Metrics()
+        : _adminLock()
+        , _entries()
+        , _invokes()
+    {
+    }
+
+    Metrics::~Metrics()
+    {
+    }
+
+    /* static */ Metrics& Metrics::Instance()
+    {
+        return (SingletonType<Metrics>::Instance());
+    }
+
+    Metrics::Entry& Metrics::Find(const string& designator)
+    {
+        _adminLock.Lock();
+
+        std::map<string, Entry>::iterator index(_entries.find(designator));
+
+        if (index == _entries.end()) {
+            index = _entries.emplace(std::piecewise_construct, std::forward_as_tuple(designator), std::forward_as_tuple(designator)).first;
+        }
+
+        Entry& result(index->second);
+
+        _adminLock.Unlock();
+
+        return (result);
+    }
+
+    Metrics::Entry& Metrics::Find(const uint32_t interfaceId, const uint32_t methodId)
+    {
+        const uint64_t key = (static_cast<uint64_t>(interfaceId) << 32) | methodId;
+
+        _adminLock.Lock();
+
+        std::unordered_map<uint64_t, Entry*>::iterator index(_invokes.find(key));
+
+        if (index == _invokes.end()) {
+            TCHAR designator[32];
+
+            ::snprintf(designator, sizeof(designator), _T("0x%08X.%u"), interfaceId, methodId);
+
+            std::map<string, Entry>::iterator entry(_entries.find(designator));
+
+            if (entry == _entries.end()) {
+                entry = _entries.emplace(std::piecewise_construct, std::forward_as_tuple(designator), std::forward_as_tuple(designator)).first;
+            }
+
+            index = _invokes.emplace(key, &(entry->second)).first;
+        }
+
+        Entry& result(*(index->second));
+
+        _adminLock.Unlock();
+
+        return (result);
+    }
+
+    void Metrics::Reset()
+    {
+        _adminLock.Lock();
+
+        for (std::pair<const string, Entry>& entry : _entries) {
+            entry.second.Reset();
+        }
+
+        _adminLock.Unlock();
+    }
+}
+} // namespace WPEFramework::Core
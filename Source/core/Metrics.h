@@ -0,0 +1,153 @@
+/*
+ * If not stated otherwise in this file or this component's LICENSE file the
+ * following copyright and licenses apply:
+ *
+ * Copyright 2020 RDK Management
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "Histogram.h"
+#include "Module.h"
+#include "Portability.h"
+#include "Singleton.h"
+#include "Sync.h"
+
+#include <chrono>
+#include <map>
+#include <unordered_map>
+
+namespace WPEFramework {
+namespace Core {
+
+    // Rationale:
+    // Process wide registry of the calls handled per method (designator), filled by the JSON-RPC dispatch
+    // of the plugins and the COM-RPC stub dispatch. An entry is created on the first call of a method and
+    // lives as long as the registry, so the recording itself only needs the lookup under the lock, the
+    // counters are lock free. A Reset clears the counters, it does not remove the entries.
+    // The registry is per process: the methods of an out-of-process plugin are recorded in the process
+    // that hosts the plugin.
+    class EXTERNAL Metrics {
+    public:
+        // The calls to a single method. Durations are in nanoseconds, the sizes in bytes.
+        class EXTERNAL Entry {
+        public:
+            Entry() = delete;
+            Entry(const Entry&) = delete;
+            Entry& operator=(const Entry&) = delete;
+
+            Entry(const string& designator)
+                : _designator(designator)
+                , _latency()
+                , _errors(0)
+                , _bytesIn(0)
+                , _bytesOut(0)
+            {
+            }
+            ~Entry()
+            {
+            }
+
+        public:
+            inline const string& Designator() const
+            {
+                return (_designator);
+            }
+            inline void Record(const uint64_t duration, const bool failed, const uint32_t bytesIn, const uint32_t bytesOut)
+            {
+                _latency.Record(duration);
+                _bytesIn.fetch_add(bytesIn, std::memory_order_relaxed);
+                _bytesOut.fetch_add(bytesOut, std::memory_order_relaxed);
+
+                if (failed == true) {
+                    _errors.fetch_add(1, std::memory_order_relaxed);
+                }
+            }
+            inline const Histogram& Latency() const
+            {
+                return (_latency);
+            }
+            inline uint64_t Errors() const
+            {
+                return (_errors.load(std::memory_order_relaxed));
+            }
+            inline uint64_t BytesIn() const
+            {
+                return (_bytesIn.load(std::memory_order_relaxed));
+            }
+            inline uint64_t BytesOut() const
+            {
+                return (_bytesOut.load(std::memory_order_relaxed));
+            }
+            void Reset()
+            {
+                _latency.Reset();
+                _errors.store(0, std::memory_order_relaxed);
+                _bytesIn.store(0, std::memory_order_relaxed);
+                _bytesOut.store(0, std::memory_order_relaxed);
+            }
+
+        private:
+            const string _designator;
+            Histogram _latency;
+            std::atomic<uint64_t> _errors;
+            std::atomic<uint64_t> _bytesIn;
+            std::atomic<uint64_t> _bytesOut;
+        };
+
+    private:
+        Metrics();
+        Metrics(const Metrics&) = delete;
+        Metrics& operator=(const Metrics&) = delete;
+
+        friend class SingletonType<Metrics>;
+
+    public:
+        ~Metrics();
+
+        static Metrics& Instance();
+
+    public:
+        // Monotonic time in nanoseconds, the clock the durations are to be measured with.
+        static inline uint64_t Now()
+        {
+            return (static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count()));
+        }
+
+        // JSON-RPC methods, by their designator (<callsign>.<method>).
+        Entry& Find(const string& designator);
+        // COM-RPC methods, by interface and method id. Their designator is <interface id>.<method id>.
+        Entry& Find(const uint32_t interfaceId, const uint32_t methodId);
+
+        template <typename ACTION>
+        void Visit(ACTION&& action) const
+        {
+            _adminLock.Lock();
+
+            for (const std::pair<const string, Entry>& entry : _entries) {
+                action(entry.second);
+            }
+
+            _adminLock.Unlock();
+        }
+        void Reset();
+
+    private:
+        mutable CriticalSection _adminLock;
+        std::map<string, Entry> _entries;
+        std::unordered_map<uint64_t, Entry*> _invokes;
+    };
+}
+} // namespace WPEFramework::Core
@@ -23,6 +23,7 @@
 // ---- Include system wide include files ----
 #include <map>
 #include <memory>
+#include <vector>
 
 // ---- Include local include files ----
 #include "StateTrigger.h"
@@ -571,8 +572,8 @@ namespace Core {
 
             // If it is not the last one, we have to move...
             if (a_Index < m_Current) {
-                // Kill the entry, (again dirty but quick).
-                memcpy(&(m_List[a_Index]), &(m_List[a_Index + 1]), (m_Current - a_Index) * sizeof(IReferenceCounted*));
+                // Kill the entry, the ranges overlap so move, do not copy.
+                memmove(&(m_List[a_Index]), &(m_List[a_Index + 1]), (m_Current - a_Index) * sizeof(IReferenceCounted*));
             }
 
 #ifdef __DEBUG__
@@ -593,8 +594,8 @@ namespace Core {
 
             // If it is not the last one, we have to move...
             if (a_Index < m_Current) {
-                // Kill the entry, (again dirty but quick).
-                memcpy(&(m_List[a_Index]), &(m_List[a_Index + 1]), (m_Current - a_Index) * sizeof(IReferenceCounted*));
+                // Kill the entry, the ranges overlap so move, do not copy.
+                memmove(&(m_List[a_Index]), &(m_List[a_Index + 1]), (m_Current - a_Index) * sizeof(IReferenceCounted*));
             }
 
 #ifdef __DEBUG__
@@ -1040,9 +1041,7 @@ namespace Core {
 
                     baseElement->__Clear<ELEMENT>();
 
-                    Core::ProxyType<ProxyObjectType> returnObject(static_cast<IReferenceCounted*>(baseElement), baseElement);
-
-                    _queue.Return(returnObject);
+                    _queue.Return(*baseElement);
 
                     return (Core::ERROR_DESTRUCTION_SUCCEEDED);
                 }
@@ -1084,16 +1083,21 @@ namespace Core {
 
         ProxyPoolType(const uint32_t initialQueueSize)
             : _createdElements(0)
-            , _queue(initialQueueSize)
+            , _queue()
             , _lock()
         {
+            _queue.reserve(initialQueueSize);
         }
         ~ProxyPoolType()
         {
             // Clear the created objects..
             uint16_t attempt = 500;
             while ((attempt != 0) && (_createdElements != 0)) {
-                if (_queue.Count() == 0) {
+                _lock.Lock();
+
+                if (_queue.empty() == true) {
+                    _lock.Unlock();
+
                     // Give up the slice, we are waiting for ProxyPool 
                     // objects to return.
                     TRACE_L1("Pending ProxyPool objects. Waiting for %d objects.", _createdElements);
@@ -1102,13 +1106,15 @@ namespace Core {
                     attempt--;
                 } 
                 else {
-                    Core::ProxyType<ProxyPoolElement> listLoad;
+                    ProxyPoolElement* element = _queue.back();
 
                     _createdElements--;
 
-                    _queue.Remove(0, listLoad);
+                    _queue.pop_back();
 
-                    listLoad.Destroy();
+                    _lock.Unlock();
+
+                    delete element;
                 }
             }
             if (_createdElements != 0) {
@@ -1120,26 +1126,14 @@ namespace Core {
         Core::ProxyType<PROXYPOOLELEMENT> Element()
         {
             Core::ProxyType<PROXYPOOLELEMENT> result;
+            ProxyPoolElement* element = Reuse();
 
-            _lock.Lock();
-
-            if (_queue.Count() == 0) {
-
-                _createdElements++;
-
-                _lock.Unlock();
-
+            if (element == nullptr) {
                 result = ProxyPoolElement::Create(*this);
 
                 // TRACE_L1("Created a new element for: %s [%p]\n", typeid(PROXYPOOLELEMENT).name(), &static_cast<PROXYPOOLELEMENT&>(*result));
             } else {
-                Core::ProxyType<ProxyPoolElement> listLoad;
-
-                _queue.Remove(0, listLoad);
-
-                _lock.Unlock();
-
-                result = Core::proxy_cast<PROXYPOOLELEMENT>(listLoad);
+                result = Core::ProxyType<PROXYPOOLELEMENT>(static_cast<IReferenceCounted*>(element), element);
 
                 // TRACE_L1("Reused an element for: %s [%p]\n", typeid(PROXYPOOLELEMENT).name(), &static_cast<PROXYPOOLELEMENT&>(*result));
             }
@@ -1150,37 +1144,25 @@ namespace Core {
         Core::ProxyType<PROXYPOOLELEMENT> Element(Arg1 argument1)
         {
             Core::ProxyType<PROXYPOOLELEMENT> result;
+            ProxyPoolElement* element = Reuse();
 
-            _lock.Lock();
-
-            if (_queue.Count() == 0) {
-
-                _createdElements++;
-
-                _lock.Unlock();
-
+            if (element == nullptr) {
                 result = ProxyPoolElement::Create(*this, argument1);
 
                 // TRACE_L1("Created a new element for: %s [%p]\n", typeid(PROXYPOOLELEMENT).name(), &static_cast<PROXYPOOLELEMENT&>(*result));
             } else {
-                Core::ProxyType<ProxyPoolElement> listLoad;
-
-                _queue.Remove(0, listLoad);
-
-                _lock.Unlock();
-
-                result = Core::proxy_cast<PROXYPOOLELEMENT>(listLoad);
+                result = Core::ProxyType<PROXYPOOLELEMENT>(static_cast<IReferenceCounted*>(element), element);
 
                 // TRACE_L1("Reused an element for: %s [%p]\n", typeid(PROXYPOOLELEMENT).name(), &static_cast<PROXYPOOLELEMENT&>(*result));
             }
 
             return (result);
         }
-        void Return(Core::ProxyType<ProxyPoolElement>& element) const
+        void Return(ProxyPoolElement& element) const
         {
             _lock.Lock();
-            // TRACE_L1("Returned an element for: %s [%p]\n", typeid(PROXYPOOLELEMENT).name(), &static_cast<PROXYPOOLELEMENT&>(*element));
-            _queue.Add(element);
+            // TRACE_L1("Returned an element for: %s [%p]\n", typeid(PROXYPOOLELEMENT).name(), &static_cast<PROXYPOOLELEMENT&>(element));
+            _queue.push_back(&element);
             _lock.Unlock();
         }
         inline uint32_t CreatedElements() const
@@ -1189,16 +1171,41 @@ namespace Core {
         }
         inline uint32_t QueuedElements() const
         {
-            return (_queue.Count());
+            return (static_cast<uint32_t>(_queue.size()));
         }
         inline uint32_t CurrentQueueSize() const
         {
-            return (_queue.CurrentQueueSize());
+            return (static_cast<uint32_t>(_queue.capacity()));
+        }
+
+    private:
+        // Rationale:
+        // The pool hands out the element returned last. It is the one most likely still in the cache, and
+        // so are the strings it holds: a cleared element keeps the capacity of its strings, so a request or
+        // response taken from the pool refills its headers without touching the heap. The returned elements
+        // are kept as plain pointers (with a reference count of 0), so taking and returning one is a pointer
+        // pushed or popped under the lock, without reference counting or moving the rest of the list.
+        ProxyPoolElement* Reuse()
+        {
+            ProxyPoolElement* result = nullptr;
+
+            _lock.Lock();
+
+            if (_queue.empty() == true) {
+                _createdElements++;
+            } else {
+                result = _queue.back();
+                _queue.pop_back();
+            }
+
+            _lock.Unlock();
+
+            return (result);
         }
 
     private:
         uint32_t _createdElements;
-        mutable Core::ProxyList<ProxyPoolElement> _queue;
+        mutable std::vector<ProxyPoolElement*> _queue;
         mutable Core::CriticalSection _lock;
     };
 
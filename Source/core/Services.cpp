@@ -38,20 +38,28 @@ namespace Core {
 
     void ServiceAdministrator::Register(IServiceMetadata* service)
     {
+        _adminLock.Lock();
+
         // Only register a service once !!!
         ASSERT(std::find(_services.begin(), _services.end(), service) == _services.end());
 
         _services.push_back(service);
+
+        _adminLock.Unlock();
     }
 
     void ServiceAdministrator::Unregister(IServiceMetadata* service)
     {
+        _adminLock.Lock();
+
         std::list<IServiceMetadata*>::iterator index = std::find(_services.begin(), _services.end(), service);
 
         // Only unregister a service once !!!
         ASSERT(index != _services.end());
 
         _services.erase(index);
+
+        _adminLock.Unlock();
     }
 
     /* static */ ServiceAdministrator& ServiceAdministrator::Instance()
@@ -61,18 +69,28 @@ namespace Core {
 
     void* ServiceAdministrator::Instantiate(const Library& library, const char name[], const uint32_t version, const uint32_t interfaceNumber)
     {
-        bool found = false;
+        IServiceMetadata* metadata = nullptr;
+
+        // Plugins can be activated in parallel, so libraries (and with that services) can come and go while
+        // we look for the service. The creation itself is done outside the lock, a constructor might load
+        // another library. The library reference we got, keeps the found metadata alive.
+        _adminLock.Lock();
+
         std::list<IServiceMetadata*>::iterator index = _services.begin();
 
-        while ((index != _services.end()) && (found == false)) {
+        while ((index != _services.end()) && (metadata == nullptr)) {
             const char* thisName = (*index)->Name().c_str();
-            found = ((strcmp(thisName, name) == 0) && ((version == static_cast<uint32_t>(~0)) || (version == (*index)->Version())));
 
-            if (found == false) {
+            if ((strcmp(thisName, name) == 0) && ((version == static_cast<uint32_t>(~0)) || (version == (*index)->Version()))) {
+                metadata = (*index);
+            } else {
                 index++;
             }
         }
-        return (found == true ? (*index)->Create(library, interfaceNumber) : nullptr);
+
+        _adminLock.Unlock();
+
+        return (metadata != nullptr ? metadata->Create(library, interfaceNumber) : nullptr);
     }
 
     void ServiceAdministrator::ReleaseLibrary(Library& reference)
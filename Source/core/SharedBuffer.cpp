@@ -32,7 +32,7 @@ namespace Core {
     {
     }
 #else
-    SharedBuffer::Semaphore::Semaphore(sem_t* storage)
+    SharedBuffer::Semaphore::Semaphore(SharedSemaphore* storage)
         : _semaphore(storage)
     {
     }
@@ -43,8 +43,6 @@ namespace Core {
         if (_semaphore != nullptr) {
             ::CloseHandle(_semaphore);
         }
-#else
-        sem_destroy(_semaphore);
 #endif
     }
 
@@ -56,12 +54,10 @@ namespace Core {
 
             ASSERT(result != FALSE);
         }
+        return ERROR_NONE;
 #else
-        VARIABLE_IS_NOT_USED int result = sem_post(_semaphore);
-
-        ASSERT((result == 0) || (errno == EOVERFLOW));
+        return (_semaphore->Unlock());
 #endif
-        return ERROR_NONE;
     }
 
     bool SharedBuffer::Semaphore::IsLocked()
@@ -75,9 +71,7 @@ namespace Core {
 
         return (locked);
 #else
-        int semValue = 0;
-        sem_getvalue(_semaphore, &semValue);
-        return (semValue == 0);
+        return (_semaphore->IsLocked());
 #endif
     }
 
@@ -88,43 +82,8 @@ namespace Core {
         if (_semaphore != nullptr) {
             return (::WaitForSingleObjectEx(_semaphore, waitTime, FALSE) == WAIT_OBJECT_0 ? Core::ERROR_NONE : Core::ERROR_TIMEDOUT);
         }
-#elif defined(__APPLE__)
-
-        uint32_t timeLeft = waitTime;
-        int semResult;
-        while (((semResult = sem_trywait(_semaphore)) != 0) && timeLeft > 0) {
-            ::SleepMs(100);
-            if (timeLeft != Core::infinite) {
-                timeLeft -= (timeLeft > 100 ? 100 : timeLeft);
-            }
-        }
-        result = semResult == 0 ? Core::ERROR_NONE : Core::ERROR_TIMEDOUT;
 #else
-
-        struct timespec structTime;
-
-        clock_gettime(CLOCK_REALTIME, &structTime);
-        structTime.tv_nsec += ((waitTime % 1000) * 1000 * 1000); /* remainder, milliseconds to nanoseconds */
-        structTime.tv_sec += (waitTime / 1000) + (structTime.tv_nsec / 1000000000); /* milliseconds to seconds */
-        structTime.tv_nsec = structTime.tv_nsec % 1000000000;
-
-        // MF2018 please note: sem_timedwait is not compatible with CLOCK_MONOTONIC.
-        //                     When used with CLOCK_REALTIME do not use this when the system time can make large jumps (so when Time subsystem is not yet up)
-        do {
-            if (sem_timedwait(_semaphore, &structTime) == 0) {
-                result = Core::ERROR_NONE;
-            }
-            else if ( errno == EINTR ) {
-                continue;
-            }
-            else if ( errno == ETIMEDOUT ) {
-                result = Core::ERROR_TIMEDOUT;
-            }
-            else {
-                ASSERT(false);
-            }
-            break;
-        } while (true);
+        result = _semaphore->Lock(waitTime);
 #endif
         return (result);
     }
@@ -161,8 +120,8 @@ namespace Core {
 #ifndef __WINDOWS__
         memset(_administration, 0, sizeof(Administration));
 
-        sem_init(&(_administration->_producer), 1, 1); /* Initial value is 1. */
-        sem_init(&(_administration->_consumer), 1, 0); /* Initial value is 0. */
+        _administration->_producer.Initialize(1); /* Initial value is 1. */
+        _administration->_consumer.Initialize(0); /* Initial value is 0. */
 #endif
         Align<uint64_t>();
     }
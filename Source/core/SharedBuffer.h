@@ -25,10 +25,7 @@
 // ---- Include local include files ----
 #include "DataElementFile.h"
 #include "Module.h"
-
-#ifndef __WINDOWS__
-#include <semaphore.h>
-#endif
+#include "SharedSync.h"
 
 // ---- Referenced classes and types ----
 
@@ -42,7 +39,8 @@ namespace Core {
     // CyclicBuffer.
     // The rationale behind this buffer is to share buffer space (SharedMemory file) between two
     // porocesses. One process produces data, the othere process consumes it. The signalling
-    // between the two processes is based on a semaphore (binairy semaphore) The Producer creates
+    // between the two processes is based on a semaphore (binairy semaphore), on Linux a futex based
+    // SharedSemaphore living in the administration area. The Producer creates
     // the SharedBuffer object, indicting it has the Producer role. It will automatically own
     // the producer lock. If the producer has placed the data in the buffer and would like the
     // consumer to handle it, it signals this by releasing/unlocking the semaphore.
@@ -55,8 +53,8 @@ namespace Core {
     // The consumer construct should be done with
     // TODO use resize from base class
     //
-    // MF2018, note: usage of this class is currently not supported when the system time can make large
-    //               jumps. Do not use SharedBuffer class when the Time subsystem is not yet available.
+    // Timeouts are measured against a monotonic clock, so this class can also be used when the system
+    // time can make large jumps (e.g. before the Time subsystem is available).
     //
     class EXTERNAL SharedBuffer : public DataElementFile {
     private:
@@ -75,9 +73,7 @@ namespace Core {
 #ifdef __WINDOWS__
             Semaphore(const TCHAR name[]);
 #else
-            Semaphore(sem_t* storage);
-            //Semaphore(sem_t* storage, bool initialize) {
-            //}
+            Semaphore(SharedSemaphore* storage);
 #endif
             ~Semaphore();
 
@@ -90,7 +86,7 @@ namespace Core {
 #ifdef __WINDOWS__
             HANDLE _semaphore;
 #else
-            sem_t* _semaphore;
+            SharedSemaphore* _semaphore;
 #endif
         };
         struct Administration {
@@ -98,8 +94,8 @@ namespace Core {
             uint32_t _bytesWritten;
 
 #ifndef __WINDOWS__
-            sem_t _producer;
-            sem_t _consumer;
+            SharedSemaphore _producer;
+            SharedSemaphore _consumer;
 #endif
         };
 
@@ -0,0 +1,301 @@
+/*
+ * If not stated otherwise in this file or this component's LICENSE file the
+ * following copyright and licenses apply:
+ *
+ * Copyright 2020 RDK Management
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "SharedSync.h"
+
+#include <limits>
+
+#ifndef __APPLE__
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#endif
+
+namespace WPEFramework {
+namespace Core {
+
+    namespace {
+
+        static_assert(sizeof(std::atomic<uint32_t>) == sizeof(uint32_t), "The futex word must be a plain 32 bits integer");
+
+        // Number of attempts, in user space, before a contended waiter is parked in the kernel.
+        constexpr uint16_t SpinCount = 128;
+
+        // A waiter for a SharedMutex wakes up at least this often (in ms) to see if the owner is still alive.
+        constexpr uint32_t LivenessSlice = 100;
+
+        std::atomic<uint32_t> g_processId(0);
+
+        void ForkedChild()
+        {
+            g_processId.store(0, std::memory_order_relaxed);
+        }
+
+        inline void Relax()
+        {
+#if defined(__i386__) || defined(__x86_64__)
+            __builtin_ia32_pause();
+#elif defined(__arm__) || defined(__aarch64__)
+            asm volatile("yield" ::: "memory");
+#endif
+        }
+
+        class Deadline {
+        private:
+            Deadline() = delete;
+            Deadline(const Deadline&) = delete;
+            Deadline& operator=(const Deadline&) = delete;
+
+        public:
+            Deadline(const uint32_t waitTime)
+                : _end(waitTime == Core::infinite ? ~0 : Now() + waitTime)
+            {
+            }
+            ~Deadline()
+            {
+            }
+
+        public:
+            uint32_t Remaining() const
+            {
+                uint32_t result = Core::infinite;
+
+                if (_end != static_cast<uint64_t>(~0)) {
+                    uint64_t now = Now();
+                    result = (now >= _end ? 0 : static_cast<uint32_t>(_end - now));
+                }
+
+                return (result);
+            }
+
+        private:
+            static uint64_t Now()
+            {
+                struct timespec now;
+                clock_gettime(CLOCK_MONOTONIC, &now);
+                return ((static_cast<uint64_t>(now.tv_sec) * 1000) + (now.tv_nsec / 1000000));
+            }
+
+        private:
+            const uint64_t _end;
+        };
+
+        // Returns false if the waitTime expired without anyone waking us.
+        bool FutexWait(std::atomic<uint32_t>& word, const uint32_t expected, const uint32_t waitTime)
+        {
+            bool result = true;
+#ifdef __APPLE__
+            // No futexes available, fall back to polling.
+            if (word.load() == expected) {
+                ::SleepMs(waitTime > 1 ? 1 : waitTime);
+            }
+#else
+            struct timespec timeout;
+            struct timespec* relative = nullptr;
+
+            // A relative FUTEX_WAIT timeout is measured against CLOCK_MONOTONIC.
+            if (waitTime != Core::infinite) {
+                timeout.tv_sec = (waitTime / 1000);
+                timeout.tv_nsec = ((waitTime % 1000) * 1000 * 1000);
+                relative = &timeout;
+            }
+
+            if (::syscall(SYS_futex, reinterpret_cast<uint32_t*>(&word), FUTEX_WAIT, expected, relative, nullptr, 0) != 0) {
+                result = (errno != ETIMEDOUT);
+            }
+#endif
+            return (result);
+        }
+
+        void FutexWake(std::atomic<uint32_t>& word, const int count)
+        {
+#ifndef __APPLE__
+            ::syscall(SYS_futex, reinterpret_cast<uint32_t*>(&word), FUTEX_WAKE, count, nullptr, nullptr, 0);
+#else
+            // The waiters are polling, nothing to wake.
+            (void)word;
+            (void)count;
+#endif
+        }
+
+        bool IsAlive(const uint32_t id)
+        {
+            bool alive = ((::kill(static_cast<pid_t>(id), 0) == 0) || (errno != ESRCH));
+
+#ifndef __APPLE__
+            if (alive == true) {
+                // A process that died, but is not yet reaped by its parent, still exists as a zombie.
+                char path[32];
+                char buffer[256];
+
+                snprintf(path, sizeof(path), "/proc/%u/stat", id);
+
+                FILE* file = fopen(path, "r");
+
+                if (file != nullptr) {
+                    if (fgets(buffer, sizeof(buffer), file) != nullptr) {
+                        // The state follows the process name, which is between braces and could contain a brace itself.
+                        const char* marker = strrchr(buffer, ')');
+
+                        alive = ((marker == nullptr) || ((marker[1] != '\0') && (marker[2] != 'Z') && (marker[2] != 'X')));
+                    }
+                    fclose(file);
+                }
+            }
+#endif
+
+            return (alive);
+        }
+    }
+
+    // ===========================================================================
+    // class SharedMutex
+    // ===========================================================================
+
+    /* static */ uint32_t SharedMutex::Owner()
+    {
+        uint32_t id = g_processId.load(std::memory_order_relaxed);
+
+        if (id == 0) {
+            // getpid() is not cached by the C library (anymore), so keep it around until we fork.
+            static VARIABLE_IS_NOT_USED int registered = pthread_atfork(nullptr, nullptr, ForkedChild);
+
+            id = (static_cast<uint32_t>(::getpid()) & OWNER_MASK);
+            g_processId.store(id, std::memory_order_relaxed);
+        }
+
+        return (id);
+    }
+
+    uint32_t SharedMutex::Contended(const uint32_t owner, const uint32_t waitTime)
+    {
+        uint32_t result = Core::ERROR_TIMEDOUT;
+        uint16_t spin = SpinCount;
+        uint32_t state = _state.load(std::memory_order_relaxed);
+
+        // The locks on a shared administration are typically held for a few instructions, so spin first.
+        while ((spin != 0) && (result != Core::ERROR_NONE)) {
+            if ((state == 0) && (_state.compare_exchange_weak(state, owner, std::memory_order_acquire, std::memory_order_relaxed) == true)) {
+                result = Core::ERROR_NONE;
+            } else {
+                Relax();
+                state = _state.load(std::memory_order_relaxed);
+                spin--;
+            }
+        }
+
+        if (result != Core::ERROR_NONE) {
+            const Deadline deadline(waitTime);
+            uint32_t timeLeft = waitTime;
+            bool expired = false;
+
+            // From here on we might sleep in the kernel, so whoever releases the lock, should wake us. If we
+            // get the lock in this phase, we keep the WAITERS flag set, as there might be more sleepers.
+            while ((result == Core::ERROR_TIMEDOUT) && (timeLeft != 0)) {
+                state = _state.load(std::memory_order_relaxed);
+
+                if ((state & OWNER_MASK) == 0) {
+                    if (_state.compare_exchange_weak(state, owner | WAITERS, std::memory_order_acquire, std::memory_order_relaxed) == true) {
+                        result = Core::ERROR_NONE;
+                    }
+                } else if ((expired == true) && (IsAlive(state & OWNER_MASK) == false)) {
+                    if (_state.compare_exchange_strong(state, owner | WAITERS, std::memory_order_acquire, std::memory_order_relaxed) == true) {
+                        TRACE_L1("Process %u died while holding a shared lock, process %u took it over.", (state & OWNER_MASK), owner);
+                        result = Core::ERROR_PROCESS_TERMINATED;
+                    }
+                } else if (((state & WAITERS) != 0) || (_state.compare_exchange_weak(state, state | WAITERS, std::memory_order_relaxed) == true)) {
+                    expired = (FutexWait(_state, (state | WAITERS), std::min(timeLeft, LivenessSlice)) == false);
+                    timeLeft = deadline.Remaining();
+                }
+            }
+        }
+
+        return (result);
+    }
+
+    void SharedMutex::Wake()
+    {
+        FutexWake(_state, 1);
+    }
+
+    // ===========================================================================
+    // class SharedSemaphore
+    // ===========================================================================
+
+    uint32_t SharedSemaphore::Contended(const uint32_t waitTime)
+    {
+        uint16_t spin = SpinCount;
+        bool locked = false;
+
+        while ((spin != 0) && ((locked = TryLock()) == false)) {
+            Relax();
+            spin--;
+        }
+
+        if (locked == false) {
+            const Deadline deadline(waitTime);
+            uint32_t timeLeft = waitTime;
+
+            // Announce ourselves, so the one that unlocks knows it has to wake us.
+            _waiters.fetch_add(1);
+
+            while (((locked = TryLock()) == false) && (timeLeft != 0)) {
+                FutexWait(_count, 0, timeLeft);
+                timeLeft = deadline.Remaining();
+            }
+
+            _waiters.fetch_sub(1);
+        }
+
+        return (locked == true ? Core::ERROR_NONE : Core::ERROR_TIMEDOUT);
+    }
+
+    void SharedSemaphore::Wake()
+    {
+        FutexWake(_count, 1);
+    }
+
+    // ===========================================================================
+    // class SharedSignal
+    // ===========================================================================
+
+    uint32_t SharedSignal::Wait(const uint32_t sequence, const uint32_t waitTime)
+    {
+        uint32_t timeLeft = waitTime;
+
+        if (_sequence.load(std::memory_order_acquire) == sequence) {
+            const Deadline deadline(waitTime);
+
+            do {
+                FutexWait(_sequence, sequence, timeLeft);
+                timeLeft = deadline.Remaining();
+
+            } while ((timeLeft != 0) && (_sequence.load(std::memory_order_acquire) == sequence));
+        }
+
+        return (timeLeft);
+    }
+
+    void SharedSignal::Signal()
+    {
+        _sequence.fetch_add(1, std::memory_order_release);
+
+        FutexWake(_sequence, std::numeric_limits<int>::max());
+    }
+}
+} // namespace WPEFramework::Core
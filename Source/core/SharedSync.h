@@ -0,0 +1,185 @@
+/*
+ * If not stated otherwise in this file or this component's LICENSE file the
+ * following copyright and licenses apply:
+ *
+ * Copyright 2020 RDK Management
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "Module.h"
+#include "Portability.h"
+#include "Trace.h"
+
+namespace WPEFramework {
+namespace Core {
+
+    // Rationale:
+    // Synchronisation objects that can be placed in memory that is shared between processes, like the
+    // administration area of the SharedBuffer and the CyclicBuffer. On Linux they are build directly
+    // on top of futexes: an uncontended Lock/Unlock is a single atomic operation in user space, a
+    // contended Lock spins for a short while before it is parked in the kernel.
+    // All waiting is measured against CLOCK_MONOTONIC, so jumps in the system time (e.g. the first
+    // NTP sync) do not influence the timeouts.
+    // These objects do not own any resources and have no virtual methods, they are just an overlay
+    // on the shared memory. The creator of the shared memory should call Initialize() once, before
+    // any other process starts using it.
+
+    // ===========================================================================
+    // class SharedMutex
+    // ===========================================================================
+
+    class EXTERNAL SharedMutex {
+    private:
+        SharedMutex() = delete;
+        SharedMutex(const SharedMutex&) = delete;
+        SharedMutex& operator=(const SharedMutex&) = delete;
+
+        static constexpr uint32_t WAITERS = 0x80000000;
+        static constexpr uint32_t OWNER_MASK = 0x3FFFFFFF;
+
+    public:
+        void Initialize()
+        {
+            _state.store(0, std::memory_order_release);
+        }
+
+        // Returns ERROR_NONE or ERROR_TIMEDOUT. If the process that held the lock died while holding it,
+        // the lock is taken over and ERROR_PROCESS_TERMINATED is returned. In that case the caller owns
+        // the lock, but should consider the state protected by it as inconsistent.
+        inline uint32_t Lock(const uint32_t waitTime = Core::infinite)
+        {
+            uint32_t expected = 0;
+            const uint32_t owner = Owner();
+
+            return (_state.compare_exchange_strong(expected, owner, std::memory_order_acquire, std::memory_order_relaxed) == true ? Core::ERROR_NONE : Contended(owner, waitTime));
+        }
+        inline uint32_t Unlock()
+        {
+            uint32_t state = _state.exchange(0, std::memory_order_release);
+
+            ASSERT((state & OWNER_MASK) != 0);
+
+            if ((state & WAITERS) != 0) {
+                Wake();
+            }
+
+            return (Core::ERROR_NONE);
+        }
+        inline bool IsLocked() const
+        {
+            return ((_state.load(std::memory_order_relaxed) & OWNER_MASK) != 0);
+        }
+
+    private:
+        static uint32_t Owner();
+        uint32_t Contended(const uint32_t owner, const uint32_t waitTime);
+        void Wake();
+
+    private:
+        std::atomic<uint32_t> _state;
+    };
+
+    // ===========================================================================
+    // class SharedSemaphore
+    // ===========================================================================
+
+    class EXTERNAL SharedSemaphore {
+    private:
+        SharedSemaphore() = delete;
+        SharedSemaphore(const SharedSemaphore&) = delete;
+        SharedSemaphore& operator=(const SharedSemaphore&) = delete;
+
+    public:
+        void Initialize(const uint32_t initialCount)
+        {
+            _waiters.store(0, std::memory_order_relaxed);
+            _count.store(initialCount, std::memory_order_release);
+        }
+
+        // Returns ERROR_NONE or ERROR_TIMEDOUT.
+        inline uint32_t Lock(const uint32_t waitTime = Core::infinite)
+        {
+            return (TryLock() == true ? Core::ERROR_NONE : Contended(waitTime));
+        }
+        inline uint32_t Unlock()
+        {
+            _count.fetch_add(1);
+
+            if (_waiters.load() != 0) {
+                Wake();
+            }
+
+            return (Core::ERROR_NONE);
+        }
+        inline bool IsLocked() const
+        {
+            return (_count.load(std::memory_order_relaxed) == 0);
+        }
+
+    private:
+        inline bool TryLock()
+        {
+            uint32_t count = _count.load(std::memory_order_relaxed);
+
+            while ((count != 0) && (_count.compare_exchange_weak(count, count - 1, std::memory_order_acquire, std::memory_order_relaxed) == false)) {
+            }
+
+            return (count != 0);
+        }
+        uint32_t Contended(const uint32_t waitTime);
+        void Wake();
+
+    private:
+        std::atomic<uint32_t> _count;
+        std::atomic<uint32_t> _waiters;
+    };
+
+    // ===========================================================================
+    // class SharedSignal
+    // ===========================================================================
+
+    // A SharedSignal is the shared memory equivalent of a condition variable. The waiter takes a
+    // Sequence() snapshot while it still holds the lock that guards the condition, releases that
+    // lock and than waits until the sequence moves on. This way no signal can get lost in between.
+    class EXTERNAL SharedSignal {
+    private:
+        SharedSignal() = delete;
+        SharedSignal(const SharedSignal&) = delete;
+        SharedSignal& operator=(const SharedSignal&) = delete;
+
+    public:
+        void Initialize()
+        {
+            _sequence.store(0, std::memory_order_release);
+        }
+
+        inline uint32_t Sequence() const
+        {
+            return (_sequence.load(std::memory_order_acquire));
+        }
+
+        // Returns the time (in ms) left of the waitTime. If the sequence did not move within
+        // the waitTime, 0 is returned. Core::infinite in, is Core::infinite out.
+        uint32_t Wait(const uint32_t sequence, const uint32_t waitTime);
+
+        // Release all waiters.
+        void Signal();
+
+    private:
+        std::atomic<uint32_t> _sequence;
+    };
+}
+} // namespace WPEFramework::Core
@@ -29,6 +29,7 @@
 #include <arpa/inet.h>
 #include <fcntl.h>
 #include <net/if.h>
+#include <netinet/tcp.h>
 #define __ERRORRESULT__ errno
 #define __ERROR_AGAIN__ EAGAIN
 #define __ERROR_WOULDBLOCK__ EWOULDBLOCK
@@ -294,6 +295,19 @@ namespace Core {
         return (true);
     }
 
+    bool SocketPort::NoDelay(const bool enabled)
+    {
+        uint32_t flag = (enabled ? 1 : 0);
+
+        /* small writes go out immediately, instead of waiting for the acknowledge of what was sent before */
+        if (::setsockopt(m_Socket, IPPROTO_TCP, TCP_NODELAY, reinterpret_cast<char*>(&flag), sizeof(flag)) != 0) {
+            TRACE_L1("Error: Could not set nodelay option on socket, error: %d\n", __ERRORRESULT__);
+            return (false);
+        }
+
+        return (true);
+    }
+
     /* virtual */ bool SocketPort::Initialize()
     {
         return (true);
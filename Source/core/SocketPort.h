@@ -194,6 +194,7 @@ namespace Core {
         uint32_t TTL(const uint8_t value);
 
         bool Broadcast(const bool enabled);
+        bool NoDelay(const bool enabled);
 
         bool Join(const NodeId& multicastAddress);
         bool Leave(const NodeId& multicastAddress);
@@ -171,8 +171,8 @@ namespace Core {
             {
                 return (static_cast<uint32_t>(_clients.size()));
             }
-            template <typename PACKAGE>
-            uint32_t Submit(const uint32_t ID, PACKAGE package)
+            template <typename... PACKAGE>
+            uint32_t Submit(const uint32_t ID, PACKAGE&&... package)
             {
                 uint32_t result = Core::ERROR_UNAVAILABLE;
 
@@ -188,7 +188,7 @@ namespace Core {
                     Core::ProxyType<HANDLECLIENT> client (index->second);
                     _lock.Unlock();
 
-                    client->Submit(package);
+                    client->Submit(std::forward<PACKAGE>(package)...);
                     client.Release();
 
                     result = Core::ERROR_NONE;
@@ -356,10 +356,10 @@ namespace Core {
         {
             _handler.LocalNode(localNode);
         }
-        template <typename PACKAGE>
-        inline uint32_t Submit(const uint32_t ID, PACKAGE package)
+        template <typename... PACKAGE>
+        inline uint32_t Submit(const uint32_t ID, PACKAGE&&... package)
         {
-            return (_handler.Submit(ID, package));
+            return (_handler.Submit(ID, std::forward<PACKAGE>(package)...));
         }
         inline Iterator Clients() const
         {
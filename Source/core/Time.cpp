@@ -764,19 +764,34 @@ namespace Core {
         return (systemTime);
     }
 
+    /* static */ uint64_t Time::MonotonicTicks(const bool coarse)
+    {
+        uint64_t result;
+
+        if (coarse == true) {
+            result = static_cast<uint64_t>(::GetTickCount64()) * MicroSecondsPerMilliSecond;
+        } else {
+            LARGE_INTEGER frequency;
+            LARGE_INTEGER counter;
+
+            ::QueryPerformanceFrequency(&frequency);
+            ::QueryPerformanceCounter(&counter);
+
+            result = ((counter.QuadPart / frequency.QuadPart) * MicroSecondsPerSecond) + (((counter.QuadPart % frequency.QuadPart) * MicroSecondsPerSecond) / frequency.QuadPart);
+        }
+
+        return (result);
+    }
+
 #endif
 
 #ifdef __POSIX__
     Time::Time(const struct timespec& time, bool localTime)
+        : _time()
+        , _ticks((static_cast<uint64_t>(time.tv_sec) * MicroSecondsPerSecond) + (time.tv_nsec / NanoSecondsPerMicroSecond) + OffsetTicksForEpoch)
+        , _localTime(localTime)
+        , _converted(false)
     {
-        if (localTime) {
-            localtime_r(&time.tv_sec, &_time);
-        } else {
-            gmtime_r(&time.tv_sec, &_time);
-        }
-
-        // Calculate ticks..
-        _ticks = (static_cast<uint64_t>(time.tv_sec) * MicroSecondsPerSecond) + (time.tv_nsec / NanoSecondsPerMicroSecond) + OffsetTicksForEpoch;
     }
 
 
@@ -829,6 +844,10 @@ namespace Core {
     }
 
     Time::Time(const uint16_t year, const uint8_t month, const uint8_t day, const uint8_t hour, const uint8_t minute, const uint8_t second, const uint16_t millisecond, const bool localTime)
+        : _time()
+        , _ticks(0)
+        , _localTime(localTime)
+        , _converted(true)
     {
         struct tm source {
         };
@@ -857,25 +876,31 @@ namespace Core {
     }
 
     Time::Time(const struct timeval& info)
+        : _time()
+        , _ticks((static_cast<uint64_t>(info.tv_sec) * static_cast<uint64_t>(MicroSecondsPerSecond)) + static_cast<uint64_t>(info.tv_usec) + OffsetTicksForEpoch)
+        , _localTime(false)
+        , _converted(false)
     {
-        _ticks = (static_cast<uint64_t>(info.tv_sec) * static_cast<uint64_t>(MicroSecondsPerSecond)) + static_cast<uint64_t>(info.tv_usec) + OffsetTicksForEpoch;
-
-        // This is the seconds since 1970...
-        struct tm* ptm = gmtime(&info.tv_sec);
-
-        _time = *ptm;
     }
     Time::Time(const uint64_t time, const bool localTime /*= false*/)
         : _time()
         , _ticks(time)
+        , _localTime(localTime)
+        , _converted(false)
+    {
+    }
+
+    void Time::Convert() const
     {
         // This is the seconds since 1970...
-        time_t epochTimestamp = static_cast<time_t>((time - OffsetTicksForEpoch) / MicroSecondsPerSecond);
+        time_t epochTimestamp = static_cast<time_t>((_ticks - OffsetTicksForEpoch) / MicroSecondsPerSecond);
 
-        if (localTime)
+        if (_localTime)
             localtime_r(&epochTimestamp, &_time);
         else
             gmtime_r(&epochTimestamp, &_time);
+
+        _converted = true;
     }
 
     uint64_t Time::Ticks() const
@@ -885,12 +910,12 @@ namespace Core {
 
     uint8_t Time::DayOfWeek() const
     {
-        return (static_cast<uint8_t>(_time.tm_wday));
+        return (static_cast<uint8_t>(Broken().tm_wday));
     }
 
     uint16_t Time::DayOfYear() const
     {
-        return (static_cast<uint16_t>(_time.tm_yday));
+        return (static_cast<uint16_t>(Broken().tm_yday));
     }
 
     string Time::ToRFC1123(const bool localTime) const
@@ -905,7 +930,7 @@ namespace Core {
         if (localTime != IsLocalTime()) {
             // We need to convert from local to GMT or vv
             time_t epochTimestamp;
-            struct tm originalTime = _time;
+            struct tm originalTime = Broken();
             if (IsLocalTime())
                 epochTimestamp = mktime(&originalTime);
             else
@@ -934,7 +959,7 @@ namespace Core {
         if (localTime != IsLocalTime()) {
             // We need to convert from local to GMT or vv
             time_t epochTimestamp;
-            struct tm originalTime = _time;
+            struct tm originalTime = Broken();
             if (IsLocalTime())
                 epochTimestamp = mktime(&originalTime);
             else
@@ -962,7 +987,7 @@ namespace Core {
         if (localTime != IsLocalTime()) {
             // We need to convert from local to GMT or vv
             time_t epochTimestamp;
-            struct tm originalTime = _time;
+            struct tm originalTime = Broken();
             if (IsLocalTime())
                 epochTimestamp = mktime(&originalTime);
             else
@@ -986,19 +1011,32 @@ namespace Core {
     {
         TCHAR buffer[200];
 
-        _tcsftime(buffer, sizeof(buffer), formatter, &_time);
+        _tcsftime(buffer, sizeof(buffer), formatter, &Broken());
 
         return (string(buffer));
     }
 
     /* static */ Time Time::Now()
     {
-        struct timeval currentTime;
-        gettimeofday(&currentTime, nullptr);
+        struct timespec currentTime;
+        clock_gettime(CLOCK_REALTIME, &currentTime);
 
         return (Time(currentTime));
     }
 
+    /* static */ uint64_t Time::MonotonicTicks(const bool coarse VARIABLE_IS_NOT_USED)
+    {
+        struct timespec currentTime;
+
+#ifdef CLOCK_MONOTONIC_COARSE
+        clock_gettime((coarse == true ? CLOCK_MONOTONIC_COARSE : CLOCK_MONOTONIC), &currentTime);
+#else
+        clock_gettime(CLOCK_MONOTONIC, &currentTime);
+#endif
+
+        return ((static_cast<uint64_t>(currentTime.tv_sec) * MicroSecondsPerSecond) + (currentTime.tv_nsec / NanoSecondsPerMicroSecond));
+    }
+
 #endif
 
     string Time::ToRFC1123() const
@@ -1015,14 +1053,23 @@ namespace Core {
     {
         // Calculate the new time !!
         uint64_t newTime = Ticks() + static_cast<uint64_t>(timeInMilliseconds) * MilliSecondsPerSecond;
+#ifdef __POSIX__
+        // No need to break down this time to find out where the new one should be broken down to.
+        return (operator=(Time(newTime, _localTime)));
+#else
         return (operator=(Time(newTime, IsLocalTime())));
+#endif
     }
 
     Time& Time::Sub(const uint32_t timeInMilliseconds)
     {
         // Calculate the new time !!
         uint64_t newTime = Ticks() - static_cast<uint64_t>(timeInMilliseconds) * MilliSecondsPerSecond;
+#ifdef __POSIX__
+        return (operator=(Time(newTime, _localTime)));
+#else
         return (operator=(Time(newTime, IsLocalTime())));
+#endif
     }
 
     uint64_t Time::NTPTime() const
@@ -76,6 +76,8 @@ namespace Core {
         inline Time()
             : _time()
             , _ticks(0)
+            , _localTime(false)
+            , _converted(true)
         {
         }
         inline bool IsValid() const
@@ -84,9 +86,10 @@ namespace Core {
         }
         inline bool IsLocalTime() const
         {
-            if (_time.tm_zone == nullptr)
+            const struct tm& time(Broken());
+            if (time.tm_zone == nullptr)
                 return false;
-            uint32_t value = (static_cast<uint8_t>(_time.tm_zone[0]) << 16) | (static_cast<uint8_t>(_time.tm_zone[1]) << 8) | (static_cast<uint8_t>(_time.tm_zone[2]) << 0);
+            uint32_t value = (static_cast<uint8_t>(time.tm_zone[0]) << 16) | (static_cast<uint8_t>(time.tm_zone[1]) << 8) | (static_cast<uint8_t>(time.tm_zone[2]) << 0);
             return (value != (('G' << 16) | ('M' << 8) | ('T'))) && (value != (('U' << 16) | ('T' << 8) | ('C')));
         }
 #endif
@@ -95,6 +98,8 @@ namespace Core {
             : _time(copy._time)
 #ifndef __WINDOWS__
             , _ticks(copy._ticks)
+            , _localTime(copy._localTime)
+            , _converted(copy._converted)
 #else
             , _isLocalTime(copy._isLocalTime)
 #endif
@@ -110,6 +115,8 @@ namespace Core {
 
 #ifndef __WINDOWS__
             _ticks = RHS._ticks;
+            _localTime = RHS._localTime;
+            _converted = RHS._converted;
 #else
             _isLocalTime = RHS._isLocalTime;
 #endif
@@ -159,7 +166,7 @@ namespace Core {
 #ifdef __WINDOWS__
             return (static_cast<uint8_t>(_time.wSecond));
 #else
-            return (static_cast<uint8_t>(_time.tm_sec));
+            return (static_cast<uint8_t>(Broken().tm_sec));
 #endif
         }
         inline uint8_t Minutes() const
@@ -167,7 +174,7 @@ namespace Core {
 #ifdef __WINDOWS__
             return (static_cast<uint8_t>(_time.wMinute));
 #else
-            return (static_cast<uint8_t>(_time.tm_min));
+            return (static_cast<uint8_t>(Broken().tm_min));
 #endif
         }
         inline uint8_t Hours() const
@@ -175,7 +182,7 @@ namespace Core {
 #ifdef __WINDOWS__
             return (static_cast<uint8_t>(_time.wHour));
 #else
-            return (static_cast<uint8_t>(_time.tm_hour));
+            return (static_cast<uint8_t>(Broken().tm_hour));
 #endif
         }
         inline uint8_t Day() const
@@ -183,7 +190,7 @@ namespace Core {
 #ifdef __WINDOWS__
             return (static_cast<uint8_t>(_time.wDay));
 #else
-            return (static_cast<uint8_t>(_time.tm_mday));
+            return (static_cast<uint8_t>(Broken().tm_mday));
 #endif
         }
         inline uint8_t Month() const
@@ -191,7 +198,7 @@ namespace Core {
 #ifdef __WINDOWS__
             return (static_cast<uint8_t>(_time.wMonth));
 #else
-            return (static_cast<uint8_t>(_time.tm_mon + 1));
+            return (static_cast<uint8_t>(Broken().tm_mon + 1));
 #endif
         }
         inline uint32_t Year() const
@@ -199,7 +206,7 @@ namespace Core {
 #ifdef __WINDOWS__
             return (static_cast<uint32_t>(_time.wYear));
 #else
-            return (static_cast<uint32_t>(_time.tm_year + 1900));
+            return (static_cast<uint32_t>(Broken().tm_year + 1900));
 #endif
         }
 
@@ -222,6 +229,11 @@ namespace Core {
         string ToTimeOnly(const bool localTime) const;
 
         static Time Now();
+
+        // Microseconds on a clock that is never set (CLOCK_MONOTONIC), counting from an unspecified point
+        // (boot). Use it for intervals and deadlines, they are not moved when the wall clock is stepped
+        // (NTP, the user). The coarse variant is cheaper to read, but only moves once per kernel tick.
+        static uint64_t MonotonicTicks(const bool coarse = false);
         inline static bool FromString(const string& buffer, const bool localTime, Time& element)
         {
             return (element.FromString(buffer, localTime));
@@ -297,7 +309,7 @@ namespace Core {
 #else
         inline const struct tm& Handle() const
         {
-            return (_time);
+            return (Broken());
         }
 #endif
 
@@ -306,8 +318,22 @@ namespace Core {
         mutable SYSTEMTIME _time;
         bool _isLocalTime;
 #else
-        struct tm _time;
+        // Most times are only taken for their ticks (Now() to compare or to schedule), the broken-down
+        // time is only calculated when a part of it is asked for, like the wDayOfWeek on Windows.
+        inline const struct tm& Broken() const
+        {
+            if (_converted == false) {
+                Convert();
+            }
+            return (_time);
+        }
+        void Convert() const;
+
+    private:
+        mutable struct tm _time;
         uint64_t _ticks;
+        bool _localTime;
+        mutable bool _converted;
 #endif
     };
 }
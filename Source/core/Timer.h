@@ -188,12 +188,12 @@ namespace Core {
 
         inline void Schedule(const uint64_t& time, CONTENT&& info)
         {
-            Schedule(TimedInfo<CONTENT>(time, std::move(info)));
+            Schedule(TimedInfo<CONTENT>(Deadline(time), std::move(info)));
         }
 
         inline void Schedule(const uint64_t& time, const CONTENT& info)
         {
-            Schedule(std::move(TimedInfo<CONTENT>(time, info)));
+            Schedule(std::move(TimedInfo<CONTENT>(Deadline(time), info)));
         }
 
     private:
@@ -212,7 +212,7 @@ namespace Core {
 
         void Trigger(const uint64_t& time, const CONTENT& info)
         {
-            TimedInfo<CONTENT> newEntry(time, info);
+            TimedInfo<CONTENT> newEntry(Deadline(time), info);
 
             m_Admin.Lock();
 
@@ -276,7 +276,7 @@ namespace Core {
         uint32_t Process()
         {
             uint32_t delayTime = Core::infinite;
-            uint64_t now = Time::Now().Ticks();
+            uint64_t now = Time::MonotonicTicks();
 
             m_Admin.Lock();
 
@@ -292,14 +292,18 @@ namespace Core {
 
                 m_Admin.Unlock();
 
-                uint64_t reschedule = info.Content().Timed(info.ScheduleTime());
+                // The content still gets (and returns) the time on the wall clock, as it is now.
+                const uint64_t wallNow = Time::Now().Ticks();
+                const uint64_t scheduled = wallNow - std::min(wallNow, Time::MonotonicTicks() - info.ScheduleTime());
+
+                uint64_t reschedule = info.Content().Timed(scheduled);
 
                 m_Admin.Lock();
 
                 if (reschedule != 0) {
-                    ASSERT(reschedule > now);
+                    ASSERT(reschedule > scheduled);
 
-                    info.ScheduleTime(reschedule);
+                    info.ScheduleTime(Deadline(reschedule));
                     ScheduleEntry(std::move(info));
                 }
             }
@@ -309,16 +313,17 @@ namespace Core {
                 m_NextTrigger = NUMBER_MAX_UNSIGNED(uint64_t);
             } else {
                 // Refresh the time, just to be on the safe side...
-                uint64_t delta = Time::Now().Ticks();
+                uint64_t delta = Time::MonotonicTicks();
+                uint64_t wallNow = Time::Now().Ticks();
 
                 if (delta >= m_PendingQueue.front().ScheduleTime()) {
-                    m_NextTrigger = delta;
+                    m_NextTrigger = wallNow;
                     delayTime = 0;
                 } else {
-                    // The windows counter is in 100ns intervals dus we mmoeten even delen door  1000 (us) * 10 ns = 10.000
-                    // om de waarde in ms te krijgen.
-                    m_NextTrigger = m_PendingQueue.front().ScheduleTime();
-                    delayTime = static_cast<uint32_t>((m_NextTrigger - delta) / Time::TicksPerMillisecond);
+                    const uint64_t remaining = m_PendingQueue.front().ScheduleTime() - delta;
+
+                    m_NextTrigger = wallNow + remaining;
+                    delayTime = static_cast<uint32_t>(remaining / Time::TicksPerMillisecond);
                 }
             }
 
@@ -328,6 +333,20 @@ namespace Core {
         }
 
     private:
+        // Rationale:
+        // The times given are on the wall clock, but the wall clock can be stepped (NTP, the user) while
+        // something is pending: back and it would fire that much later, forward and everything pending
+        // fires at once. So what is kept is the time from now, on the monotonic clock, the wall clock
+        // is only read at the moment of scheduling.
+        static uint64_t Deadline(const uint64_t wallTime)
+        {
+            const uint64_t now = Time::MonotonicTicks();
+            const uint64_t wallNow = Time::Now().Ticks();
+
+            // What is in the past keeps its order, but can not go further back than the monotonic start.
+            return (wallTime >= wallNow ? now + (wallTime - wallNow) : now - std::min(now, wallNow - wallTime));
+        }
+
         bool ScheduleEntry(TimedInfo<CONTENT>&& infoBlock)
         {
             bool reevaluate = false;
@@ -23,6 +23,7 @@
 #include "Timer.h"
 #include <atomic>
 #include <functional>
+#include <unordered_map>
 
 namespace WPEFramework {
 
@@ -86,6 +87,9 @@ namespace Core {
 
         virtual ::ThreadId Id(const uint8_t index) const = 0;
         virtual void Submit(const Core::ProxyType<Core::IDispatch>& job) = 0;
+        // Jobs submitted for the same key (e.g. a channel id) are dispatched one at a time, in the order
+        // they were submitted. Jobs for other keys, and jobs submitted without one, still run in parallel.
+        virtual void Submit(const uint32_t key, const Core::ProxyType<Core::IDispatch>& job) = 0;
         virtual void Schedule(const Core::Time& time, const Core::ProxyType<Core::IDispatch>& job) = 0;
         virtual uint32_t Revoke(const Core::ProxyType<Core::IDispatch>& job, const uint32_t waitTime = Core::infinite) = 0;
         virtual void Join() = 0;
@@ -140,6 +144,78 @@ namespace Core {
             IWorkerPool* _pool;
         };
 
+        // Rationale:
+        // A strand is what goes into the queue of the thread pool for a key, not the jobs for that key.
+        // The thread picking it up runs the jobs of the key one by one, till there are none left, so they
+        // never overlap and keep their order, while other threads pick up other strands and jobs. The
+        // strand is not put back in the queue between jobs: a worker blocking on a full queue, while the
+        // other workers do the same, would never see the queue drained.
+        class Strand : public Core::IDispatch {
+        public:
+            Strand() = delete;
+            Strand(const Strand&) = delete;
+            Strand& operator=(const Strand&) = delete;
+
+            Strand(WorkerPool& parent)
+                : _parent(parent)
+                , _key(0)
+                , _jobs()
+                , _current()
+            {
+            }
+            ~Strand() override
+            {
+            }
+
+        public:
+            // All of these are called with the strand lock of the parent taken.
+            uint32_t Key() const
+            {
+                return (_key);
+            }
+            void Key(const uint32_t key)
+            {
+                _key = key;
+            }
+            void Add(const Core::ProxyType<Core::IDispatch>& job)
+            {
+                _jobs.push_back(job);
+            }
+            void Remove(const Core::ProxyType<Core::IDispatch>& job)
+            {
+                _jobs.remove(job);
+            }
+            bool IsRunning(const Core::ProxyType<Core::IDispatch>& job) const
+            {
+                return (_current == job);
+            }
+            Core::ProxyType<Core::IDispatch> Next()
+            {
+                if (_current.IsValid() == true) {
+                    _current.Release();
+                }
+
+                if (_jobs.empty() == false) {
+                    _current = _jobs.front();
+                    _jobs.pop_front();
+                }
+
+                return (_current);
+            }
+
+        private:
+            void Dispatch() override
+            {
+                _parent.Drain(*this);
+            }
+
+        private:
+            WorkerPool& _parent;
+            uint32_t _key;
+            std::list<Core::ProxyType<Core::IDispatch>> _jobs;
+            Core::ProxyType<Core::IDispatch> _current;
+        };
+
     public:
         WorkerPool(const WorkerPool&) = delete;
         WorkerPool& operator=(const WorkerPool&) = delete;
@@ -150,6 +226,9 @@ namespace Core {
             , _timer(1024 * 1024, _T("WorkerPoolType::Timer"))
             , _metadata()
             , _joined(0)
+            , _strandLock()
+            , _strands()
+            , _idleStrands()
         {
             _metadata.Slots = threadCount + 1;
             _metadata.Slot = new uint32_t[threadCount + 1];
@@ -167,6 +246,36 @@ namespace Core {
         {
             _threadPool.Submit(job, Core::infinite);
         }
+        void Submit(const uint32_t key, const Core::ProxyType<Core::IDispatch>& job) override
+        {
+            Core::ProxyType<Strand> strand;
+
+            _strandLock.Lock();
+
+            std::unordered_map<uint32_t, Core::ProxyType<Strand>>::iterator index(_strands.find(key));
+
+            if (index != _strands.end()) {
+                // Already queued or running, it will get to this job.
+                index->second->Add(job);
+            } else {
+                if (_idleStrands.empty() == true) {
+                    strand = Core::ProxyType<Strand>::Create(*this);
+                } else {
+                    strand = _idleStrands.back();
+                    _idleStrands.pop_back();
+                }
+
+                strand->Key(key);
+                strand->Add(job);
+                _strands.emplace(key, strand);
+            }
+
+            _strandLock.Unlock();
+
+            if (strand.IsValid() == true) {
+                _threadPool.Submit(Core::proxy_cast<Core::IDispatch>(strand), Core::infinite);
+            }
+        }
         void Schedule(const Core::Time& time, const Core::ProxyType<Core::IDispatch>& job) override
         {
             _timer.Schedule(time, Timer(this, job));
@@ -179,6 +288,10 @@ namespace Core {
 
             uint32_t outcome = _external.Completed(job, waitTime);
 
+            if (outcome == Core::ERROR_NONE) {
+                outcome = RevokeFromStrands(job, waitTime);
+            }
+
             return (outcome != Core::ERROR_NONE ? outcome : result);
         }
         void Join() override
@@ -227,12 +340,75 @@ namespace Core {
             _threadPool.Queue().Disable();
         }
 
+    private:
+        void Drain(Strand& strand)
+        {
+            _strandLock.Lock();
+
+            Core::ProxyType<Core::IDispatch> job(strand.Next());
+
+            while (job.IsValid() == true) {
+                _strandLock.Unlock();
+
+                job->Dispatch();
+                job.Release();
+
+                _strandLock.Lock();
+
+                job = strand.Next();
+            }
+
+            // Nothing left for this key, the next job for it starts a new strand.
+            std::unordered_map<uint32_t, Core::ProxyType<Strand>>::iterator index(_strands.find(strand.Key()));
+
+            ASSERT(index != _strands.end());
+
+            _idleStrands.push_back(index->second);
+            _strands.erase(index);
+
+            _strandLock.Unlock();
+        }
+        uint32_t RevokeFromStrands(const Core::ProxyType<Core::IDispatch>& job, const uint32_t waitTime)
+        {
+            uint32_t result = Core::ERROR_NONE;
+            const uint64_t deadline = (waitTime == Core::infinite ? NUMBER_MAX_UNSIGNED(uint64_t) : Core::Time::MonotonicTicks() + (static_cast<uint64_t>(waitTime) * Core::Time::TicksPerMillisecond));
+            bool running;
+
+            do {
+                running = false;
+
+                _strandLock.Lock();
+
+                for (std::pair<const uint32_t, Core::ProxyType<Strand>>& entry : _strands) {
+                    entry.second->Remove(job);
+                    running = running || entry.second->IsRunning(job);
+                }
+
+                _strandLock.Unlock();
+
+                if (running == true) {
+                    // Revoking a job that is running is rare, no need to have every strand signal completion.
+                    if (Core::Time::MonotonicTicks() >= deadline) {
+                        result = Core::ERROR_TIMEDOUT;
+                        running = false;
+                    } else {
+                        SleepMs(1);
+                    }
+                }
+            } while (running == true);
+
+            return (result);
+        }
+
     private:
         ThreadPool _threadPool;
         ThreadPool::Minion _external;
         Core::TimerType<Timer> _timer;
         mutable Metadata _metadata;
         ::ThreadId _joined;
+        Core::CriticalSection _strandLock;
+        std::unordered_map<uint32_t, Core::ProxyType<Strand>> _strands;
+        std::vector<Core::ProxyType<Strand>> _idleStrands;
     };
 }
 }
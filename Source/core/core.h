@@ -41,6 +41,7 @@
 
 #include "ASN1.h"
 #include "DoorBell.h"
+#include "CRC32.h"
 #include "CyclicBuffer.h"
 #include "DataBuffer.h"
 #include "DataElement.h"
@@ -49,11 +50,14 @@
 #include "Factory.h"
 #include "FileSystem.h"
 #include "Frame.h"
+#include "Histogram.h"
 #include "IPCMessage.h"
 #include "IPCChannel.h"
 #include "IPCConnector.h"
 #include "ISO639.h"
 #include "JSON.h"
+#include "JSONFlat.h"
+#include "JSONCursor.h"
 #include "JSONRPC.h"
 #include "KeyValue.h"
 #include "Library.h"
@@ -62,6 +66,7 @@
 #include "Measurement.h"
 #include "Media.h"
 #include "MessageException.h"
+#include "Metrics.h"
 #include "Netlink.h"
 #include "NetworkInfo.h"
 #include "Optional.h"
@@ -77,6 +82,7 @@
 #include "Serialization.h"
 #include "Services.h"
 #include "SharedBuffer.h"
+#include "SharedSync.h"
 #include "Singleton.h"
 #include "SocketPort.h"
 #include "SocketServer.h"
@@ -20,9 +20,23 @@
 #include "Channel.h"
 
 namespace WPEFramework {
+
+ENUM_CONVERSION_BEGIN(PluginHost::Channel::overflow)
+
+    { PluginHost::Channel::DROP_OLDEST, _TXT("dropoldest") },
+    { PluginHost::Channel::COALESCE, _TXT("coalesce") },
+    { PluginHost::Channel::DISCONNECT, _TXT("disconnect") },
+
+ENUM_CONVERSION_END(PluginHost::Channel::overflow)
+
 namespace PluginHost {
 
     /* static */ RequestPool Channel::_requestAllocator(10);
+    /* static */ uint32_t Channel::_maxMessages = 0;
+    /* static */ uint32_t Channel::_maxBytes = 0;
+    /* static */ Channel::overflow Channel::_overflow = Channel::DROP_OLDEST;
+    /* static */ uint32_t Channel::_maxRequests = 0;
+    /* static */ uint16_t Channel::_maxPipeline = 0;
 
 #ifdef __WINDOWS__
 #pragma warning(disable : 4355)
@@ -38,7 +52,20 @@ namespace PluginHost {
         , _text()
         , _offset(0)
         , _sendQueue()
+        , _queuedBytes(0)
+        , _dropped(0)
+        , _coalesced(0)
+        , _responseLock()
+        , _requests(0)
+        , _responded(0)
+        , _last(~0)
+        , _completed()
     {
+        if ((remoteId.Type() == Core::NodeId::TYPE_IPV4) || (remoteId.Type() == Core::NodeId::TYPE_IPV6)) {
+            // Responses to pipelined requests are small and go out one by one, do not hold them back until
+            // the client acknowledges the previous one, it might delay that acknowledge.
+            Link().NoDelay(true);
+        }
     }
 #ifdef __WINDOWS__
 #pragma warning(default : 4355)
@@ -48,5 +75,38 @@ namespace PluginHost {
     {
         Close(0);
     }
+
+    void Channel::Submit(const uint32_t sequence, const Core::ProxyType<Web::Response>& entry)
+    {
+        bool close = false;
+
+        _responseLock.Lock();
+
+        if (sequence != _responded) {
+            // A request received before this one is still being handled.
+            _completed.emplace(sequence, entry);
+        } else {
+            std::map<uint32_t, Core::ProxyType<Web::Response>>::iterator index;
+
+            BaseClass::Submit(entry);
+            close = (_responded == _last);
+            _responded++;
+
+            // See if the responses to the requests that came next are already waiting.
+            while ((close == false) && ((index = _completed.find(_responded)) != _completed.end())) {
+                BaseClass::Submit(index->second);
+                close = (_responded == _last);
+                _completed.erase(index);
+                _responded++;
+            }
+        }
+
+        _responseLock.Unlock();
+
+        if (close == true) {
+            // The channel no longer takes new responses and closes as soon as the ones queued are sent.
+            BaseClass::Close(0);
+        }
+    }
 }
 }
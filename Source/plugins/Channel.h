@@ -37,13 +37,19 @@ namespace PluginHost {
             Package& operator=(const Package&) = delete;
 
         public:
-            explicit Package(const Core::ProxyType<Core::JSON::IElement>& json)
+            explicit Package(const Core::ProxyType<Core::JSON::IElement>& json, const uint32_t size, const bool notification, const string& event)
                 : _json(true)
+                , _notification(notification)
+                , _size(size)
+                , _event(event)
                 , _info(json)
             {
             }
-            explicit Package(const string& text) 
+            explicit Package(const string& text, const uint32_t size, const bool notification, const string& event)
                 : _json(false)
+                , _notification(notification)
+                , _size(size)
+                , _event(event)
                 , _info(text)
             {
             }
@@ -65,9 +71,25 @@ namespace PluginHost {
             {
                 return (_info.json);
             }
+            // Notifications may be dropped or coalesced when the queue overflows, responses never are.
+            bool IsNotification() const
+            {
+                return (_notification);
+            }
+            uint32_t Size() const
+            {
+                return (_size);
+            }
+            const string& Event() const
+            {
+                return (_event);
+            }
 
         private:
             bool _json;
+            bool _notification;
+            uint32_t _size;
+            string _event;
             union Info {
                 Info(const Core::ProxyType<Core::JSON::IElement>& value)
                     : json(value)
@@ -92,6 +114,7 @@ namespace PluginHost {
             SerializerImpl(Channel& parent)
                 : _parent(parent)
                 , _current()
+                , _pack(nullptr)
                 , _offset(0)
             {
             }
@@ -104,17 +127,25 @@ namespace PluginHost {
             {
                 return (_current.IsValid() == false);
             }
-            inline uint16_t Serialize(char* stream, const uint16_t length) const {
+            inline uint16_t Serialize(uint8_t* stream, const uint16_t length) const {
                 uint16_t loaded = 0;
 
                 if (_current.IsValid() == false) {
                     _current = Core::ProxyType<const Core::JSON::IElement>(_parent.Element());
+                    _pack = ((_current.IsValid() == true) && (_parent.IsMessagePack() == true) ? dynamic_cast<const Core::JSON::IMessagePack*>(&(*_current)) : nullptr);
+
+                    ASSERT((_pack != nullptr) || (_current.IsValid() == false) || (_parent.IsMessagePack() == false));
                 }
 
                 if (_current.IsValid() == true) {
-                    loaded = _current->Serialize(stream, length, _offset);
+                    if (_pack != nullptr) {
+                        loaded = _pack->Serialize(stream, length, _offset);
+                    } else {
+                        loaded = _current->Serialize(reinterpret_cast<char*>(stream), length, _offset);
+                    }
                     if ( (_offset == 0) || (loaded != length) ) {
                         _current.Release();
+                        _pack = nullptr;
                     }
                 }
 
@@ -124,6 +155,7 @@ namespace PluginHost {
         private:
             Channel& _parent;
             mutable Core::ProxyType<const Core::JSON::IElement> _current;
+            mutable const Core::JSON::IMessagePack* _pack;
             mutable uint16_t _offset;
         };
         class EXTERNAL DeserializerImpl {
@@ -135,6 +167,7 @@ namespace PluginHost {
             DeserializerImpl(Channel& parent)
                 : _parent(parent)
                 , _current()
+                , _pack(nullptr)
                 , _offset(0)
             {
             }
@@ -147,21 +180,27 @@ namespace PluginHost {
             {
                 return (_current.IsValid() == false);
             }
-            inline uint16_t Deserialize(const char* stream, const uint16_t length)
+            inline uint16_t Deserialize(const uint8_t* stream, const uint16_t length)
             {
 			    uint16_t loaded = 0;
 
                 if (_current.IsValid() == false) {
                     if (_parent.IsOpen() == true) {
                         _current = _parent.Element(EMPTY_STRING);
+                        _pack = ((_current.IsValid() == true) && (_parent.IsMessagePack() == true) ? dynamic_cast<Core::JSON::IMessagePack*>(&(*_current)) : nullptr);
                         _offset = 0;
                     }
                 } 
 				if (_current.IsValid() == true) {
-                    loaded = _current->Deserialize(stream, length, _offset);
+                    if (_pack != nullptr) {
+                        loaded = _pack->Deserialize(stream, length, _offset);
+                    } else {
+                        loaded = _current->Deserialize(reinterpret_cast<const char*>(stream), length, _offset);
+                    }
                     if ( (_offset == 0) || (loaded != length)) {
                         _parent.Received(_current);
                         _current.Release();
+                        _pack = nullptr;
                     }
                 }
 
@@ -171,6 +210,7 @@ namespace PluginHost {
         private:
             Channel& _parent;
             Core::ProxyType<Core::JSON::IElement> _current;
+            Core::JSON::IMessagePack* _pack;
             uint16_t _offset;
         };
 
@@ -182,10 +222,18 @@ namespace PluginHost {
             RAW = 0x08,
             TEXT = 0x10,
             JSONRPC = 0x20,
+            MESSAGEPACK = 0x1000, // JSON and JSONRPC messages go out, and come in, as MessagePack in binary frames
             PINGED = 0x4000,
             NOTIFIED = 0x8000
         };
 
+        // What to do with a new message if the send queue is at one of its limits.
+        enum overflow : uint8_t {
+            DROP_OLDEST, // drop the oldest pending notifications to make room
+            COALESCE, // replace a pending notification of the same event, else drop the oldest
+            DISCONNECT // the consumer can not keep up, close the channel
+        };
+
     public:
         Channel() = delete;
         Channel(const Channel& copy) = delete;
@@ -236,37 +284,65 @@ namespace PluginHost {
         {
             return ((_state & NOTIFIED) != 0);
         }
-        inline void Submit(const string& text)
+        inline bool IsMessagePack() const
         {
-            if (IsOpen() == true) {
+            return ((_state & MESSAGEPACK) != 0);
+        }
+        // Number of JSON messages waiting to be sent out over the websocket.
+        inline uint32_t Queued() const
+        {
+            _adminLock.Lock();
 
-                _adminLock.Lock();
+            uint32_t result = static_cast<uint32_t>(_sendQueue.size());
 
-                _sendQueue.emplace_back(text);
+            _adminLock.Unlock();
 
-                bool trigger = (_sendQueue.size() == 1);
+            return (result);
+        }
+        inline uint32_t QueuedBytes() const
+        {
+            _adminLock.Lock();
 
-                _adminLock.Unlock();
+            uint32_t result = _queuedBytes;
 
-                if (trigger == true) {
-                    BaseClass::Trigger();
-                }
+            _adminLock.Unlock();
+
+            return (result);
+        }
+        // Messages that were dropped, or replaced by a newer one of the same event, due to a full send queue.
+        inline uint32_t Dropped() const
+        {
+            return (_dropped);
+        }
+        inline uint32_t Coalesced() const
+        {
+            return (_coalesced);
+        }
+        // The limits of the send queue of every channel, a limit of 0 means unlimited.
+        static void SendQueue(const uint32_t messages, const uint32_t bytes, const overflow policy)
+        {
+            _maxMessages = messages;
+            _maxBytes = bytes;
+            _overflow = policy;
+        }
+        inline void Submit(const string& text, const bool notification = false)
+        {
+            if (IsOpen() == true) {
+                Enqueue(text, static_cast<uint32_t>(text.length()), notification, EMPTY_STRING);
             }
         }
         inline void Submit(const Core::ProxyType<Core::JSON::IElement>& entry)
         {
             if (IsOpen() == true) {
+                const Core::JSONRPC::Message* message = dynamic_cast<const Core::JSONRPC::Message*>(entry.operator->());
 
-                _adminLock.Lock();
-
-                _sendQueue.emplace_back(entry);
-
-                bool trigger = (_sendQueue.size() == 1);
-
-                _adminLock.Unlock();
+                if (message == nullptr) {
+                    Enqueue(entry, NominalSize, false, EMPTY_STRING);
+                } else {
+                    // A message without an id is a notification, the designator tells which event it is.
+                    const uint32_t size = NominalSize + static_cast<uint32_t>(message->Designator.Value().length() + message->Parameters.Value().length() + message->Result.Value().length() + message->Error.Text.Value().length());
 
-                if (trigger == true) {
-                    BaseClass::Trigger();
+                    Enqueue(entry, size, (message->Id.IsSet() == false), message->Designator.Value());
                 }
             }
         }
@@ -274,6 +350,17 @@ namespace PluginHost {
         {
             BaseClass::Submit(entry);
         }
+        // The response to the request that got this sequence number. Pipelined requests are handled in
+        // parallel, the responses go out in the order the requests came in.
+        void Submit(const uint32_t sequence, const Core::ProxyType<Web::Response>& entry);
+        // Limits of a kept alive HTTP connection, a limit of 0 means unlimited. After the given number of
+        // requests the channel closes, once the response to the last one is sent. Requests that find the
+        // given number of requests ahead of them still waiting for a response, are not handled.
+        static void KeepAlive(const uint32_t requests, const uint16_t pipeline)
+        {
+            _maxRequests = requests;
+            _maxPipeline = pipeline;
+        }
         inline void RequestOutbound()
         {
             BaseClass::Trigger();
@@ -292,14 +379,34 @@ namespace PluginHost {
         {
             _adminLock.Unlock();
         }
+        // Numbers the HTTP requests in the order they are received, the response to the request is submitted
+        // with it. The last request this connection takes is the one that asks to close it or the one that
+        // reaches the request limit. Called from the deserializer only, so it does not take the response
+        // lock: that one is held while submitting, which takes the lock of the link.
+        inline uint32_t Sequence(const bool last)
+        {
+            const uint32_t result = _requests++;
+
+            if ((_last == static_cast<uint32_t>(~0)) && ((last == true) || ((_maxRequests != 0) && (_requests >= _maxRequests)))) {
+                _last = result;
+            }
+
+            return (result);
+        }
+        inline bool IsCongested(const uint32_t sequence) const
+        {
+            return ((_maxPipeline != 0) && ((sequence - _responded) >= _maxPipeline));
+        }
         inline void Properties(const uint32_t offset)
         {
             _nameOffset = offset;
         }
-        inline void State(const ChannelState state, const bool notification)
+        inline void State(const ChannelState state, const bool notification, const bool messagePack = false)
         {
-            Binary(state == RAW);
-            _state = state | (notification ? NOTIFIED : 0x0000);
+            ASSERT((messagePack == false) || (state == JSON) || (state == JSONRPC));
+
+            Binary((state == RAW) || (messagePack == true));
+            _state = state | (notification ? NOTIFIED : 0x0000) | (messagePack ? MESSAGEPACK : 0x0000);
         }
         inline uint16_t Serialize(uint8_t* dataFrame, const uint16_t maxSendSize)
         {
@@ -311,12 +418,13 @@ namespace PluginHost {
                 case JSON:
                 case JSONRPC: {
                     // Seems we are sending JSON structs
-                    size = _serializer.Serialize(reinterpret_cast<char*>(dataFrame), maxSendSize);
+                    size = _serializer.Serialize(dataFrame, maxSendSize);
 
                     if (_serializer.IsIdle() == true) {
 
                         // See if there is more to do..
                         _adminLock.Lock();
+                        _queuedBytes -= _sendQueue.front().Size();
                         _sendQueue.pop_front();
                         bool trigger(_sendQueue.size() > 0);
                         _adminLock.Unlock();
@@ -342,6 +450,7 @@ namespace PluginHost {
                         _offset = 0;
 
                         // See if there is more to do..
+                        _queuedBytes -= data.Size();
                         _sendQueue.pop_front();
                     } else {
                         uint16_t addedBytes = maxSendSize - size;
@@ -378,7 +487,7 @@ namespace PluginHost {
             switch (State()) {
             case JSON:
             case JSONRPC: {
-                handled = _deserializer.Deserialize(reinterpret_cast<const char*>(dataFrame), receivedSize);
+                handled = _deserializer.Deserialize(dataFrame, receivedSize);
                 break;
             }
             case TEXT: {
@@ -434,6 +543,84 @@ namespace PluginHost {
         {
             return ((BaseClass::IsWebSocket() == false) || ((_serializer.IsIdle() == true) && (_deserializer.IsIdle() == true)));
         }
+        inline bool Exceeds(const uint32_t messages, const uint32_t bytes) const
+        {
+            return (((_maxMessages != 0) && (messages > _maxMessages)) || ((_maxBytes != 0) && (bytes > _maxBytes)));
+        }
+        // Rationale:
+        // Without limits, one websocket consumer that does not read, subscribed to a chatty event, grows the
+        // memory of the host without bound. The front of the queue is being sent out, so it is never touched,
+        // responses are never dropped: they are bounded by the requests in flight.
+        template <typename PAYLOAD>
+        void Enqueue(const PAYLOAD& payload, const uint32_t size, const bool notification, const string& event)
+        {
+            bool close = false;
+            bool handled = false;
+
+            _adminLock.Lock();
+
+            if (Exceeds(static_cast<uint32_t>(_sendQueue.size()) + 1, _queuedBytes + size) == true) {
+                if (_overflow == DISCONNECT) {
+                    close = true;
+                    _dropped++;
+                } else {
+                    std::list<Package>::iterator index(_sendQueue.begin());
+
+                    if ((_overflow == COALESCE) && (event.empty() == false) && (index != _sendQueue.end())) {
+                        index++;
+                        while ((index != _sendQueue.end()) && ((index->IsNotification() == false) || (index->Event() != event))) {
+                            index++;
+                        }
+                        if (index != _sendQueue.end()) {
+                            // The newest value of the event takes the place of the pending one.
+                            _queuedBytes -= index->Size();
+                            index = _sendQueue.erase(index);
+                            _sendQueue.emplace(index, payload, size, notification, event);
+                            _queuedBytes += size;
+                            _coalesced++;
+                            handled = true;
+                        }
+                        index = _sendQueue.begin();
+                    }
+
+                    if (index != _sendQueue.end()) {
+                        index++;
+                    }
+                    while ((index != _sendQueue.end()) && (Exceeds(static_cast<uint32_t>(_sendQueue.size()) + (handled ? 0 : 1), _queuedBytes + (handled ? 0 : size)) == true)) {
+                        if (index->IsNotification() == true) {
+                            _queuedBytes -= index->Size();
+                            index = _sendQueue.erase(index);
+                            _dropped++;
+                        } else {
+                            index++;
+                        }
+                    }
+
+                    if ((handled == false) && (notification == true) && (Exceeds(static_cast<uint32_t>(_sendQueue.size()) + 1, _queuedBytes + size) == true)) {
+                        // Nothing left to make room for it, so this one is dropped.
+                        handled = true;
+                        _dropped++;
+                    }
+                }
+            }
+
+            bool trigger = false;
+
+            if ((handled == false) && (close == false)) {
+                _sendQueue.emplace_back(payload, size, notification, event);
+                _queuedBytes += size;
+                trigger = (_sendQueue.size() == 1);
+            }
+
+            _adminLock.Unlock();
+
+            if (close == true) {
+                TRACE_L1("The send queue of channel %d overflows, closing it.", _ID);
+                BaseClass::Close(0);
+            } else if (trigger == true) {
+                BaseClass::Trigger();
+            }
+        }
         Core::ProxyType<Core::JSON::IElement> Element() {
             Core::ProxyType<Core::JSON::IElement> result;
 
@@ -458,6 +645,25 @@ namespace PluginHost {
         string _text;
         uint32_t _offset;
         std::list<Package> _sendQueue;
+        uint32_t _queuedBytes;
+        std::atomic<uint32_t> _dropped;
+        std::atomic<uint32_t> _coalesced;
+
+        // Responses that are ready, waiting for the ones to requests received before them.
+        Core::CriticalSection _responseLock;
+        uint32_t _requests;
+        std::atomic<uint32_t> _responded;
+        std::atomic<uint32_t> _last;
+        std::map<uint32_t, Core::ProxyType<Web::Response>> _completed;
+
+        // JSON elements other than JSON-RPC messages are not serialized twice to learn their size, they count
+        // for this many bytes. It is also the framing added to the payload of a JSON-RPC message.
+        static constexpr uint32_t NominalSize = 64;
+        static uint32_t _maxMessages;
+        static uint32_t _maxBytes;
+        static overflow _overflow;
+        static uint32_t _maxRequests;
+        static uint16_t _maxPipeline;
 
         // All requests needed by any instance of this webserver are coming from this web server. They are extracted
         // from a pool. If the request is nolonger needed, the request returns to this pool.
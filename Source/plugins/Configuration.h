@@ -41,6 +41,7 @@ namespace Plugin {
             , WebUI()
             , Precondition()
             , Termination()
+            , Dependencies()
             , Configuration(false)
         {
             Add(_T("callsign"), &Callsign);
@@ -52,6 +53,7 @@ namespace Plugin {
             Add(_T("webui"), &WebUI);
             Add(_T("precondition"), &Precondition);
             Add(_T("termination"), &Termination);
+            Add(_T("dependencies"), &Dependencies);
             Add(_T("configuration"), &Configuration);
         }
         Config(const Config& copy)
@@ -65,6 +67,7 @@ namespace Plugin {
             , WebUI(copy.WebUI)
             , Precondition(copy.Precondition)
             , Termination(copy.Termination)
+            , Dependencies(copy.Dependencies)
             , Configuration(copy.Configuration)
         {
             Add(_T("callsign"), &Callsign);
@@ -76,6 +79,7 @@ namespace Plugin {
             Add(_T("webui"), &WebUI);
             Add(_T("precondition"), &Precondition);
             Add(_T("termination"), &Termination);
+            Add(_T("dependencies"), &Dependencies);
             Add(_T("configuration"), &Configuration);
         }
         ~Config()
@@ -94,6 +98,7 @@ namespace Plugin {
             Configuration = RHS.Configuration;
             Precondition = RHS.Precondition;
             Termination = RHS.Termination;
+            Dependencies = RHS.Dependencies;
 
             return (*this);
         }
@@ -108,6 +113,8 @@ namespace Plugin {
         Core::JSON::String WebUI;
         Core::JSON::ArrayType<Core::JSON::EnumType<PluginHost::ISubSystem::subsystem>> Precondition;
         Core::JSON::ArrayType<Core::JSON::EnumType<PluginHost::ISubSystem::subsystem>> Termination;
+        // Callsigns of the plugins that must be activated before this plugin is activated at startup.
+        Core::JSON::ArrayType<Core::JSON::String> Dependencies;
         Core::JSON::String Configuration;
 
         static Core::NodeId IPV4UnicastNode(const string& ifname);
@@ -56,9 +56,13 @@ namespace PluginHost {
                 : Core::JSON::Container()
                 , Event()
                 , Callsign()
+                , Coalesce(false)
+                , MaxRate(0)
             {
                 Add(_T("event"), &Event);
                 Add(_T("id"), &Callsign);
+                Add(_T("coalesce"), &Coalesce);
+                Add(_T("maxrate"), &MaxRate);
             }
             ~Registration()
             {
@@ -67,6 +71,9 @@ namespace PluginHost {
         public:
             Core::JSON::String Event;
             Core::JSON::String Callsign;
+            // Optional: deliver only the latest value of a burst, and/or at most this many events per second.
+            Core::JSON::Boolean Coalesce;
+            Core::JSON::DecUInt16 MaxRate;
         };
 
         enum state {
@@ -259,6 +266,7 @@ namespace PluginHost {
         }
         Core::ProxyType<Core::JSONRPC::Message> Invoke(const string& token, const uint32_t channelId, const Core::JSONRPC::Message& inbound) override
         {
+            const uint64_t start = Core::Metrics::Now();
             Registration info;
             Core::ProxyType<Core::JSONRPC::Message> response(Message());
             Core::JSONRPC::Handler* source = nullptr;
@@ -290,6 +298,9 @@ namespace PluginHost {
                 case STATE_REGISTRATION:
                     info.FromString(inbound.Parameters.Value());
                     Subscribe(*source, channelId, info.Event.Value(), info.Callsign.Value(), *response);
+                    if ((response->Error.IsSet() == false) && ((info.Coalesce.Value() == true) || (info.MaxRate.Value() != 0))) {
+                        source->Throttle(channelId, info.Event.Value(), info.Callsign.Value(), info.Coalesce.Value(), info.MaxRate.Value());
+                    }
                     break;
                 case STATE_UNREGISTRATION:
                     info.FromString(inbound.Parameters.Value());
@@ -318,6 +329,11 @@ namespace PluginHost {
                 }
             }
 
+            // Only methods that exist are recorded, unknown designators would otherwise grow the metrics.
+            if (source != nullptr) {
+                Record(method, start, inbound, response);
+            }
+
             return response;
         }
 
@@ -363,6 +379,19 @@ namespace PluginHost {
             }
             return (result);
         }
+        void Record(const string& designator, const uint64_t start, const Core::JSONRPC::Message& inbound, const Core::ProxyType<Core::JSONRPC::Message>& response) const
+        {
+            bool failed = false;
+            uint32_t bytesOut = 0;
+
+            // An invalid response is answered asynchronously, only the synchronous part is measured.
+            if (response.IsValid() == true) {
+                failed = response->Error.IsSet();
+                bytesOut = static_cast<uint32_t>(failed == true ? response->Error.Text.Value().length() : response->Result.Value().length());
+            }
+
+            Core::Metrics::Instance().Find(_callsign + _T('.') + Core::JSONRPC::Message::Method(designator)).Record(Core::Metrics::Now() - start, failed, static_cast<uint32_t>(inbound.Parameters.Value().length()), bytesOut);
+        }
         void Notify(const uint32_t id, const string& designator, const string& parameters)
         {
             Core::ProxyType<Core::JSONRPC::Message> message(Message());
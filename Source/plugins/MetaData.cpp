@@ -221,6 +221,97 @@ ENUM_CONVERSION_BEGIN(PluginHost::MetaData::Channel::state)
     {
     }
 
+    MetaData::Timeline::Timeline()
+        : Core::JSON::Container()
+    {
+        Add(_T("callsign"), &Callsign);
+        Add(_T("state"), &JSONState);
+        Add(_T("scheduled"), &Scheduled);
+        Add(_T("started"), &Started);
+        Add(_T("precondition"), &Precondition);
+        Add(_T("load"), &Load);
+        Add(_T("initialize"), &Initialize);
+    }
+    MetaData::Timeline::Timeline(const Timeline& copy)
+        : Core::JSON::Container()
+        , Callsign(copy.Callsign)
+        , JSONState(copy.JSONState)
+        , Scheduled(copy.Scheduled)
+        , Started(copy.Started)
+        , Precondition(copy.Precondition)
+        , Load(copy.Load)
+        , Initialize(copy.Initialize)
+    {
+        Add(_T("callsign"), &Callsign);
+        Add(_T("state"), &JSONState);
+        Add(_T("scheduled"), &Scheduled);
+        Add(_T("started"), &Started);
+        Add(_T("precondition"), &Precondition);
+        Add(_T("load"), &Load);
+        Add(_T("initialize"), &Initialize);
+    }
+    MetaData::Timeline::~Timeline()
+    {
+    }
+
+    MetaData::Metric::Metric()
+        : Core::JSON::Container()
+    {
+        Init();
+    }
+    MetaData::Metric::Metric(const Metric& copy)
+        : Core::JSON::Container()
+        , Designator(copy.Designator)
+        , Calls(copy.Calls)
+        , Errors(copy.Errors)
+        , BytesIn(copy.BytesIn)
+        , BytesOut(copy.BytesOut)
+        , Min(copy.Min)
+        , Average(copy.Average)
+        , P50(copy.P50)
+        , P90(copy.P90)
+        , P99(copy.P99)
+        , Max(copy.Max)
+    {
+        Init();
+    }
+    MetaData::Metric::Metric(const Core::Metrics::Entry& entry)
+        : Core::JSON::Container()
+    {
+        const Core::Histogram& latency(entry.Latency());
+
+        Init();
+
+        Designator = entry.Designator();
+        Calls = latency.Count();
+        Errors = entry.Errors();
+        BytesIn = entry.BytesIn();
+        BytesOut = entry.BytesOut();
+        Min = latency.Min();
+        Average = latency.Average();
+        P50 = latency.Percentile(50);
+        P90 = latency.Percentile(90);
+        P99 = latency.Percentile(99);
+        Max = latency.Max();
+    }
+    MetaData::Metric::~Metric()
+    {
+    }
+    void MetaData::Metric::Init()
+    {
+        Add(_T("designator"), &Designator);
+        Add(_T("calls"), &Calls);
+        Add(_T("errors"), &Errors);
+        Add(_T("bytesin"), &BytesIn);
+        Add(_T("bytesout"), &BytesOut);
+        Add(_T("min"), &Min);
+        Add(_T("average"), &Average);
+        Add(_T("p50"), &P50);
+        Add(_T("p90"), &P90);
+        Add(_T("p99"), &P99);
+        Add(_T("max"), &Max);
+    }
+
     MetaData::Server::Server()
     {
         Core::JSON::Container::Add(_T("threads"), &ThreadPoolRuns);
@@ -237,6 +328,7 @@ ENUM_CONVERSION_BEGIN(PluginHost::MetaData::Channel::state)
         Core::JSON::Container::Add(_T("channel"), &Channels);
         Core::JSON::Container::Add(_T("server"), &Process);
         Core::JSON::Container::Add(_T("bridges"), &Bridges);
+        Core::JSON::Container::Add(_T("timeline"), &Activations);
         Core::JSON::Container::Add(_T("value"), &Value);
         Core::JSON::Container::Add(_T("subsystems"), &SubSystems);
     }
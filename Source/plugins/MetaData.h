@@ -151,6 +151,56 @@ namespace PluginHost {
             Core::JSON::Boolean Secure;
         };
 
+        // How the activation of a plugin at startup went, all times are in microseconds. The scheduled and
+        // started times are relative to the moment the startup began.
+        class EXTERNAL Timeline : public Core::JSON::Container {
+        private:
+            Timeline& operator=(const Timeline&) = delete;
+
+        public:
+            Timeline();
+            Timeline(const Timeline& copy);
+            ~Timeline();
+
+        public:
+            Core::JSON::String Callsign;
+            Service::State JSONState;
+            Core::JSON::DecUInt64 Scheduled;
+            Core::JSON::DecUInt64 Started;
+            Core::JSON::DecUInt64 Precondition;
+            Core::JSON::DecUInt64 Load;
+            Core::JSON::DecUInt64 Initialize;
+        };
+
+        // The calls handled by a JSON-RPC or COM-RPC method, all times are in nanoseconds. The percentiles
+        // are accurate to 1/16th of their value.
+        class EXTERNAL Metric : public Core::JSON::Container {
+        private:
+            Metric& operator=(const Metric&) = delete;
+
+        public:
+            Metric();
+            Metric(const Metric& copy);
+            Metric(const Core::Metrics::Entry& entry);
+            ~Metric();
+
+        public:
+            Core::JSON::String Designator;
+            Core::JSON::DecUInt64 Calls;
+            Core::JSON::DecUInt64 Errors;
+            Core::JSON::DecUInt64 BytesIn;
+            Core::JSON::DecUInt64 BytesOut;
+            Core::JSON::DecUInt64 Min;
+            Core::JSON::DecUInt64 Average;
+            Core::JSON::DecUInt64 P50;
+            Core::JSON::DecUInt64 P90;
+            Core::JSON::DecUInt64 P99;
+            Core::JSON::DecUInt64 Max;
+
+        private:
+            void Init();
+        };
+
         class EXTERNAL Server : public Core::JSON::Container {
         private:
             Server(const Server& copy) = delete;
@@ -213,6 +263,7 @@ namespace PluginHost {
             Channels.Clear();
             Bridges.Clear();
             Process.Clear();
+            Activations.Clear();
         }
 
     public:
@@ -221,6 +272,7 @@ namespace PluginHost {
         Core::JSON::ArrayType<Channel> Channels;
         Core::JSON::ArrayType<Bridge> Bridges;
         Server Process;
+        Core::JSON::ArrayType<Timeline> Activations;
         Core::JSON::String Value;
     };
 }
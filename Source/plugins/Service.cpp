@@ -77,7 +77,7 @@ namespace PluginHost {
             std::list<Channel*>::iterator index(_notifiers.begin());
 
             while (index != _notifiers.end()) {
-                (*index)->Submit(message);
+                (*index)->Submit(message, true);
                 index++;
             }
         }
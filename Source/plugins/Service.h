@@ -287,6 +287,16 @@ namespace PluginHost {
         {
             return (_errorMessage);
         }
+#ifdef RUNTIME_STATISTICS
+        inline uint32_t ProcessedRequests() const
+        {
+            return (_processedRequests);
+        }
+        inline uint32_t ProcessedObjects() const
+        {
+            return (_processedObjects);
+        }
+#endif
         inline void GetMetaData(MetaData::Service& metaData) const
         {
             metaData = _config.Configuration();
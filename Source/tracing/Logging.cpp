@@ -46,7 +46,7 @@ namespace Logging {
     }
 
     /* static */ const char* MODULE_LOGGING = _T("SysLog");
-    static uint64_t _baseTime(Core::Time::Now().Ticks());
+    static uint64_t _baseTime(Core::Time::MonotonicTicks());
     static bool _syslogging = DetectLoggingOutput();
 
     void SysLog(const bool toConsole)
@@ -58,16 +58,14 @@ namespace Logging {
     void SysLog(const char fileName[], const uint32_t lineNumber, const Trace::ITrace* information)
     {
         // Time to printf...
-        Core::Time now(Core::Time::Now());
-
 #ifndef __WINDOWS__
         if (_syslogging == true) {
-            string time(now.ToRFC1123(true));
+            string time(Core::Time::Now().ToRFC1123(true));
             syslog(LOG_NOTICE, "[%s]:[%s:%d]: %s: %s\n", time.c_str(), Core::FileNameOnly(fileName), lineNumber, information->Category(), information->Data());
         } else
 #endif
         {
-            printf("[%11ju us] %s\n", static_cast<uintmax_t>(now.Ticks() - _baseTime), information->Data());
+            printf("[%11ju us] %s\n", static_cast<uintmax_t>(Core::Time::MonotonicTicks() - _baseTime), information->Data());
         }
     }
 
@@ -129,10 +129,13 @@ namespace JSONRPC {
                 ChannelImpl& operator=(const ChannelImpl&) = delete;
     
                 typedef Core::StreamJSONType<Web::WebSocketClientType<Core::SocketStream>, FactoryImpl&, INTERFACE> BaseClass;
+
+                // A MessagePack link negotiates the "jsonrpc+msgpack" subprotocol, the messages go in binary frames.
+                static constexpr bool IsMessagePack = std::is_same<INTERFACE, Core::JSON::IMessagePack>::value;
     
             public:
                 ChannelImpl(CommunicationChannel* parent, const Core::NodeId& remoteNode, const string& callsign, const string& query)
-                    : BaseClass(5, FactoryImpl::Instance(), callsign, _T("JSON"), query, "", false, false, false, remoteNode.AnyInterface(), remoteNode, 256, 256)
+                    : BaseClass(5, FactoryImpl::Instance(), callsign, (IsMessagePack ? _T("jsonrpc+msgpack") : _T("JSON")), query, "", IsMessagePack, false, false, remoteNode.AnyInterface(), remoteNode, 256, 256)
                     , _parent(*parent)
                 {
                 }
@@ -1167,13 +1170,16 @@ namespace JSONRPC {
              ToMessage((INTERFACE*)(&parameters), message);
              return;
         }
+        // Only the envelope is MessagePack, the parameters and the result are carried in it as JSON text, that
+        // is what the handlers on the other side take and return.
         void ToMessage(Core::JSON::IMessagePack* parameters, Core::ProxyType<Core::JSONRPC::Message>& message) const
         {
-             std::vector<uint8_t> values;
-             parameters->ToBuffer(values);
-             if (values.empty() != true) {
-                 string strValues(values.begin(), values.end());
-                 message->Parameters = strValues;
+             Core::JSON::IElement* element = dynamic_cast<Core::JSON::IElement*>(parameters);
+
+             ASSERT(element != nullptr);
+
+             if (element != nullptr) {
+                 ToMessage(element, message);
              }
              return;
         }
@@ -1192,9 +1198,13 @@ namespace JSONRPC {
         }
         void FromMessage(Core::JSON::IMessagePack* response, const Core::JSONRPC::Message& message)
         {
-            string value = message.Result.Value();
-            std::vector<uint8_t> result(value.begin(), value.end());
-            response->FromBuffer(result);
+            Core::JSON::IElement* element = dynamic_cast<Core::JSON::IElement*>(response);
+
+            ASSERT(element != nullptr);
+
+            if (element != nullptr) {
+                FromMessage(element, message);
+            }
         }
 
     private:
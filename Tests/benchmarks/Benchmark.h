@@ -0,0 +1,96 @@
+/*
+ * If not stated otherwise in this file or this component's LICENSE file the
+ * following copyright and licenses apply:
+ *
+ * Copyright 2020 RDK Management
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <core/core.h>
+
+#include <algorithm>
+#include <cinttypes>
+#include <vector>
+
+namespace WPEFramework {
+namespace Benchmarks {
+
+    inline uint64_t Now()
+    {
+        struct timespec now;
+        clock_gettime(CLOCK_MONOTONIC, &now);
+        return ((static_cast<uint64_t>(now.tv_sec) * 1000000000) + now.tv_nsec);
+    }
+
+    // Collects a series of measurements (in nanoseconds) and reports the distribution.
+    class Samples {
+    private:
+        Samples() = delete;
+        Samples(const Samples&) = delete;
+        Samples& operator=(const Samples&) = delete;
+
+    public:
+        Samples(const string& name, const uint32_t expected)
+            : _name(name)
+            , _samples()
+        {
+            _samples.reserve(expected);
+        }
+        ~Samples()
+        {
+        }
+
+    public:
+        inline void Add(const uint64_t nanoSeconds)
+        {
+            _samples.push_back(nanoSeconds);
+        }
+        void Report()
+        {
+            if (_samples.empty() == true) {
+                printf("%-40s: no samples\n", _name.c_str());
+            } else {
+                uint64_t total = 0;
+
+                std::sort(_samples.begin(), _samples.end());
+
+                for (const uint64_t sample : _samples) {
+                    total += sample;
+                }
+
+                printf("%-40s: %8u runs, min %8" PRIu64 " ns, avg %8" PRIu64 " ns, p50 %8" PRIu64 " ns, p99 %8" PRIu64 " ns, max %8" PRIu64 " ns\n",
+                    _name.c_str(),
+                    static_cast<uint32_t>(_samples.size()),
+                    _samples.front(),
+                    total / _samples.size(),
+                    Percentile(50),
+                    Percentile(99),
+                    _samples.back());
+            }
+        }
+
+    private:
+        uint64_t Percentile(const uint8_t percentage) const
+        {
+            return (_samples[((_samples.size() - 1) * percentage) / 100]);
+        }
+
+    private:
+        const string _name;
+        std::vector<uint64_t> _samples;
+    };
+}
+}
@@ -0,0 +1,341 @@
+/*
+ * If not stated otherwise in this file or this component's LICENSE file the
+ * following copyright and licenses apply:
+ *
+ * Copyright 2020 RDK Management
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Throughput of a demux section filter, read like the V4L tuner did (a header read followed by a body
+// read into a private buffer, one section per wake up) compared to the DemuxReader, that drains the
+// device with large reads into a shared buffer and hands out views on the sections in there.
+// Usage: WPEFramework_bench_demux [capture.ts]
+// A pipe stands in for the demux device, a writer thread feeds it all PSI/SI sections found in the
+// capture, or a synthetic set of sections, back to back, like the kernel queues them.
+
+#include <Benchmark.h>
+
+#include <broadcast/broadcast.h>
+#include <broadcast/Demux.h>
+
+#include <fcntl.h>
+#include <map>
+#include <poll.h>
+#include <thread>
+
+using namespace WPEFramework;
+
+namespace {
+
+    const uint16_t PacketSize = 188;
+    const uint16_t Rounds = 50;
+
+    struct Counters {
+        uint32_t Polls;
+        uint32_t Reads;
+        uint32_t Sections;
+        uint32_t Check;
+    };
+
+    void LoadCapture(const string& fileName, std::vector<uint8_t>& stream)
+    {
+        Core::DataElementFile file(fileName, Core::File::USER_READ);
+        std::map<uint16_t, std::vector<uint8_t>> pending;
+
+        const uint8_t* packet = file.Buffer();
+        const uint8_t* end = packet + ((file.Size() / PacketSize) * PacketSize);
+
+        for (; packet < end; packet += PacketSize) {
+            const uint16_t pid = ((packet[1] & 0x1F) << 8) | packet[2];
+            const uint8_t adaptation = ((packet[3] >> 4) & 0x03);
+
+            // Only the PSI/SI pids carry sections.
+            if ((packet[0] != 0x47) || (pid >= 0x20) || ((adaptation & 0x01) == 0)) {
+                continue;
+            }
+
+            std::vector<uint8_t>& section(pending[pid]);
+            uint8_t offset = 4 + ((adaptation & 0x02) != 0 ? packet[4] + 1 : 0);
+
+            if ((packet[1] & 0x40) != 0) {
+                const uint8_t pointer = packet[offset++];
+
+                section.insert(section.end(), &packet[offset], &packet[std::min(offset + pointer, static_cast<int>(PacketSize))]);
+                offset += pointer;
+
+                if (section.size() >= 3) {
+                    const uint16_t length = (((section[1] & 0x0F) << 8) | section[2]) + 3;
+
+                    if (section.size() >= length) {
+                        stream.insert(stream.end(), section.begin(), section.begin() + length);
+                    }
+                }
+                section.clear();
+
+                // Sections can follow each other in the same packet.
+                while (((PacketSize - offset) >= 3) && (packet[offset] != 0xFF)) {
+                    const uint16_t length = (((packet[offset + 1] & 0x0F) << 8) | packet[offset + 2]) + 3;
+
+                    if ((offset + length) > PacketSize) {
+                        break;
+                    }
+
+                    stream.insert(stream.end(), &packet[offset], &packet[offset + length]);
+                    offset += length;
+                }
+            }
+
+            if (offset < PacketSize) {
+                section.insert(section.end(), &packet[offset], &packet[PacketSize]);
+            }
+        }
+    }
+
+    // A mix of small (PAT/PMT/TDT sized) and larger (SDT/EIT sized) sections.
+    void Synthesize(std::vector<uint8_t>& stream)
+    {
+        uint32_t seed = 0x12345678;
+
+        for (uint16_t index = 0; index < 2048; index++) {
+            seed = (seed * 1103515245) + 12345;
+
+            const uint16_t length = ((index % 4) == 0 ? 400 + ((seed >> 8) % 3600) : 16 + ((seed >> 8) % 200));
+            const size_t start = stream.size();
+
+            stream.resize(start + length);
+
+            uint8_t* section = &(stream[start]);
+            section[0] = 0x42 + (index % 16);
+            section[1] = 0xB0 | (((length - 3) >> 8) & 0x0F);
+            section[2] = ((length - 3) & 0xFF);
+
+            for (uint16_t byte = 3; byte < length; byte++) {
+                seed = (seed * 1103515245) + 12345;
+                section[byte] = static_cast<uint8_t>(seed >> 24);
+            }
+        }
+    }
+
+    class Sink : public Broadcast::ISection {
+    private:
+        Sink(const Sink&) = delete;
+        Sink& operator=(const Sink&) = delete;
+
+    public:
+        Sink(Counters& counters)
+            : _counters(counters)
+        {
+        }
+        ~Sink() override
+        {
+        }
+
+    public:
+        void Handle(const Broadcast::MPEG::Section& section) override
+        {
+            _counters.Sections++;
+            _counters.Check += section.TableId() + section.Length();
+        }
+
+    private:
+        Counters& _counters;
+    };
+
+    // The way the MuxFilter of the V4L tuner used to read: a 3 bytes header, than the rest of the
+    // section into a buffer owned by the filter, and back to the ResourceMonitor for the next one.
+    class Legacy {
+    private:
+        Legacy() = delete;
+        Legacy(const Legacy&) = delete;
+        Legacy& operator=(const Legacy&) = delete;
+
+    public:
+        Legacy(Counters& counters)
+            : _counters(counters)
+            , _sink(counters)
+            , _offset(0)
+            , _length(0)
+            , _size(1024)
+            , _buffer(reinterpret_cast<uint8_t*>(::malloc(_size)))
+        {
+        }
+        ~Legacy()
+        {
+            ::free(_buffer);
+        }
+
+    public:
+        void Handle(const int descriptor)
+        {
+            if (_offset < 3) {
+                const int loaded = ::read(descriptor, &(_buffer[_offset]), (3 - _offset));
+                _counters.Reads++;
+
+                if (loaded > 0) {
+                    _offset += loaded;
+
+                    if (_offset == 3) {
+                        _length = ((_buffer[1] & 0x0F) << 8) | _buffer[2];
+
+                        if ((_length + 3) > _size) {
+                            uint8_t header[3] = { _buffer[0], _buffer[1], _buffer[2] };
+                            ::free(_buffer);
+                            _size = _length + 3;
+                            _buffer = reinterpret_cast<uint8_t*>(::malloc(_size));
+                            ::memcpy(_buffer, header, sizeof(header));
+                        }
+                    }
+                }
+            }
+            if (_offset >= 3) {
+                const int loaded = ::read(descriptor, &(_buffer[_offset]), (_length - (_offset - 3)));
+                _counters.Reads++;
+
+                if (loaded > 0) {
+                    _offset += loaded;
+
+                    if ((_offset - 3) == _length) {
+                        _sink.Handle(Broadcast::MPEG::Section(Core::DataElement(_offset, _buffer)));
+                        _offset = 0;
+                    }
+                }
+            }
+        }
+
+    private:
+        Counters& _counters;
+        Sink _sink;
+        uint16_t _offset;
+        uint16_t _length;
+        uint16_t _size;
+        uint8_t* _buffer;
+    };
+
+    class Batched {
+    private:
+        Batched() = delete;
+        Batched(const Batched&) = delete;
+        Batched& operator=(const Batched&) = delete;
+
+    public:
+        Batched(Counters& counters)
+            : _counters(counters)
+            , _sink(counters)
+            , _reader(Core::ProxyType<Core::DataStore>::Create(64 * 1024), &_sink)
+        {
+        }
+        ~Batched()
+        {
+            const Broadcast::DemuxReader::Statistics& statistics(_reader.Counters());
+
+            printf("%-40s: reads %u, sections %u, bytes %" PRIu64 ", dropped %u, overflows %u\n",
+                "DemuxReader counters", statistics.Reads, statistics.Sections, statistics.Bytes, statistics.Dropped, statistics.Overflows);
+        }
+
+    public:
+        void Handle(const int descriptor)
+        {
+            _reader.Read(descriptor);
+            _counters.Reads = _reader.Counters().Reads;
+        }
+
+    private:
+        Counters& _counters;
+        Sink _sink;
+        Broadcast::DemuxReader _reader;
+    };
+
+    template <typename FILTER>
+    void Measure(const string& name, const std::vector<uint8_t>& stream, const uint32_t expected)
+    {
+        Counters counters;
+        int pipes[2];
+
+        ::memset(&counters, 0, sizeof(counters));
+
+        if (::pipe(pipes) != 0) {
+            printf("Could not create a pipe: %d\n", errno);
+        } else {
+#ifdef F_SETPIPE_SZ
+            // A demux device typically queues a few 100KB.
+            ::fcntl(pipes[1], F_SETPIPE_SZ, 256 * 1024);
+#endif
+            ::fcntl(pipes[0], F_SETFL, ::fcntl(pipes[0], F_GETFL) | O_NONBLOCK);
+
+            {
+                FILTER filter(counters);
+
+                const uint64_t start = Benchmarks::Now();
+
+                std::thread writer([&]() {
+                    for (uint16_t round = 0; round < Rounds; round++) {
+                        size_t offset = 0;
+
+                        while (offset < stream.size()) {
+                            const ssize_t written = ::write(pipes[1], &(stream[offset]), stream.size() - offset);
+
+                            if (written > 0) {
+                                offset += written;
+                            }
+                        }
+                    }
+                    ::close(pipes[1]);
+                });
+
+                struct pollfd descriptor = { pipes[0], POLLIN, 0 };
+
+                while ((::poll(&descriptor, 1, 1000) > 0) && ((descriptor.revents & POLLIN) != 0)) {
+                    counters.Polls++;
+                    filter.Handle(pipes[0]);
+                }
+
+                writer.join();
+
+                const uint64_t elapsed = Benchmarks::Now() - start;
+
+                printf("%-40s: %8u sections (%u expected) in %7.2f ms, %10.0f sections/s, %8u polls, %8u reads [check: %08X]\n",
+                    name.c_str(), counters.Sections, expected, elapsed / 1000000.0,
+                    (counters.Sections * 1000000000.0) / elapsed, counters.Polls, counters.Reads, counters.Check);
+            }
+
+            ::close(pipes[0]);
+        }
+    }
+}
+
+int main(int argc, char** argv)
+{
+    std::vector<uint8_t> stream;
+
+    if ((argc > 1) && (argv[1][0] != '\0')) {
+        LoadCapture(argv[1], stream);
+    }
+    if (stream.empty() == true) {
+        Synthesize(stream);
+    }
+
+    uint32_t sections = 0;
+    for (size_t offset = 0; (offset + 3) <= stream.size(); sections++) {
+        offset += (((stream[offset + 1] & 0x0F) << 8) | stream[offset + 2]) + 3;
+    }
+
+    printf("Section stream: %u sections, %u bytes, %u rounds\n", sections, static_cast<uint32_t>(stream.size()), Rounds);
+
+    Measure<Legacy>(_T("Header + body read per section"), stream, sections * Rounds);
+    Measure<Batched>(_T("DemuxReader batched reads"), stream, sections * Rounds);
+
+    Core::Singleton::Dispose();
+
+    return (0);
+}
@@ -0,0 +1,338 @@
+/*
+ * If not stated otherwise in this file or this component's LICENSE file the
+ * following copyright and licenses apply:
+ *
+ * Copyright 2020 RDK Management
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// CPU spend on an EIT schedule carousel, with the version/CRC keyed section cache of MPEG::Tables
+// compared to rebuilding and re-parsing a table each time a section of a complete table comes by.
+// Usage: WPEFramework_bench_sectioncache [capture.ts] [EIT bitrate in kbit/s]
+// With a transport-stream capture, the EIT sections on PID 0x12 form the carousel, without one, a
+// synthetic schedule carousel is generated. The bitrate (default 1000) turns the replayed bytes into
+// seconds of stream.
+
+#include <Benchmark.h>
+
+#include <broadcast/broadcast.h>
+
+#include <map>
+
+using namespace WPEFramework;
+
+namespace {
+
+    const uint16_t PacketSize = 188;
+    const uint16_t EITPid = 0x12;
+    const uint8_t Rounds = 10;
+
+    typedef std::vector<std::vector<uint8_t>> Carousel;
+
+    uint64_t CPUTime()
+    {
+        struct timespec now;
+        clock_gettime(CLOCK_PROCESS_CPUTIME_ID, &now);
+        return ((static_cast<uint64_t>(now.tv_sec) * 1000000000) + now.tv_nsec);
+    }
+
+    bool IsEIT(const uint8_t tableId)
+    {
+        return ((tableId >= 0x4E) && (tableId <= 0x6F));
+    }
+
+    void LoadCapture(const string& fileName, Carousel& carousel)
+    {
+        Core::DataElementFile file(fileName, Core::File::USER_READ);
+        std::vector<uint8_t> section;
+
+        const uint8_t* packet = file.Buffer();
+        const uint8_t* end = packet + ((file.Size() / PacketSize) * PacketSize);
+
+        for (; packet < end; packet += PacketSize) {
+            const uint16_t pid = ((packet[1] & 0x1F) << 8) | packet[2];
+            const uint8_t adaptation = ((packet[3] >> 4) & 0x03);
+
+            if ((packet[0] != 0x47) || (pid != EITPid) || ((adaptation & 0x01) == 0)) {
+                continue;
+            }
+
+            uint8_t offset = 4 + ((adaptation & 0x02) != 0 ? packet[4] + 1 : 0);
+
+            if ((packet[1] & 0x40) != 0) {
+                const uint8_t pointer = packet[offset++];
+
+                section.insert(section.end(), &packet[offset], &packet[std::min(offset + pointer, static_cast<int>(PacketSize))]);
+                offset += pointer;
+
+                if (section.size() >= 3) {
+                    const uint16_t length = (((section[1] & 0x0F) << 8) | section[2]) + 3;
+
+                    if ((IsEIT(section[0]) == true) && (section.size() >= length)) {
+                        carousel.emplace_back(section.begin(), section.begin() + length);
+                    }
+                }
+                section.clear();
+            }
+
+            while (offset < PacketSize) {
+                section.push_back(packet[offset++]);
+            }
+        }
+    }
+
+    void Seal(std::vector<uint8_t>& section)
+    {
+        const uint16_t size = static_cast<uint16_t>(section.size() - 4);
+        const uint32_t crc = Core::CRC32::Calculate(Core::CRC32::InitialValue, section.data(), size);
+
+        section[size + 0] = static_cast<uint8_t>(crc >> 24);
+        section[size + 1] = static_cast<uint8_t>(crc >> 16);
+        section[size + 2] = static_cast<uint8_t>(crc >> 8);
+        section[size + 3] = static_cast<uint8_t>(crc);
+    }
+
+    // 64 services, 2 tables (8 days) each, 16 sections per sub table of up to 4K.
+    void Synthesize(Carousel& carousel)
+    {
+        uint32_t seed = 0x12345678;
+
+        for (uint16_t service = 1; service <= 64; service++) {
+            for (uint8_t tableId = 0x50; tableId <= 0x51; tableId++) {
+                for (uint8_t number = 0; number < 16; number++) {
+                    seed = (seed * 1103515245) + 12345;
+
+                    const uint16_t length = 400 + ((seed >> 8) % 3600);
+                    std::vector<uint8_t> section(length);
+
+                    section[0] = tableId;
+                    section[1] = 0xF0 | (((length - 3) >> 8) & 0x0F);
+                    section[2] = ((length - 3) & 0xFF);
+                    section[3] = (service >> 8);
+                    section[4] = (service & 0xFF);
+                    section[5] = 0xC1;
+                    section[6] = number;
+                    section[7] = 15;
+
+                    for (uint16_t byte = 8; byte < (length - 4); byte++) {
+                        seed = (seed * 1103515245) + 12345;
+                        section[byte] = static_cast<uint8_t>(seed >> 24);
+                    }
+
+                    Seal(section);
+                    carousel.push_back(std::move(section));
+                }
+            }
+        }
+    }
+
+    // Publish a new version of every 16th sub table, as happens when the schedule is updated.
+    uint32_t Update(Carousel& carousel)
+    {
+        uint32_t changed = 0;
+        std::map<uint32_t, bool> subTables;
+
+        for (std::vector<uint8_t>& section : carousel) {
+            const uint32_t key = (section[0] << 16) | (section[3] << 8) | section[4];
+
+            auto entry = subTables.emplace(key, (subTables.size() % 16) == 0);
+
+            if (entry.first->second == true) {
+                const uint8_t version = (((section[5] >> 1) + 1) & 0x1F);
+
+                section[5] = (section[5] & 0xC1) | (version << 1);
+                Seal(section);
+
+                changed += (entry.second == true ? 1 : 0);
+            }
+        }
+
+        return (changed);
+    }
+
+    // Stands in for the DVB parsing of a table, the cost is proportional to the size of the table.
+    uint32_t Parse(const uint8_t data[], const uint32_t length)
+    {
+        uint32_t result = 0;
+
+        for (uint32_t index = 0; index < length; index++) {
+            result = (result * 31) + data[index];
+        }
+
+        return (result);
+    }
+
+    // What the table parsers did before: every section is validated and copied into its table again,
+    // and as soon as the table is complete, every section that comes by causes a full re-parse.
+    class Rebuild {
+    private:
+        Rebuild(const Rebuild&) = delete;
+        Rebuild& operator=(const Rebuild&) = delete;
+
+        struct SubTable {
+            uint8_t Version;
+            uint8_t Filled;
+            std::vector<std::vector<uint8_t>> Sections;
+            std::vector<uint8_t> Data;
+        };
+
+    public:
+        Rebuild()
+            : _tables()
+        {
+        }
+        ~Rebuild()
+        {
+        }
+
+    public:
+        uint32_t Handle(const Broadcast::MPEG::Section& section, uint32_t& check)
+        {
+            uint32_t result = 0;
+
+            if (section.IsValid() == true) {
+                SubTable& table(_tables[(section.TableId() << 16) | section.Extension()]);
+                const Core::DataElement data(section.Data());
+
+                if ((table.Sections.size() != static_cast<uint32_t>(section.LastSectionNumber() + 1)) || (table.Version != section.Version())) {
+                    table.Version = section.Version();
+                    table.Filled = 0;
+                    table.Sections.clear();
+                    table.Sections.resize(section.LastSectionNumber() + 1);
+                }
+
+                std::vector<uint8_t>& slot(table.Sections[section.SectionNumber()]);
+
+                table.Filled += (slot.empty() == true ? 1 : 0);
+                slot.assign(data.Buffer(), data.Buffer() + data.Size());
+
+                if (table.Filled == table.Sections.size()) {
+                    table.Data.clear();
+
+                    for (const std::vector<uint8_t>& entry : table.Sections) {
+                        table.Data.insert(table.Data.end(), entry.begin(), entry.end());
+                    }
+
+                    check += Parse(table.Data.data(), static_cast<uint32_t>(table.Data.size()));
+                    result = 1;
+                }
+            }
+
+            return (result);
+        }
+
+    private:
+        std::map<uint32_t, SubTable> _tables;
+    };
+
+    class Cached {
+    private:
+        Cached(const Cached&) = delete;
+        Cached& operator=(const Cached&) = delete;
+
+    public:
+        Cached()
+            : _tables(4096)
+        {
+        }
+        ~Cached()
+        {
+        }
+
+    public:
+        uint32_t Handle(const Broadcast::MPEG::Section& section, uint32_t& check)
+        {
+            uint32_t result = 0;
+            const Broadcast::MPEG::Table* table = _tables.AddSection(section);
+
+            if (table != nullptr) {
+                check += Parse(table->Data().Buffer(), static_cast<uint32_t>(table->Data().Size()));
+                result = 1;
+            }
+
+            return (result);
+        }
+
+    private:
+        Broadcast::MPEG::Tables _tables;
+    };
+
+    template <typename PARSER>
+    void Measure(const string& name, Carousel carousel, const uint32_t kbps)
+    {
+        PARSER parser;
+        Benchmarks::Samples samples(name + _T(" (per section)"), Rounds * carousel.size());
+        uint64_t bytes = 0;
+        uint64_t cpu = 0;
+        uint32_t check = 0;
+        uint32_t tables = 0;
+        uint32_t changed = 0;
+
+        for (uint8_t round = 0; round < Rounds; round++) {
+            if (round == (Rounds / 2)) {
+                changed = Update(carousel);
+            }
+
+            const uint64_t start = CPUTime();
+
+            for (std::vector<uint8_t>& section : carousel) {
+                const uint64_t begin = Benchmarks::Now();
+                tables += parser.Handle(Broadcast::MPEG::Section(Core::DataElement(section.size(), section.data())), check);
+                samples.Add(Benchmarks::Now() - begin);
+
+                bytes += section.size();
+            }
+
+            cpu += CPUTime() - start;
+        }
+
+        // Every 188 bytes packet carries 184 bytes of payload.
+        const double seconds = (static_cast<double>(bytes) * 188 * 8) / (184.0 * kbps * 1000);
+
+        samples.Report();
+        printf("%-40s: %8u tables parsed (%u sub tables updated), %8.3f ms CPU per second of stream [check: %08X]\n",
+            name.c_str(), tables, changed, (static_cast<double>(cpu) / 1000000.0) / seconds, check);
+    }
+}
+
+int main(int argc, char** argv)
+{
+    Carousel carousel;
+    uint32_t kbps = 1000;
+
+    if ((argc > 1) && (argv[1][0] != '\0')) {
+        LoadCapture(argv[1], carousel);
+    }
+    if (argc > 2) {
+        kbps = std::max(1, atoi(argv[2]));
+    }
+    if (carousel.empty() == true) {
+        Synthesize(carousel);
+    }
+
+    uint64_t bytes = 0;
+    for (const std::vector<uint8_t>& section : carousel) {
+        bytes += section.size();
+    }
+
+    printf("EIT carousel: %u sections, %" PRIu64 " bytes, %u rounds at %u kbit/s\n",
+        static_cast<uint32_t>(carousel.size()), bytes, Rounds, kbps);
+
+    Measure<Rebuild>(_T("Rebuild on every section"), carousel, kbps);
+    Measure<Cached>(_T("MPEG::Tables section cache"), carousel, kbps);
+
+    Core::Singleton::Dispose();
+
+    return (0);
+}
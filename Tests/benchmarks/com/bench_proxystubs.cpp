@@ -0,0 +1,210 @@
+/*
+ * If not stated otherwise in this file or this component's LICENSE file the
+ * following copyright and licenses apply:
+ *
+ * Copyright 2020 RDK Management
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Time and memory it takes a freshly started process (like WPEProcess) to get the ProxyStubs of a
+// directory available: loading all libraries up front, as was done before, compared to the indexed,
+// lazy loading of the RPC::Administrator, with and without a valid index cached.
+// Usage: WPEFramework_bench_proxystubs <proxystub directory> [runs, default 20]
+// Every run is done in a forked child, so it starts, like WPEProcess, with only the core and protocols
+// libraries loaded.
+
+#include <Benchmark.h>
+
+#include <com/com.h>
+
+#include <set>
+
+#include <sys/wait.h>
+
+using namespace WPEFramework;
+
+namespace {
+
+    enum class Mode : uint8_t {
+        EAGER,
+        INDEX_SCAN,
+        INDEX_CACHED
+    };
+
+    struct Result {
+        uint64_t Duration;
+        uint32_t Anonymous;
+        uint32_t Mapped;
+        uint32_t Libraries;
+    };
+
+    // Resident memory in KB, the private (heap, data, relocations) and the file backed (code) part.
+    void ResidentKB(uint32_t& anonymous, uint32_t& mapped)
+    {
+        char line[128];
+        FILE* file = fopen("/proc/self/status", "r");
+
+        anonymous = 0;
+        mapped = 0;
+
+        if (file != nullptr) {
+            while (fgets(line, sizeof(line), file) != nullptr) {
+                if (strncmp(line, "RssAnon:", 8) == 0) {
+                    anonymous = atoi(&line[8]);
+                } else if (strncmp(line, "RssFile:", 8) == 0) {
+                    mapped = atoi(&line[8]);
+                }
+            }
+            fclose(file);
+        }
+    }
+
+    uint32_t LoadedProxyStubs(const string& pathName)
+    {
+        uint32_t result = 0;
+        char line[512];
+        FILE* file = fopen("/proc/self/maps", "r");
+        std::set<string> libraries;
+
+        if (file != nullptr) {
+            while (fgets(line, sizeof(line), file) != nullptr) {
+                const char* name = strstr(line, pathName.c_str());
+
+                if (name != nullptr) {
+                    libraries.insert(string(name));
+                }
+            }
+            fclose(file);
+        }
+
+        result = static_cast<uint32_t>(libraries.size());
+
+        return (result);
+    }
+
+    void RemoveIndex(const string& pathName)
+    {
+        Core::File index(pathName + _T("proxystubs.index"));
+
+        index.Destroy();
+    }
+
+    Result Run(const string& pathName, const Mode mode)
+    {
+        std::list<Core::Library> libraries;
+        Result result;
+        uint32_t anonymous, mapped;
+
+        ResidentKB(anonymous, mapped);
+
+        const uint64_t start = Benchmarks::Now();
+
+        if (mode == Mode::EAGER) {
+            Core::Directory index(pathName.c_str(), _T("*.so"));
+
+            while (index.Next() == true) {
+                Core::Library library(index.Current().c_str());
+
+                if (library.IsLoaded() == true) {
+                    libraries.push_back(library);
+                }
+            }
+        } else {
+            RPC::Administrator::Instance().LoadProxyStubs(pathName);
+        }
+
+        result.Duration = Benchmarks::Now() - start;
+
+        ResidentKB(result.Anonymous, result.Mapped);
+
+        result.Anonymous -= anonymous;
+        result.Mapped -= mapped;
+        result.Libraries = LoadedProxyStubs(pathName);
+
+        return (result);
+    }
+
+    void Measure(const string& name, const string& pathName, const Mode mode, const uint16_t runs)
+    {
+        Benchmarks::Samples samples(name, runs);
+        uint64_t anonymous = 0;
+        uint64_t mapped = 0;
+        uint32_t libraries = 0;
+
+        for (uint16_t run = 0; run < runs; run++) {
+            int channel[2];
+
+            if (mode == Mode::INDEX_SCAN) {
+                RemoveIndex(pathName);
+            }
+
+            if (pipe(channel) == 0) {
+                pid_t child = fork();
+
+                if (child == 0) {
+                    Result result(Run(pathName, mode));
+
+                    close(channel[0]);
+                    if (write(channel[1], &result, sizeof(result)) != sizeof(result)) {
+                        _exit(1);
+                    }
+                    _exit(0);
+                } else if (child > 0) {
+                    Result result;
+
+                    close(channel[1]);
+                    if (read(channel[0], &result, sizeof(result)) == sizeof(result)) {
+                        samples.Add(result.Duration);
+                        anonymous += result.Anonymous;
+                        mapped += result.Mapped;
+                        libraries = result.Libraries;
+                    }
+                    waitpid(child, nullptr, 0);
+                }
+                close(channel[0]);
+            }
+        }
+
+        samples.Report();
+        printf("%-40s: %8u libraries mapped, resident added (avg) %6" PRIu64 " KB private, %6" PRIu64 " KB file backed\n",
+            name.c_str(), libraries, anonymous / runs, mapped / runs);
+    }
+}
+
+int main(int argc, char** argv)
+{
+    if (argc < 2) {
+        printf("Usage: %s <proxystub directory> [runs]\n", argv[0]);
+        return (1);
+    }
+
+    const string pathName(Core::Directory::Normalize(argv[1]));
+    const uint16_t runs = (argc > 2 ? std::max(1, atoi(argv[2])) : 20);
+
+    uint32_t count = 0;
+    Core::Directory index(pathName.c_str(), _T("*.so"));
+    while (index.Next() == true) {
+        count++;
+    }
+
+    printf("ProxyStubs in %s: %u libraries, %u runs\n", pathName.c_str(), count, runs);
+
+    Measure(_T("Load all libraries (before)"), pathName, Mode::EAGER, runs);
+    Measure(_T("Index, scan and store (first start)"), pathName, Mode::INDEX_SCAN, runs);
+    Measure(_T("Index, cached (every next start)"), pathName, Mode::INDEX_CACHED, runs);
+
+    Core::Singleton::Dispose();
+
+    return (0);
+}
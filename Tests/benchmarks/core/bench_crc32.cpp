@@ -0,0 +1,164 @@
+/*
+ * If not stated otherwise in this file or this component's LICENSE file the
+ * following copyright and licenses apply:
+ *
+ * Copyright 2020 RDK Management
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Throughput of the MPEG-2 CRC32 engine compared to the byte-at-a-time table lookup it replaced.
+// Usage: WPEFramework_bench_crc32 [capture.ts]
+// With a transport-stream capture, all PSI/SI sections found in it form the corpus, without one, a
+// synthetic corpus with the section size distribution of an EIT schedule carousel is used.
+
+#include <Benchmark.h>
+
+#include <map>
+
+using namespace WPEFramework;
+
+namespace {
+
+    const uint16_t PacketSize = 188;
+
+    uint32_t ByteWise(uint32_t crc, const uint8_t data[], uint32_t length)
+    {
+        static uint32_t table[256];
+
+        if (table[1] == 0) {
+            for (uint32_t index = 0; index < 256; index++) {
+                uint32_t value = (index << 24);
+                for (uint8_t bit = 0; bit < 8; bit++) {
+                    value = ((value & 0x80000000) != 0 ? (value << 1) ^ 0x04C11DB7 : (value << 1));
+                }
+                table[index] = value;
+            }
+        }
+
+        while (length-- != 0) {
+            crc = (crc << 8) ^ table[((crc >> 24) ^ *data++) & 0xFF];
+        }
+        return (crc);
+    }
+
+    // Reassemble the sections from a transport stream capture, per PID.
+    void LoadCapture(const string& fileName, std::list<std::vector<uint8_t>>& corpus)
+    {
+        Core::DataElementFile file(fileName, Core::File::USER_READ);
+        std::map<uint16_t, std::vector<uint8_t>> pending;
+
+        const uint8_t* packet = file.Buffer();
+        const uint8_t* end = packet + ((file.Size() / PacketSize) * PacketSize);
+
+        for (; packet < end; packet += PacketSize) {
+            const uint16_t pid = ((packet[1] & 0x1F) << 8) | packet[2];
+            const bool start = ((packet[1] & 0x40) != 0);
+            const uint8_t adaptation = ((packet[3] >> 4) & 0x03);
+
+            if ((packet[0] != 0x47) || (pid == 0x1FFF) || ((adaptation & 0x01) == 0)) {
+                continue;
+            }
+
+            uint8_t offset = 4 + ((adaptation & 0x02) != 0 ? packet[4] + 1 : 0);
+            std::vector<uint8_t>& section(pending[pid]);
+
+            if (start == true) {
+                const uint8_t pointer = packet[offset++];
+
+                section.insert(section.end(), &packet[offset], &packet[std::min(offset + pointer, static_cast<int>(PacketSize))]);
+                offset += pointer;
+
+                if (section.size() >= 3) {
+                    const uint16_t length = (((section[1] & 0x0F) << 8) | section[2]) + 3;
+
+                    if (((section[1] & 0x80) != 0) && (section.size() >= length)) {
+                        corpus.emplace_back(section.begin(), section.begin() + length);
+                    }
+                }
+                section.clear();
+            }
+
+            while (offset < PacketSize) {
+                section.push_back(packet[offset++]);
+            }
+        }
+    }
+
+    void Synthesize(std::list<std::vector<uint8_t>>& corpus)
+    {
+        uint32_t seed = 0x12345678;
+
+        for (uint32_t index = 0; index < 4000; index++) {
+            seed = (seed * 1103515245) + 12345;
+
+            // Most carousel sections are small (PAT/PMT/SDT), EIT schedule sections are up to 4K.
+            const uint16_t length = ((seed >> 16) % 4 == 0 ? 1024 + ((seed >> 8) % 3072) : 16 + ((seed >> 8) % 512));
+            std::vector<uint8_t> section(length);
+
+            for (uint16_t byte = 0; byte < length; byte++) {
+                seed = (seed * 1103515245) + 12345;
+                section[byte] = static_cast<uint8_t>(seed >> 24);
+            }
+            corpus.push_back(std::move(section));
+        }
+    }
+
+    template <typename FUNCTION>
+    void Measure(const string& name, const std::list<std::vector<uint8_t>>& corpus, uint64_t bytes, FUNCTION&& function)
+    {
+        const uint8_t Rounds = 20;
+        Benchmarks::Samples samples(name + _T(" (per section)"), Rounds * corpus.size());
+        uint32_t check = 0;
+        uint64_t total = 0;
+
+        for (uint8_t round = 0; round < Rounds; round++) {
+            for (const std::vector<uint8_t>& section : corpus) {
+                const uint64_t start = Benchmarks::Now();
+                check += function(0xFFFFFFFF, section.data(), section.size());
+                const uint64_t elapsed = Benchmarks::Now() - start;
+
+                samples.Add(elapsed);
+                total += elapsed;
+            }
+        }
+
+        samples.Report();
+        printf("%-40s: %8.1f MB/s [check: %08X]\n", name.c_str(), (static_cast<double>(bytes) * Rounds * 1000.0) / total, check);
+    }
+}
+
+int main(int argc, char** argv)
+{
+    std::list<std::vector<uint8_t>> corpus;
+    uint64_t bytes = 0;
+
+    if (argc > 1) {
+        LoadCapture(argv[1], corpus);
+    } else {
+        Synthesize(corpus);
+    }
+
+    for (const std::vector<uint8_t>& section : corpus) {
+        bytes += section.size();
+    }
+
+    printf("Corpus: %u sections, %" PRIu64 " bytes, engine: %s\n", static_cast<uint32_t>(corpus.size()), bytes, Core::CRC32::Engine());
+
+    Measure(_T("Byte wise table lookup"), corpus, bytes, ByteWise);
+    Measure(_T("Core::CRC32"), corpus, bytes, Core::CRC32::Calculate);
+
+    Core::Singleton::Dispose();
+
+    return (0);
+}
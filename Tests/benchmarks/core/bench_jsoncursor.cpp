@@ -0,0 +1,153 @@
+/*
+ * If not stated otherwise in this file or this component's LICENSE file the
+ * following copyright and licenses apply:
+ *
+ * Copyright 2020 RDK Management
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+// Three fields out of a large document: with a VariantContainer (reading the whole document, then the
+// nested objects the fields are in), against the JSON::Cursor path queries.
+// Usage: WPEFramework_bench_jsoncursor [iterations, default 20] [plugins in the large document, default 4000]
+// The document has a member per plugin, the fields are at the start, in the middle and at the end of it.
+// The JSON classes can not read a text of more than 64KB, so they are measured on a document just below
+// that as well, the cursor on both. The heap allocations are counted over the iterations, the fields found
+// have to be the ones in the document.
+
+#include <Benchmark.h>
+
+#include <atomic>
+#include <new>
+
+namespace {
+
+    std::atomic<uint64_t> _allocations(0);
+
+}
+
+void* operator new(size_t size)
+{
+    void* result = ::malloc(size != 0 ? size : 1);
+
+    if (result == nullptr) {
+        throw std::bad_alloc();
+    }
+
+    _allocations.fetch_add(1, std::memory_order_relaxed);
+
+    return (result);
+}
+void operator delete(void* pointer) noexcept
+{
+    ::free(pointer);
+}
+void operator delete(void* pointer, size_t) noexcept
+{
+    ::free(pointer);
+}
+
+using namespace WPEFramework;
+
+namespace {
+
+    struct Fields {
+        string Version;
+        string Callsign;
+        uint32_t Port;
+    };
+
+    string Document(const uint32_t plugins)
+    {
+        string result(_T("{\"version\":\"1.0#14452f612c3747645d54974255d11b8f3b4faa54\""));
+
+        for (uint32_t index = 0; index < plugins; index++) {
+            const string number(Core::NumberType<uint32_t>(index).Text());
+
+            result += _T(",\"Plugin") + number + _T("\":{\"callsign\":\"Plugin") + number + _T("\",\"locator\":\"libWPEFrameworkPlugin") + number + _T(".so\",")
+                _T("\"classname\":\"Plugin") + number + _T("\",\"autostart\":false,\"precondition\":[\"Platform\",\"Network\"],")
+                _T("\"configuration\":{\"root\":{\"mode\":\"Local\",\"user\":\"root\"},\"url\":\"http://127.0.0.1:8080/index.html?id=") + number + _T("\",")
+                _T("\"description\":\"Plugin number ") + number + _T(", \\\"quoted\\\" and {bracketed} [text]\"}}");
+        }
+
+        return (result + _T(",\"tail\":{\"port\":80,\"binding\":\"0.0.0.0\"}}"));
+    }
+
+    template <typename ACTION>
+    void Measure(const TCHAR name[], const uint32_t iterations, const uint32_t size, ACTION&& action)
+    {
+        const uint64_t allocations = _allocations.load();
+        const uint64_t start = Benchmarks::Now();
+
+        for (uint32_t index = 0; index < iterations; index++) {
+            action();
+        }
+
+        const uint64_t duration = (Benchmarks::Now() - start) / iterations;
+
+        printf("  %-18s: %9.1f us per document, %7.1f MB/s, %9.1f allocations\n", name, static_cast<double>(duration) / 1000.0,
+            (static_cast<double>(size) * 1000.0) / static_cast<double>(duration),
+            static_cast<double>(_allocations.load() - allocations) / iterations);
+    }
+
+    bool Found(const Fields& fields, const string& expected)
+    {
+        return ((fields.Version.empty() == false) && (fields.Callsign == expected) && (fields.Port == 80));
+    }
+
+    void Compare(const string& document, const uint32_t plugins, const uint32_t iterations)
+    {
+        const string expected(_T("Plugin") + Core::NumberType<uint32_t>(plugins / 2).Text());
+        const string middle(expected + _T(".callsign"));
+        Fields variant { string(), string(), 0 };
+        Fields cursor { string(), string(), 0 };
+
+        printf("document of %u bytes, looking for version, %s and tail.port\n", static_cast<uint32_t>(document.length()), middle.c_str());
+
+        Measure(_T("VariantContainer"), iterations, static_cast<uint32_t>(document.length()), [&document, &expected, &variant]() {
+            Core::JSON::VariantContainer root;
+
+            root.FromString(document);
+
+            variant.Version = root[_T("version")].String();
+            variant.Callsign = root[expected.c_str()].Object()[_T("callsign")].String();
+            variant.Port = static_cast<uint32_t>(root[_T("tail")].Object()[_T("port")].Number());
+        });
+
+        Measure(_T("Cursor"), iterations, static_cast<uint32_t>(document.length()), [&document, &middle, &cursor]() {
+            Core::JSON::Cursor walker(document);
+
+            walker.Get(_T("version"), cursor.Version);
+            walker.Get(middle.c_str(), cursor.Callsign);
+            walker.Get(_T("tail.port"), cursor.Port);
+        });
+
+        printf("  fields found: VariantContainer %s, Cursor %s\n", (Found(variant, expected) ? _T("yes") : _T("NO")), (Found(cursor, expected) ? _T("yes") : _T("NO")));
+    }
+}
+
+int main(int argc, char** argv)
+{
+    const uint32_t iterations = (argc > 1 ? std::max(1, atoi(argv[1])) : 20);
+    const uint32_t plugins = (argc > 2 ? std::max(1, std::min(60000, atoi(argv[2]))) : 4000);
+
+    printf("%u iterations per measurement\n", iterations);
+
+    Compare(Document(180), 180, iterations * 10);
+    Compare(Document(plugins), plugins, iterations);
+
+    Core::Singleton::Dispose();
+
+    return (0);
+}
@@ -0,0 +1,164 @@
+/*
+ * If not stated otherwise in this file or this component's LICENSE file the
+ * following copyright and licenses apply:
+ *
+ * Copyright 2020 RDK Management
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Overhead, per call, of the per method metrics recorded by PluginHost::JSONRPC::Invoke and
+// RPC::Administrator::Invoke, compared to the dispatch of a trivial JSON-RPC method.
+// Usage: WPEFramework_bench_metrics [threads, default 4]
+// Every sample is a batch of calls, to keep the cost of reading the clock out of the result. The
+// contended runs record the same method from several threads at once.
+
+#include <Benchmark.h>
+
+#include <thread>
+
+using namespace WPEFramework;
+
+namespace {
+
+    constexpr uint32_t Batch = 1000;
+    constexpr uint32_t Batches = 2000;
+
+    const string Callsign(_T("Benchmark"));
+    const string Designator(_T("Benchmark.1.echo"));
+    const string Parameters(_T("{\"value\":42}"));
+
+    class Dispatcher {
+    public:
+        Dispatcher(const Dispatcher&) = delete;
+        Dispatcher& operator=(const Dispatcher&) = delete;
+
+        Dispatcher()
+            : _handler([](const uint32_t, const string&, const string&) {}, { 1 })
+        {
+            _handler.Register(_T("echo"), Core::JSONRPC::InvokeFunction([](const string&, const string& parameters, string& result) -> uint32_t {
+                result = parameters;
+                return (Core::ERROR_NONE);
+            }));
+        }
+        ~Dispatcher()
+        {
+        }
+
+    public:
+        inline uint32_t Invoke(string& response)
+        {
+            return (_handler.Invoke(Core::JSONRPC::Connection(1, 1), Designator, Parameters, response));
+        }
+
+    private:
+        Core::JSONRPC::Handler _handler;
+    };
+
+    // What PluginHost::JSONRPC::Invoke adds to every call of an existing method.
+    inline void RecordJSONRPC(const uint64_t start, const string& response)
+    {
+        Core::Metrics::Instance().Find(Callsign + _T('.') + Core::JSONRPC::Message::Method(Designator)).Record(Core::Metrics::Now() - start, false, static_cast<uint32_t>(Parameters.length()), static_cast<uint32_t>(response.length()));
+    }
+
+    // What RPC::Administrator::Invoke adds to every call.
+    inline void RecordCOMRPC(const uint64_t start)
+    {
+        Core::Metrics::Instance().Find(0x31, 3).Record(Core::Metrics::Now() - start, false, 24, 8);
+    }
+
+    template <typename FUNCTION>
+    void Measure(const string& name, const uint8_t threads, FUNCTION&& function)
+    {
+        Benchmarks::Samples samples(name, Batches * threads);
+        std::vector<std::thread> workers;
+        std::vector<std::vector<uint64_t>> results(threads);
+
+        for (uint8_t thread = 0; thread < threads; thread++) {
+            workers.emplace_back([&function, &results, thread]() {
+                results[thread].reserve(Batches);
+
+                for (uint32_t batch = 0; batch < Batches; batch++) {
+                    const uint64_t start = Benchmarks::Now();
+
+                    for (uint32_t call = 0; call < Batch; call++) {
+                        function();
+                    }
+
+                    results[thread].push_back((Benchmarks::Now() - start) / Batch);
+                }
+            });
+        }
+
+        for (std::thread& worker : workers) {
+            worker.join();
+        }
+        for (const std::vector<uint64_t>& result : results) {
+            for (const uint64_t sample : result) {
+                samples.Add(sample);
+            }
+        }
+
+        samples.Report();
+    }
+}
+
+int main(int argc, char** argv)
+{
+    const uint8_t threads = (argc > 1 ? std::max(1, std::min(atoi(argv[1]), 64)) : 4);
+    Dispatcher dispatcher;
+
+    printf("Per call, in batches of %u calls, %u threads for the contended runs\n", Batch, threads);
+
+    Measure(_T("Clock read (Metrics::Now)"), 1, []() {
+        volatile uint64_t now = Core::Metrics::Now();
+        DEBUG_VARIABLE(now);
+    });
+    Measure(_T("Histogram record"), 1, []() {
+        static Core::Histogram histogram;
+        histogram.Record(48000);
+    });
+    Measure(_T("JSON-RPC dispatch, bare"), 1, [&dispatcher]() {
+        string response;
+        dispatcher.Invoke(response);
+    });
+    Measure(_T("JSON-RPC dispatch, with metrics"), 1, [&dispatcher]() {
+        const uint64_t start = Core::Metrics::Now();
+        string response;
+        dispatcher.Invoke(response);
+        RecordJSONRPC(start, response);
+    });
+    Measure(_T("JSON-RPC metrics only"), 1, []() {
+        RecordJSONRPC(Core::Metrics::Now(), Parameters);
+    });
+    Measure(_T("COM-RPC metrics only"), 1, []() {
+        RecordCOMRPC(Core::Metrics::Now());
+    });
+    Measure(_T("JSON-RPC metrics only, contended"), threads, []() {
+        RecordJSONRPC(Core::Metrics::Now(), Parameters);
+    });
+    Measure(_T("COM-RPC metrics only, contended"), threads, []() {
+        RecordCOMRPC(Core::Metrics::Now());
+    });
+
+    Core::Metrics::Instance().Visit([](const Core::Metrics::Entry& entry) {
+        const Core::Histogram& latency(entry.Latency());
+
+        printf("%-40s: %8" PRIu64 " calls, min %6" PRIu64 " ns, p50 %6" PRIu64 " ns, p99 %6" PRIu64 " ns, max %8" PRIu64 " ns\n",
+            entry.Designator().c_str(), latency.Count(), latency.Min(), latency.Percentile(50), latency.Percentile(99), latency.Max());
+    });
+
+    Core::Singleton::Dispose();
+
+    return (0);
+}
@@ -0,0 +1,124 @@
+/*
+ * If not stated otherwise in this file or this component's LICENSE file the
+ * following copyright and licenses apply:
+ *
+ * Copyright 2020 RDK Management
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+// Size and cost of a JSON-RPC message on the websocket, as JSON text ("jsonrpc") against as MessagePack
+// ("jsonrpc+msgpack"). The parameters and the result are JSON text in both, only the envelope differs.
+// Usage: WPEFramework_bench_msgpack [iterations, default 100000]
+// Every message is written to a reserved buffer and read back into the same (pooled) message object, as
+// the channels do. Before measuring, the message read back from either encoding must be the one written.
+
+#include <Benchmark.h>
+
+using namespace WPEFramework;
+
+namespace {
+
+    template <typename ACTION>
+    uint64_t Measure(const uint32_t iterations, ACTION&& action)
+    {
+        const uint64_t start = Benchmarks::Now();
+
+        for (uint32_t index = 0; index < iterations; index++) {
+            action();
+        }
+
+        return ((Benchmarks::Now() - start) / iterations);
+    }
+
+    void Compare(const TCHAR name[], const Core::JSONRPC::Message& message, const uint32_t iterations)
+    {
+        Core::JSONRPC::Message received;
+        std::vector<uint8_t> buffer;
+        string text;
+        string check;
+
+        message.ToString(text);
+        message.ToBuffer(buffer);
+
+        received.FromString(text);
+        received.ToString(check);
+        const bool textSame = (check == text);
+
+        received.FromBuffer(buffer);
+        received.ToString(check);
+        const bool packSame = (check == text);
+
+        const uint64_t textWrite = Measure(iterations, [&message, &text]() { message.ToString(text); });
+        const uint64_t textRead = Measure(iterations, [&received, &text]() { received.FromString(text); });
+        const uint64_t packWrite = Measure(iterations, [&message, &buffer]() { message.ToBuffer(buffer); });
+        const uint64_t packRead = Measure(iterations, [&received, &buffer]() { received.FromBuffer(buffer); });
+
+        printf("%s%s\n", name, ((textSame == true) && (packSame == true) ? _T("") : _T(" (NOT THE SAME MESSAGE)")));
+        printf("  %-10s: %6u bytes, write %6" PRIu64 " ns, read %6" PRIu64 " ns\n", _T("text"), static_cast<uint32_t>(text.length()), textWrite, textRead);
+        printf("  %-10s: %6u bytes, write %6" PRIu64 " ns, read %6" PRIu64 " ns\n", _T("msgpack"), static_cast<uint32_t>(buffer.size()), packWrite, packRead);
+    }
+}
+
+int main(int argc, char** argv)
+{
+    const uint32_t iterations = (argc > 1 ? std::max(1, atoi(argv[1])) : 100000);
+
+    printf("%u iterations per measurement\n", iterations);
+
+    {
+        Core::JSONRPC::Message message;
+        message.Id = 1042;
+        message.Designator = _T("Controller.1.activate");
+        message.Parameters = _T("{\"callsign\":\"DeviceInfo\"}");
+        Compare(_T("request"), message, iterations);
+    }
+    {
+        Core::JSONRPC::Message message;
+        message.Id = 1042;
+        message.Result = _T("null");
+        Compare(_T("response, no result"), message, iterations);
+    }
+    {
+        Core::JSONRPC::Message message;
+        message.Id = 1042;
+        message.Error.SetError(Core::ERROR_UNKNOWN_KEY);
+        message.Error.Text = _T("Unknown method.");
+        Compare(_T("response, error"), message, iterations);
+    }
+    {
+        Core::JSONRPC::Message message;
+        message.Designator = _T("client.events.1.statechange");
+        message.Parameters = _T("{\"callsign\":\"WebKitBrowser\",\"state\":\"activated\",\"reason\":\"Requested\"}");
+        Compare(_T("notification"), message, iterations);
+    }
+    {
+        Core::JSONRPC::Message message;
+        string result(_T("["));
+
+        for (uint8_t index = 0; index < 40; index++) {
+            result += (index != 0 ? _T(",") : _T(""));
+            result += _T("{\"callsign\":\"Plugin") + Core::NumberType<uint8_t>(index).Text() + _T("\",\"state\":\"deactivated\",\"autostart\":false}");
+        }
+        result += _T("]");
+
+        message.Id = 1042;
+        message.Result = result;
+        Compare(_T("response, 2.5KB result"), message, iterations / 10);
+    }
+
+    Core::Singleton::Dispose();
+
+    return (0);
+}
@@ -0,0 +1,192 @@
+/*
+ * If not stated otherwise in this file or this component's LICENSE file the
+ * following copyright and licenses apply:
+ *
+ * Copyright 2020 RDK Management
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// CPU and bandwidth of a 1 kHz event source with 100 subscribers, delivered through Core::JSONRPC::Handler
+// as is, coalesced and/or rate limited per observer.
+// Usage: WPEFramework_bench_notify [seconds, default 3] [subscribers, default 100]
+// Every delivery builds and serializes the JSON-RPC message, as PluginHost does before it goes out on the
+// channel, so the CPU time is what the host spends on the event. The bandwidth is the serialized size.
+
+#include <Benchmark.h>
+
+#include <time.h>
+
+using namespace WPEFramework;
+
+namespace {
+
+    constexpr uint32_t RateHz = 1000;
+
+    class Position : public Core::JSON::Container {
+    public:
+        Position(const Position&) = delete;
+        Position& operator=(const Position&) = delete;
+
+        Position()
+            : Core::JSON::Container()
+            , Value(0)
+        {
+            Add(_T("position"), &Value);
+        }
+        ~Position()
+        {
+        }
+
+    public:
+        Core::JSON::DecUInt32 Value;
+    };
+
+    class Sink {
+    public:
+        Sink(const Sink&) = delete;
+        Sink& operator=(const Sink&) = delete;
+
+        Sink()
+            : _lock()
+            , _deliveries(0)
+            , _bytes(0)
+            , _last()
+        {
+        }
+        ~Sink()
+        {
+        }
+
+    public:
+        void Deliver(const uint32_t id, const string& designator, const string& parameters)
+        {
+            Core::JSONRPC::Message message;
+            string text;
+
+            message.Designator = designator;
+            message.Parameters = parameters;
+            message.JSONRPC = Core::JSONRPC::Message::DefaultVersion;
+            message.ToString(text);
+
+            _lock.Lock();
+            _deliveries++;
+            _bytes += text.length();
+            if (id == 1) {
+                _last = parameters;
+            }
+            _lock.Unlock();
+        }
+        uint64_t Deliveries() const
+        {
+            return (_deliveries);
+        }
+        uint64_t Bytes() const
+        {
+            return (_bytes);
+        }
+        const string& Last() const
+        {
+            return (_last);
+        }
+
+    private:
+        Core::CriticalSection _lock;
+        uint64_t _deliveries;
+        uint64_t _bytes;
+        string _last;
+    };
+
+    inline uint64_t CPU()
+    {
+        struct timespec now;
+        clock_gettime(CLOCK_PROCESS_CPUTIME_ID, &now);
+        return ((static_cast<uint64_t>(now.tv_sec) * 1000000000) + now.tv_nsec);
+    }
+
+    void Run(const TCHAR name[], const uint32_t seconds, const uint32_t subscribers, const bool coalesce, const uint16_t maxRate)
+    {
+        Sink sink;
+        Core::JSONRPC::Handler handler([&sink](const uint32_t id, const string& designator, const string& parameters) { sink.Deliver(id, designator, parameters); }, { 1 });
+
+        for (uint32_t id = 1; id <= subscribers; id++) {
+            Core::JSONRPC::Message response;
+
+            handler.Subscribe(id, _T("positionchange"), _T("client"), response);
+
+            if ((coalesce == true) || (maxRate != 0)) {
+                handler.Throttle(id, _T("positionchange"), _T("client"), coalesce, maxRate);
+            }
+        }
+
+        const uint32_t events = seconds * RateHz;
+        Position position;
+        string last;
+        struct timespec tick;
+
+        clock_gettime(CLOCK_MONOTONIC, &tick);
+
+        const uint64_t wallStart = Benchmarks::Now();
+        const uint64_t cpuStart = CPU();
+
+        for (uint32_t event = 1; event <= events; event++) {
+            tick.tv_nsec += (1000000000 / RateHz);
+            if (tick.tv_nsec >= 1000000000) {
+                tick.tv_nsec -= 1000000000;
+                tick.tv_sec++;
+            }
+            clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &tick, nullptr);
+
+            position.Value = event;
+            handler.Notify(_T("positionchange"), position);
+        }
+
+        // Give the values held back the time to be delivered.
+        SleepMs(maxRate != 0 ? (2000 / maxRate) + 50 : 50);
+
+        const double cpu = static_cast<double>(CPU() - cpuStart);
+        const double wall = static_cast<double>(Benchmarks::Now() - wallStart);
+
+        position.ToString(last);
+
+        printf("%-24s: %8" PRIu64 " deliveries, %8.1f KB/s, CPU %5.1f%%, latest value delivered: %s\n",
+            name, sink.Deliveries(), (static_cast<double>(sink.Bytes()) / 1024.0) / (wall / 1000000000.0),
+            (cpu * 100.0) / wall, (sink.Last() == last ? _T("yes") : _T("no")));
+
+        handler.Close();
+    }
+}
+
+int main(int argc, char** argv)
+{
+    const uint32_t seconds = (argc > 1 ? std::max(1, atoi(argv[1])) : 3);
+    const uint32_t subscribers = (argc > 2 ? std::max(1, atoi(argv[2])) : 100);
+    Core::WorkerPool pool(2, 0, 64);
+
+    Core::IWorkerPool::Assign(&pool);
+
+    printf("%u Hz event source, %u subscribers, %u seconds\n", RateHz, subscribers, seconds);
+
+    Run(_T("every event"), seconds, subscribers, false, 0);
+    Run(_T("coalesce"), seconds, subscribers, true, 0);
+    Run(_T("maxrate 100"), seconds, subscribers, false, 100);
+    Run(_T("maxrate 10"), seconds, subscribers, false, 10);
+    Run(_T("coalesce, maxrate 30"), seconds, subscribers, true, 30);
+
+    Core::IWorkerPool::Assign(nullptr);
+    pool.Stop();
+
+    Core::Singleton::Dispose();
+
+    return (0);
+}
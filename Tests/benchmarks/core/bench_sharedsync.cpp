@@ -0,0 +1,165 @@
+/*
+ * If not stated otherwise in this file or this component's LICENSE file the
+ * following copyright and licenses apply:
+ *
+ * Copyright 2020 RDK Management
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Round trip latency of the cross process handshakes of the SharedBuffer and the CyclicBuffer,
+// measured between two processes, and the cost of an uncontended SharedMutex.
+
+#include <Benchmark.h>
+
+#include <sys/mman.h>
+
+using namespace WPEFramework;
+
+namespace {
+
+    const uint32_t Iterations = 20000;
+    const char SharedBufferName[] = "/tmp/bench_sharedbuffer";
+    const char PingBufferName[] = "/tmp/bench_cyclic_ping";
+    const char PongBufferName[] = "/tmp/bench_cyclic_pong";
+    const uint32_t Mode = Core::File::USER_READ | Core::File::USER_WRITE | Core::File::SHAREABLE;
+
+    void SharedBufferPingPong()
+    {
+        Core::SharedBuffer producer(SharedBufferName, Mode, 4096, 64);
+
+        pid_t child = fork();
+
+        if (child == 0) {
+            Core::SharedBuffer consumer(SharedBufferName);
+
+            for (uint32_t index = 0; index < Iterations; index++) {
+                consumer.RequestConsume(Core::infinite);
+                consumer.Buffer()[0]++;
+                consumer.Consumed();
+            }
+            _exit(0);
+        }
+
+        Benchmarks::Samples samples(_T("SharedBuffer produce/consume round trip"), Iterations);
+
+        producer.RequestProduce(Core::infinite);
+
+        for (uint32_t index = 0; index < Iterations; index++) {
+            producer.Buffer()[0] = static_cast<uint8_t>(index);
+
+            uint64_t start = Benchmarks::Now();
+            producer.Produced();
+            producer.RequestProduce(Core::infinite);
+            samples.Add(Benchmarks::Now() - start);
+        }
+
+        waitpid(child, nullptr, 0);
+        samples.Report();
+    }
+
+    void CyclicBufferPingPong()
+    {
+        Core::CyclicBuffer ping(PingBufferName, Mode | Core::File::CREATE, 4096, false);
+        Core::CyclicBuffer pong(PongBufferName, Mode | Core::File::CREATE, 4096, false);
+
+        pid_t child = fork();
+
+        if (child == 0) {
+            Core::CyclicBuffer input(PingBufferName, Mode, 0, false);
+            Core::CyclicBuffer output(PongBufferName, Mode, 0, false);
+            uint8_t message[8];
+
+            for (uint32_t index = 0; index < Iterations; index++) {
+                input.Lock(true, Core::infinite);
+                input.Read(message, sizeof(message));
+                input.Unlock();
+                output.Write(message, sizeof(message));
+            }
+            _exit(0);
+        }
+
+        Benchmarks::Samples samples(_T("CyclicBuffer write/read round trip"), Iterations);
+        uint8_t message[8] = {};
+
+        for (uint32_t index = 0; index < Iterations; index++) {
+            uint64_t start = Benchmarks::Now();
+            ping.Write(message, sizeof(message));
+            pong.Lock(true, Core::infinite);
+            pong.Read(message, sizeof(message));
+            pong.Unlock();
+            samples.Add(Benchmarks::Now() - start);
+        }
+
+        waitpid(child, nullptr, 0);
+        samples.Report();
+    }
+
+    void UncontendedLock()
+    {
+        const uint32_t rounds = 1000000;
+
+        struct Area {
+            Core::SharedMutex futex;
+            pthread_mutex_t mutex;
+        }* area = static_cast<Area*>(mmap(nullptr, sizeof(Area), PROT_READ | PROT_WRITE, MAP_SHARED | MAP_ANONYMOUS, -1, 0));
+
+        pthread_mutexattr_t attributes;
+        pthread_mutexattr_init(&attributes);
+        pthread_mutexattr_setpshared(&attributes, PTHREAD_PROCESS_SHARED);
+        pthread_mutex_init(&(area->mutex), &attributes);
+        pthread_mutexattr_destroy(&attributes);
+        area->futex.Initialize();
+
+        Benchmarks::Samples futex(_T("SharedMutex lock/unlock (x1000)"), rounds / 1000);
+        Benchmarks::Samples mutex(_T("pthread shared mutex lock/unlock (x1000)"), rounds / 1000);
+
+        for (uint32_t index = 0; index < rounds; index += 1000) {
+            uint64_t start = Benchmarks::Now();
+            for (uint32_t loop = 0; loop < 1000; loop++) {
+                area->futex.Lock(Core::infinite);
+                area->futex.Unlock();
+            }
+            futex.Add(Benchmarks::Now() - start);
+
+            start = Benchmarks::Now();
+            for (uint32_t loop = 0; loop < 1000; loop++) {
+                pthread_mutex_lock(&(area->mutex));
+                pthread_mutex_unlock(&(area->mutex));
+            }
+            mutex.Add(Benchmarks::Now() - start);
+        }
+
+        futex.Report();
+        mutex.Report();
+
+        pthread_mutex_destroy(&(area->mutex));
+        munmap(area, sizeof(Area));
+    }
+}
+
+int main(int /* argc */, char** /* argv */)
+{
+    UncontendedLock();
+    SharedBufferPingPong();
+    CyclicBufferPingPong();
+
+    Core::File(string(SharedBufferName)).Destroy();
+    Core::File(string(SharedBufferName) + ".admin").Destroy();
+    Core::File(string(PingBufferName)).Destroy();
+    Core::File(string(PongBufferName)).Destroy();
+
+    Core::Singleton::Dispose();
+
+    return (0);
+}
@@ -0,0 +1,176 @@
+/*
+ * If not stated otherwise in this file or this component's LICENSE file the
+ * following copyright and licenses apply:
+ *
+ * Copyright 2020 RDK Management
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Cost of keeping the messages of a client in order on the WorkerPool: every message submitted on its own
+// (as the channels did), against submitted on the strand of its client.
+// Usage: WPEFramework_bench_strand [messages per client, default 200] [clients, default 100] [workers, default 4]
+// The clients take turns sending, one message at a time, every message does about a microsecond of work.
+// A message that runs before one sent earlier by the same client counts as out of order, and so does one
+// that runs while another one of the same client is still running.
+
+#include <Benchmark.h>
+
+using namespace WPEFramework;
+
+namespace {
+
+    class Client {
+    public:
+        Client(const Client&) = delete;
+        Client& operator=(const Client&) = delete;
+
+        Client()
+            : _last(0)
+            , _running(0)
+            , _disorder(0)
+        {
+        }
+        ~Client()
+        {
+        }
+
+    public:
+        void Handle(const uint32_t sequence)
+        {
+            if (_running.fetch_add(1) != 0) {
+                _disorder++;
+            }
+            if (sequence != (_last.load() + 1)) {
+                _disorder++;
+            }
+            _last = std::max(_last.load(), sequence);
+
+            // The work, about a microsecond of it.
+            const uint64_t end = Benchmarks::Now() + 1000;
+            while (Benchmarks::Now() < end) {
+            }
+
+            _running--;
+        }
+        uint32_t Disorder() const
+        {
+            return (_disorder);
+        }
+        void Clear()
+        {
+            _last = 0;
+            _disorder = 0;
+        }
+
+    private:
+        std::atomic<uint32_t> _last;
+        std::atomic<uint32_t> _running;
+        std::atomic<uint32_t> _disorder;
+    };
+
+    class Message : public Core::IDispatch {
+    public:
+        Message() = delete;
+        Message(const Message&) = delete;
+        Message& operator=(const Message&) = delete;
+
+        Message(Client& client, const uint32_t sequence, std::atomic<uint32_t>& left, Core::Event& done)
+            : _client(client)
+            , _sequence(sequence)
+            , _left(left)
+            , _done(done)
+        {
+        }
+        ~Message() override
+        {
+        }
+
+    public:
+        void Dispatch() override
+        {
+            _client.Handle(_sequence);
+
+            if (_left.fetch_sub(1) == 1) {
+                _done.SetEvent();
+            }
+        }
+
+    private:
+        Client& _client;
+        const uint32_t _sequence;
+        std::atomic<uint32_t>& _left;
+        Core::Event& _done;
+    };
+
+    void Run(const TCHAR name[], const bool strands, const uint32_t messages, std::vector<Client>& clients)
+    {
+        std::atomic<uint32_t> left(messages * static_cast<uint32_t>(clients.size()));
+        Core::Event done(false, true);
+        uint32_t disorder = 0;
+
+        for (Client& client : clients) {
+            client.Clear();
+        }
+
+        const uint64_t start = Benchmarks::Now();
+
+        for (uint32_t sequence = 1; sequence <= messages; sequence++) {
+            for (uint32_t index = 0; index < clients.size(); index++) {
+                Core::ProxyType<Core::IDispatch> job(Core::ProxyType<Message>::Create(clients[index], sequence, left, done));
+
+                if (strands == true) {
+                    Core::IWorkerPool::Instance().Submit(index, job);
+                } else {
+                    Core::IWorkerPool::Instance().Submit(job);
+                }
+            }
+        }
+
+        done.Lock(Core::infinite);
+
+        const uint64_t duration = Benchmarks::Now() - start;
+
+        for (const Client& client : clients) {
+            disorder += client.Disorder();
+        }
+
+        printf("%-24s: %8.1f ns per message, %6u out of order\n", name,
+            static_cast<double>(duration) / (messages * clients.size()), disorder);
+    }
+}
+
+int main(int argc, char** argv)
+{
+    const uint32_t messages = (argc > 1 ? std::max(1, atoi(argv[1])) : 200);
+    const uint32_t count = (argc > 2 ? std::max(1, atoi(argv[2])) : 100);
+    const uint8_t workers = static_cast<uint8_t>(argc > 3 ? std::max(1, atoi(argv[3])) : 4);
+    std::vector<Client> clients(count);
+    Core::WorkerPool pool(workers, 0, 256);
+
+    Core::IWorkerPool::Assign(&pool);
+
+    printf("%u clients, %u messages each, %u workers\n", count, messages, workers);
+
+    Run(_T("submitted on their own"), false, messages, clients);
+    Run(_T("on the client strand"), true, messages, clients);
+    Run(_T("submitted on their own"), false, messages, clients);
+    Run(_T("on the client strand"), true, messages, clients);
+
+    Core::IWorkerPool::Assign(nullptr);
+    pool.Stop();
+
+    Core::Singleton::Dispose();
+
+    return (0);
+}
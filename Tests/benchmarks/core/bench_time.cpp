@@ -0,0 +1,127 @@
+/*
+ * If not stated otherwise in this file or this component's LICENSE file the
+ * following copyright and licenses apply:
+ *
+ * Copyright 2020 RDK Management
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Cost of reading the clocks: Core::Time::Now() when only its ticks are used, and when it is broken
+// down, against what Now() used to do (gettimeofday and gmtime_r) and the monotonic ticks the timers use.
+// Usage: WPEFramework_bench_time [iterations, default 1000000]
+
+#include <Benchmark.h>
+
+using namespace WPEFramework;
+
+namespace {
+
+    class Pending {
+    public:
+        Pending()
+            : _id(0)
+        {
+        }
+        explicit Pending(const uint32_t id)
+            : _id(id)
+        {
+        }
+        Pending(const Pending& copy)
+            : _id(copy._id)
+        {
+        }
+        Pending& operator=(const Pending& rhs)
+        {
+            _id = rhs._id;
+            return (*this);
+        }
+
+    public:
+        bool operator==(const Pending& rhs) const
+        {
+            return (_id == rhs._id);
+        }
+        bool operator!=(const Pending& rhs) const
+        {
+            return (!operator==(rhs));
+        }
+        uint64_t Timed(const uint64_t)
+        {
+            return (0);
+        }
+
+    private:
+        uint32_t _id;
+    };
+
+    template <typename ACTION>
+    void Measure(const TCHAR name[], const uint32_t iterations, ACTION&& action)
+    {
+        uint64_t sink = 0;
+        const uint64_t start = Benchmarks::Now();
+
+        for (uint32_t index = 0; index < iterations; index++) {
+            sink += action();
+        }
+
+        const uint64_t duration = Benchmarks::Now() - start;
+
+        printf("%-40s: %7.1f ns per call%s\n", name, static_cast<double>(duration) / iterations, (sink == 0 ? _T(" (no time)") : _T("")));
+    }
+}
+
+int main(int argc, char** argv)
+{
+    const uint32_t iterations = (argc > 1 ? std::max(1, atoi(argv[1])) : 1000000);
+
+    printf("%u iterations per measurement\n", iterations);
+
+    Measure(_T("gettimeofday + gmtime_r (Now() before)"), iterations, []() -> uint64_t {
+        struct timeval now;
+        struct tm broken;
+        gettimeofday(&now, nullptr);
+        gmtime_r(&now.tv_sec, &broken);
+        return (static_cast<uint64_t>(now.tv_sec) + broken.tm_sec);
+    });
+    Measure(_T("Time::Now().Ticks()"), iterations, []() -> uint64_t {
+        return (Core::Time::Now().Ticks());
+    });
+    Measure(_T("Time::Now().Hours()"), iterations, []() -> uint64_t {
+        return (Core::Time::Now().Hours() + 1);
+    });
+    Measure(_T("Time::Now().Add(100).Ticks()"), iterations, []() -> uint64_t {
+        return (Core::Time::Now().Add(100).Ticks());
+    });
+    Measure(_T("Time::MonotonicTicks()"), iterations, []() -> uint64_t {
+        return (Core::Time::MonotonicTicks());
+    });
+    Measure(_T("Time::MonotonicTicks(coarse)"), iterations, []() -> uint64_t {
+        return (Core::Time::MonotonicTicks(true));
+    });
+
+    {
+        // Far enough in the future to never fire, only the bookkeeping is measured.
+        Core::TimerType<Pending> timer(1024 * 64, _T("BenchTimer"));
+        const uint64_t later = Core::Time::Now().Add(3600 * 1000).Ticks();
+
+        Measure(_T("TimerType Schedule + Revoke"), iterations / 10, [&timer, later]() -> uint64_t {
+            timer.Schedule(later, Pending(1));
+            return (timer.Revoke(Pending(1)) == true ? 1 : 0);
+        });
+    }
+
+    Core::Singleton::Dispose();
+
+    return (0);
+}
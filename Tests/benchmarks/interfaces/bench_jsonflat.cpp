@@ -0,0 +1,168 @@
+/*
+ * If not stated otherwise in this file or this component's LICENSE file the
+ * following copyright and licenses apply:
+ *
+ * Copyright 2020 RDK Management
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Time and heap allocations of the JSON data classes generated from the interfaces, the container classes
+// against the flat classes (JsonGenerator --flat), for the same text.
+// Usage: WPEFramework_bench_jsonflat [iterations, default 200000]
+// "fresh" constructs the object for every text read, as a JSON-RPC handler does for its parameters,
+// "reused" reads into the same object over and over. Writing always goes to the same (reserved) string.
+// Before measuring, the text written by both classes is compared, it must be the same.
+
+#include <Benchmark.h>
+
+#include <interfaces/json/JsonData_DHCPServer.h>
+#include <interfaces/json/JsonData_DeviceInfo.h>
+#include <interfaces/json/JsonData_DisplayInfo.h>
+
+#include <atomic>
+#include <new>
+
+namespace {
+
+    std::atomic<uint64_t> _allocations(0);
+
+}
+
+void* operator new(size_t size)
+{
+    void* result = ::malloc(size != 0 ? size : 1);
+
+    if (result == nullptr) {
+        throw std::bad_alloc();
+    }
+
+    _allocations.fetch_add(1, std::memory_order_relaxed);
+
+    return (result);
+}
+void operator delete(void* pointer) noexcept
+{
+    ::free(pointer);
+}
+void operator delete(void* pointer, size_t) noexcept
+{
+    ::free(pointer);
+}
+
+using namespace WPEFramework;
+
+namespace {
+
+    const string SystemInfo(_T("{\"version\":\"1.0#14452f612c3747645d54974255d11b8f3b4faa54\",\"uptime\":120,\"totalram\":655757312,"
+                               "\"freeram\":563015680,\"devicename\":\"buildroot\",\"cpuload\":\"2\",\"serialnumber\":\"WPEuCfrLF45\","
+                               "\"time\":\"Mon, 11 Mar 2019 14:38:18\"}"));
+
+    const string DisplayInfo(_T("{\"totalgpuram\":381681664,\"freegpuram\":358612992,\"audiopassthrough\":false,\"connected\":true,"
+                                "\"width\":1280,\"height\":720,\"hdcpprotection\":\"HDCP1x\",\"hdrtype\":\"HDR10\"}"));
+
+    string DHCPServer()
+    {
+        string result(_T("{\"interface\":\"eth0\",\"active\":true,\"begin\":\"192.168.0.10\",\"end\":\"192.168.0.100\",\"router\":\"192.168.0.1\",\"leases\":["));
+
+        for (uint8_t index = 0; index < 8; index++) {
+            const string number(Core::NumberType<uint8_t>(10 + index).Text());
+
+            result += (index != 0 ? _T(",") : _T(""));
+            result += _T("{\"name\":\"00e04c326c") + number + _T("\",\"ip\":\"192.168.0.") + number + _T("\",\"expires\":\"2019-05-07T07:20:26Z\"}");
+        }
+
+        return (result + _T("]}"));
+    }
+
+    template <typename ACTION>
+    void Measure(const TCHAR name[], const uint32_t iterations, ACTION&& action)
+    {
+        // Warm up, whatever is allocated once (e.g. a string that grows) is not counted.
+        for (uint32_t index = 0; index < 100; index++) {
+            action();
+        }
+
+        const uint64_t allocations = _allocations.load();
+        const uint64_t start = Benchmarks::Now();
+
+        for (uint32_t index = 0; index < iterations; index++) {
+            action();
+        }
+
+        const uint64_t duration = Benchmarks::Now() - start;
+
+        printf("%-40s: %6.2f allocations, %6" PRIu64 " ns per operation\n", name,
+            static_cast<double>(_allocations.load() - allocations) / iterations, duration / iterations);
+    }
+
+    template <typename CONTAINER, typename FLAT>
+    void Compare(const TCHAR name[], const string& text, const uint32_t iterations)
+    {
+        CONTAINER container;
+        FLAT flat;
+        string containerText;
+        string flatText;
+        string output;
+        string label;
+
+        container.FromString(text);
+        container.ToString(containerText);
+
+        if (flat.FromString(text) == false) {
+            printf("%s: the flat class did not read the text\n", name);
+        }
+        flat.ToString(flatText);
+
+        printf("%s, %u bytes, the same text written: %s\n", name, static_cast<uint32_t>(text.length()),
+            ((containerText == flatText) && (flatText == text) ? _T("yes") : _T("NO")));
+
+        output.reserve(text.length() * 2);
+
+        Measure(_T("  container, read fresh"), iterations, [&text]() {
+            CONTAINER data;
+            data.FromString(text);
+        });
+        Measure(_T("  flat, read fresh"), iterations, [&text]() {
+            FLAT data;
+            data.FromString(text);
+        });
+        Measure(_T("  container, read reused"), iterations, [&text, &container]() {
+            container.FromString(text);
+        });
+        Measure(_T("  flat, read reused"), iterations, [&text, &flat]() {
+            flat.FromString(text);
+        });
+        Measure(_T("  container, write"), iterations, [&container, &output]() {
+            container.ToString(output);
+        });
+        Measure(_T("  flat, write"), iterations, [&flat, &output]() {
+            flat.ToString(output);
+        });
+    }
+}
+
+int main(int argc, char** argv)
+{
+    const uint32_t iterations = (argc > 1 ? std::max(1, atoi(argv[1])) : 200000);
+
+    printf("%u iterations per operation\n", iterations);
+
+    Compare<JsonData::DeviceInfo::SysteminfoData, JsonData::DeviceInfo::Flat::SysteminfoData>(_T("DeviceInfo systeminfo"), SystemInfo, iterations);
+    Compare<JsonData::DisplayInfo::DisplayinfoData, JsonData::DisplayInfo::Flat::DisplayinfoData>(_T("DisplayInfo displayinfo"), DisplayInfo, iterations);
+    Compare<JsonData::DHCPServer::ServerData, JsonData::DHCPServer::Flat::ServerData>(_T("DHCPServer server, 8 leases"), DHCPServer(), iterations);
+
+    Core::Singleton::Dispose();
+
+    return (0);
+}
@@ -0,0 +1,213 @@
+/*
+ * If not stated otherwise in this file or this component's LICENSE file the
+ * following copyright and licenses apply:
+ *
+ * Copyright 2020 RDK Management
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Throughput of the Core::EnumerateType conversions, on their own and where they are used the most: the
+// keywords and values of the HTTP headers and the JSON::EnumType values.
+// Usage: WPEFramework_bench_enumerate [iterations, default 200000]
+// The names looked up are spread over the tables (first, middle and last entries, and one that is not in
+// there), enum to name goes over the HTTP status codes, the request carries 14 headers.
+
+#include <Benchmark.h>
+#include <plugins/plugins.h>
+
+using namespace WPEFramework;
+
+namespace {
+
+    const TCHAR* const MIMENames[] = {
+        _T("application/octet-stream"), _T("application/json"), _T("image/png"), _T("image/jpeg"),
+        _T("application/rss+xml"), _T("unknown"), _T("text/unknown")
+    };
+
+    const TCHAR* const MIMENamesCased[] = {
+        _T("Application/Octet-Stream"), _T("APPLICATION/JSON"), _T("Image/PNG"), _T("image/JPEG"),
+        _T("Application/RSS+XML"), _T("UNKNOWN"), _T("Text/Unknown")
+    };
+
+    const Web::WebStatus Statuses[] = {
+        Web::STATUS_CONTINUE, Web::STATUS_OK, Web::STATUS_NO_CONTENT, Web::STATUS_NOT_FOUND,
+        Web::STATUS_METHOD_NOT_ALLOWED, Web::STATUS_SERVICE_UNAVAILABLE, Web::STATUS_VERSION_NOT_SUPPORTED
+    };
+
+    const string HTTPRequest(_T("POST /Service/Controller/Plugins HTTP/1.1\r\n"
+                                "Host: 127.0.0.1:80\r\n"
+                                "User-Agent: bench/1.0\r\n"
+                                "Accept: */*\r\n"
+                                "Accept-Language: en-US,en;q=0.5\r\n"
+                                "Accept-Encoding: gzip\r\n"
+                                "Origin: http://127.0.0.1\r\n"
+                                "Content-Type: application/json\r\n"
+                                "Content-Encoding: gzip\r\n"
+                                "Content-Length: 0\r\n"
+                                "Connection: keep-alive\r\n"
+                                "Upgrade: websocket\r\n"
+                                "Sec-WebSocket-Version: 13\r\n"
+                                "Sec-WebSocket-Protocol: json\r\n"
+                                "Access-Control-Request-Method: GET\r\n\r\n"));
+
+    class MIMEList : public Core::JSON::Container {
+    public:
+        MIMEList(const MIMEList&) = delete;
+        MIMEList& operator=(const MIMEList&) = delete;
+
+        MIMEList()
+            : Core::JSON::Container()
+        {
+            Add(_T("types"), &Types);
+        }
+        ~MIMEList()
+        {
+        }
+
+    public:
+        Core::JSON::ArrayType<Core::JSON::EnumType<Web::MIMETypes>> Types;
+    };
+
+    class Parser : public Web::Request::Deserializer {
+    public:
+        Parser(const Parser&) = delete;
+        Parser& operator=(const Parser&) = delete;
+
+        Parser()
+            : Web::Request::Deserializer()
+            , _request()
+            , _parsed(0)
+        {
+        }
+        ~Parser()
+        {
+        }
+
+    public:
+        void Run(const string& text)
+        {
+            Web::Request::Deserializer::Deserialize(reinterpret_cast<const uint8_t*>(text.c_str()), static_cast<uint16_t>(text.length()));
+        }
+        uint32_t Parsed() const
+        {
+            return (_parsed);
+        }
+        const Web::Request& Request() const
+        {
+            return (_request);
+        }
+
+    private:
+        Web::Request* Element() override
+        {
+            _request.Clear();
+            return (&_request);
+        }
+        bool LinkBody(Web::Request&) override
+        {
+            return (false);
+        }
+        void Deserialized(Web::Request&) override
+        {
+            _parsed++;
+        }
+
+    private:
+        Web::Request _request;
+        uint32_t _parsed;
+    };
+
+    template <typename ACTION>
+    void Measure(const TCHAR name[], const uint32_t iterations, const uint32_t operations, ACTION&& action)
+    {
+        const uint64_t start = Benchmarks::Now();
+
+        for (uint32_t index = 0; index < iterations; index++) {
+            action();
+        }
+
+        const uint64_t duration = Benchmarks::Now() - start;
+
+        printf("%-40s: %8.1f ns per operation, %6.2f M operations per second\n", name,
+            static_cast<double>(duration) / (static_cast<double>(iterations) * operations),
+            (static_cast<double>(iterations) * operations * 1000.0) / static_cast<double>(duration));
+    }
+}
+
+int main(int argc, char** argv)
+{
+    const uint32_t iterations = (argc > 1 ? std::max(1, atoi(argv[1])) : 200000);
+    const uint32_t names = sizeof(MIMENames) / sizeof(MIMENames[0]);
+    const uint32_t statuses = sizeof(Statuses) / sizeof(Statuses[0]);
+    uint32_t found = 0;
+
+    printf("%u iterations per measurement\n", iterations);
+
+    Measure(_T("name to enum, case sensitive"), iterations, names, [&found]() {
+        for (const TCHAR* name : MIMENames) {
+            found += (Core::EnumerateType<Web::MIMETypes>(name, true).IsSet() ? 1 : 0);
+        }
+    });
+    Measure(_T("name to enum, case insensitive"), iterations, names, [&found]() {
+        for (const TCHAR* name : MIMENamesCased) {
+            found += (Core::EnumerateType<Web::MIMETypes>(name, false).IsSet() ? 1 : 0);
+        }
+    });
+    Measure(_T("text fragment to enum, case insensitive"), iterations, names, [&found]() {
+        for (const TCHAR* name : MIMENamesCased) {
+            found += (Core::EnumerateType<Web::MIMETypes>(Core::TextFragment(name), false).IsSet() ? 1 : 0);
+        }
+    });
+    Measure(_T("enum to name"), iterations, statuses, [&found]() {
+        for (const Web::WebStatus status : Statuses) {
+            found += (*(Core::EnumerateType<Web::WebStatus>(status).Data()) != '\0' ? 1 : 0);
+        }
+    });
+
+    // Every known name is found, with any case, and every status has a name.
+    printf("%s\n", (found == (iterations * (3 * (names - 1) + statuses)) ? _T("all conversions found") : _T("CONVERSIONS MISSING")));
+
+    {
+        Parser parser;
+
+        Measure(_T("HTTP request, 14 headers"), iterations / 10, 1, [&parser]() {
+            parser.Run(HTTPRequest);
+        });
+
+        printf("%u requests parsed, content type %s\n", parser.Parsed(),
+            (parser.Request().ContentType.IsSet() && (parser.Request().ContentType.Value() == Web::MIME_JSON) ? _T("ok") : _T("WRONG")));
+    }
+    {
+        MIMEList list;
+        string text(_T("{\"types\":["));
+
+        for (uint8_t index = 0; index < 16; index++) {
+            text += (index != 0 ? _T(",\"") : _T("\""));
+            text += MIMENames[index % (names - 1)];
+            text += _T("\"");
+        }
+        text += _T("]}");
+
+        Measure(_T("JSON array of 16 enums, deserialize"), iterations / 10, 16, [&list, &text]() {
+            list.FromString(text);
+        });
+        Measure(_T("JSON array of 16 enums, serialize"), iterations / 10, 16, [&list, &text]() {
+            list.ToString(text);
+        });
+    }
+
+    Core::Singleton::Dispose();
+
+    return (0);
+}
@@ -0,0 +1,498 @@
+/*
+ * If not stated otherwise in this file or this component's LICENSE file the
+ * following copyright and licenses apply:
+ *
+ * Copyright 2020 RDK Management
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Load generator for small REST calls over persistent, pipelined HTTP connections to a PluginHost::Channel.
+// Usage: WPEFramework_bench_pipeline [requests, default 20000] [workers, default 4]
+// The server numbers the requests as PluginHost does and handles them on a workerpool, every request takes
+// a different (short) time, so they complete out of order. The client, a Web::WebLinkType, keeps up to
+// <depth> requests outstanding and checks every response is the one to the oldest request outstanding.
+// Reported are the requests per second and the latency from submitting the request to receiving its
+// response. The first run opens a connection per request, for comparison.
+
+#include <Benchmark.h>
+#include <plugins/plugins.h>
+
+#include <condition_variable>
+#include <deque>
+#include <list>
+#include <mutex>
+
+using namespace WPEFramework;
+
+namespace {
+
+    class Endpoint;
+
+    class Listener : public Core::SocketServerType<Endpoint> {
+    public:
+        Listener(const Listener&) = delete;
+        Listener& operator=(const Listener&) = delete;
+
+        Listener(const Core::NodeId& node)
+            : Core::SocketServerType<Endpoint>(node)
+            , _handled(0)
+            , _reordered(0)
+        {
+        }
+        ~Listener()
+        {
+        }
+
+    public:
+        // Requests that were handled before one that was received earlier.
+        void Handled(const uint32_t sequence, const uint32_t highest)
+        {
+            _handled++;
+            if (sequence < highest) {
+                _reordered++;
+            }
+        }
+        uint32_t Reordered() const
+        {
+            return (_reordered);
+        }
+        void Reset()
+        {
+            _handled = 0;
+            _reordered = 0;
+        }
+
+    private:
+        std::atomic<uint32_t> _handled;
+        std::atomic<uint32_t> _reordered;
+    };
+
+    // The server side of a connection, handling its requests on the workerpool like PluginHost does.
+    class Endpoint : public PluginHost::Channel {
+    private:
+        class Job : public Core::IDispatch {
+        public:
+            Job() = delete;
+            Job(const Job&) = delete;
+            Job& operator=(const Job&) = delete;
+
+            Job(Listener& listener, Endpoint& endpoint, const uint32_t sequence, const string& path)
+                : _listener(listener)
+                , _id(endpoint.Id())
+                , _endpoint(endpoint)
+                , _sequence(sequence)
+                , _path(path)
+            {
+            }
+            ~Job() override
+            {
+            }
+
+        public:
+            void Dispatch() override
+            {
+                // Between 0 and 63 us of work, so the requests complete out of order.
+                const uint64_t end = Benchmarks::Now() + (((_sequence * 2654435761u) >> 26) * 1000);
+
+                while (Benchmarks::Now() < end) {
+                }
+
+                Core::ProxyType<Web::Response> response(PluginHost::IFactories::Instance().Response());
+
+                response->ErrorCode = Web::STATUS_OK;
+                response->Message = _path;
+
+                _listener.Handled(_sequence, _endpoint.Highest(_sequence));
+                _listener.Submit(_id, _sequence, response);
+            }
+
+        private:
+            Listener& _listener;
+            const uint32_t _id;
+            Endpoint& _endpoint;
+            const uint32_t _sequence;
+            const string _path;
+        };
+
+    public:
+        Endpoint() = delete;
+        Endpoint(const Endpoint&) = delete;
+        Endpoint& operator=(const Endpoint&) = delete;
+
+        Endpoint(const SOCKET& connector, const Core::NodeId& remoteId, Core::SocketServerType<Endpoint>* parent)
+            : PluginHost::Channel(connector, remoteId)
+            , _listener(static_cast<Listener&>(*parent))
+            , _highest(0)
+        {
+        }
+        ~Endpoint() override
+        {
+            Close(0);
+        }
+
+    public:
+        inline uint32_t Id() const
+        {
+            return (PluginHost::Channel::Id());
+        }
+        inline void Id(const uint32_t id)
+        {
+            SetId(id);
+        }
+        uint32_t Highest(const uint32_t sequence)
+        {
+            uint32_t result = _highest.load();
+
+            while ((sequence > result) && (_highest.compare_exchange_weak(result, sequence) == false)) {
+            }
+
+            return (result);
+        }
+
+    private:
+        void LinkBody(Core::ProxyType<PluginHost::Request>&) override
+        {
+        }
+        void Received(Core::ProxyType<PluginHost::Request>& request) override
+        {
+            const uint32_t sequence = Sequence((request->Connection.IsSet() == true) && (request->Connection.Value() == Web::Request::CONNECTION_CLOSE));
+
+            Core::IWorkerPool::Instance().Submit(Core::ProxyType<Core::IDispatch>(Core::ProxyType<Job>::Create(_listener, *this, sequence, request->Path)));
+        }
+        void Send(const Core::ProxyType<Web::Response>&) override
+        {
+        }
+        void Send(const Core::ProxyType<Core::JSON::IElement>&) override
+        {
+        }
+        Core::ProxyType<Core::JSON::IElement> Element(const string&) override
+        {
+            return (Core::ProxyType<Core::JSON::IElement>());
+        }
+        void Received(Core::ProxyType<Core::JSON::IElement>&) override
+        {
+        }
+        uint16_t SendData(uint8_t* dataFrame, const uint16_t maxSendSize) override
+        {
+            return (PluginHost::Channel::Serialize(dataFrame, maxSendSize));
+        }
+        uint16_t ReceiveData(uint8_t* dataFrame, const uint16_t receivedSize) override
+        {
+            return (PluginHost::Channel::Deserialize(dataFrame, receivedSize));
+        }
+        void Received(const string&) override
+        {
+        }
+        void StateChange() override
+        {
+            if (IsOpen() == false) {
+                State(CLOSED, false);
+            }
+        }
+
+    private:
+        Listener& _listener;
+        std::atomic<uint32_t> _highest;
+    };
+
+    class Factories : public PluginHost::IFactories {
+    public:
+        Factories(const Factories&) = delete;
+        Factories& operator=(const Factories&) = delete;
+
+        Factories()
+            : _requestFactory(5)
+            , _responseFactory(5)
+            , _fileBodyFactory(5)
+            , _jsonRPCFactory(5)
+        {
+        }
+        ~Factories() override
+        {
+        }
+
+    public:
+        Core::ProxyType<Web::Request> Request() override
+        {
+            return (_requestFactory.Element());
+        }
+        Core::ProxyType<Web::Response> Response() override
+        {
+            return (_responseFactory.Element());
+        }
+        Core::ProxyType<Web::FileBody> FileBody() override
+        {
+            return (_fileBodyFactory.Element());
+        }
+        Core::ProxyType<Web::JSONBodyType<Core::JSONRPC::Message>> JSONRPC() override
+        {
+            return (_jsonRPCFactory.Element());
+        }
+
+    private:
+        Core::ProxyPoolType<Web::Request> _requestFactory;
+        Core::ProxyPoolType<Web::Response> _responseFactory;
+        Core::ProxyPoolType<Web::FileBody> _fileBodyFactory;
+        Core::ProxyPoolType<Web::JSONBodyType<Core::JSONRPC::Message>> _jsonRPCFactory;
+    };
+
+    // The load generator, a web client keeping up to <depth> requests outstanding on one connection.
+    class Client : public Web::WebLinkType<Core::SocketStream, Web::Response, Web::Request, Core::ProxyPoolType<Web::Response>&> {
+    private:
+        typedef Web::WebLinkType<Core::SocketStream, Web::Response, Web::Request, Core::ProxyPoolType<Web::Response>&> BaseClass;
+
+        struct Outstanding {
+            string Path;
+            uint64_t Submitted;
+        };
+
+    public:
+        Client() = delete;
+        Client(const Client&) = delete;
+        Client& operator=(const Client&) = delete;
+
+        Client(const Core::NodeId& server, Core::ProxyPoolType<Web::Response>& responses)
+            : BaseClass(5, responses, false, server.AnyInterface(), server, 2048, 2048)
+            , _requests(8)
+            , _lock()
+            , _signal()
+            , _open(false)
+            , _outstanding()
+            , _latencies()
+            , _misordered(0)
+        {
+        }
+        ~Client() override
+        {
+            Close(Core::infinite);
+        }
+
+    public:
+        // Open and close wait for the state change, the waits of the socket itself sleep in slots of 100 ms.
+        bool Connect(const uint32_t waitTime)
+        {
+            uint32_t result = Open(0);
+
+            // As HTTP clients do, pipelined requests are not held back until the previous one is acknowledged.
+            Link().NoDelay(true);
+
+            if (result == Core::ERROR_INPROGRESS) {
+                std::unique_lock<std::mutex> guard(_lock);
+
+                _signal.wait_for(guard, std::chrono::milliseconds(waitTime), [this]() { return (_open == true); });
+            }
+
+            return (IsOpen() == true);
+        }
+        void Disconnect(const uint32_t waitTime)
+        {
+            Close(0);
+
+            std::unique_lock<std::mutex> guard(_lock);
+
+            _signal.wait_for(guard, std::chrono::milliseconds(waitTime), [this]() { return (_open == false); });
+        }
+        void Request(const string& path, const bool close, const uint8_t depth)
+        {
+            Core::ProxyType<Web::Request> request(_requests.Element());
+
+            request->Verb = Web::Request::HTTP_GET;
+            request->Path = path;
+            request->Host = _T("127.0.0.1");
+
+            if (close == true) {
+                request->Connection = Web::Request::CONNECTION_CLOSE;
+            }
+
+            std::unique_lock<std::mutex> guard(_lock);
+
+            _signal.wait(guard, [this, depth]() { return (_outstanding.size() < depth); });
+            _outstanding.push_back({ path, Benchmarks::Now() });
+
+            guard.unlock();
+
+            Submit(request);
+        }
+        void Drain()
+        {
+            std::unique_lock<std::mutex> guard(_lock);
+
+            _signal.wait_for(guard, std::chrono::seconds(10), [this]() { return (_outstanding.empty() == true); });
+        }
+        std::vector<uint64_t>& Latencies()
+        {
+            return (_latencies);
+        }
+        uint32_t Misordered() const
+        {
+            return (_misordered);
+        }
+
+    private:
+        void LinkBody(Core::ProxyType<Web::Response>&) override
+        {
+        }
+        void Received(Core::ProxyType<Web::Response>& response) override
+        {
+            const uint64_t now = Benchmarks::Now();
+
+            std::unique_lock<std::mutex> guard(_lock);
+
+            if (_outstanding.empty() == false) {
+                if (_outstanding.front().Path != response->Message) {
+                    _misordered++;
+                }
+                _latencies.push_back(now - _outstanding.front().Submitted);
+                _outstanding.pop_front();
+            }
+
+            guard.unlock();
+
+            _signal.notify_all();
+        }
+        void Send(const Core::ProxyType<Web::Request>&) override
+        {
+        }
+        void StateChange() override
+        {
+            const bool open = IsOpen();
+
+            _lock.lock();
+            _open = open;
+            _lock.unlock();
+
+            _signal.notify_all();
+        }
+
+    private:
+        Core::ProxyPoolType<Web::Request> _requests;
+        std::mutex _lock;
+        std::condition_variable _signal;
+        bool _open;
+        std::deque<Outstanding> _outstanding;
+        std::vector<uint64_t> _latencies;
+        uint32_t _misordered;
+    };
+
+    void Report(const TCHAR name[], std::vector<uint64_t>& latencies, const uint64_t duration, const uint32_t misordered, const uint32_t reordered)
+    {
+        Benchmarks::Samples samples(name, static_cast<uint32_t>(latencies.size()));
+
+        for (const uint64_t latency : latencies) {
+            samples.Add(latency);
+        }
+
+        printf("%-40s: %8.0f requests/s, %u handled out of order, %u responses out of order\n", name,
+            (static_cast<double>(latencies.size()) * 1000000000.0) / duration, reordered, misordered);
+
+        samples.Report();
+    }
+
+    void PerConnection(std::list<Client>& clients, const Core::NodeId& server, Listener& listener, Core::ProxyPoolType<Web::Response>& responses, const uint32_t requests)
+    {
+        std::vector<uint64_t> latencies;
+        uint32_t misordered = 0;
+
+        listener.Reset();
+        latencies.reserve(requests);
+
+        const uint64_t start = Benchmarks::Now();
+
+        for (uint32_t index = 0; index < requests; index++) {
+            clients.emplace_back(server, responses);
+
+            Client& client(clients.back());
+
+            if (client.Connect(1000) == true) {
+                client.Request(_T("/Service/Bench/") + Core::NumberType<uint32_t>(index).Text(), true, 1);
+                client.Drain();
+                client.Disconnect(1000);
+
+                latencies.insert(latencies.end(), client.Latencies().begin(), client.Latencies().end());
+                misordered += client.Misordered();
+            }
+        }
+
+        listener.Cleanup();
+
+        Report(_T("connection per request"), latencies, Benchmarks::Now() - start, misordered, listener.Reordered());
+    }
+
+    void Persistent(std::list<Client>& clients, const TCHAR name[], const Core::NodeId& server, Listener& listener, Core::ProxyPoolType<Web::Response>& responses, const uint32_t requests, const uint8_t depth)
+    {
+        clients.emplace_back(server, responses);
+
+        Client& client(clients.back());
+
+        listener.Reset();
+        client.Latencies().reserve(requests);
+
+        if (client.Connect(1000) == false) {
+            printf("%-40s: could not connect\n", name);
+        } else {
+            const uint64_t start = Benchmarks::Now();
+
+            for (uint32_t index = 0; index < requests; index++) {
+                client.Request(_T("/Service/Bench/") + Core::NumberType<uint32_t>(index).Text(), false, depth);
+            }
+
+            client.Drain();
+            client.Disconnect(1000);
+
+            Report(name, client.Latencies(), Benchmarks::Now() - start, client.Misordered(), listener.Reordered());
+        }
+    }
+}
+
+int main(int argc, char** argv)
+{
+    const uint32_t requests = (argc > 1 ? std::max(1, atoi(argv[1])) : 20000);
+    const uint8_t workers = (argc > 2 ? std::max(1, std::min(atoi(argv[2]), 16)) : 4);
+
+    {
+        Core::WorkerPool pool(workers, 0, 256);
+        Factories factories;
+        Core::ProxyPoolType<Web::Response> responses(8);
+        const Core::NodeId server(_T("127.0.0.1"), 18092);
+        Listener listener(server);
+        // Kept till the end, a closed socket is taken out of the resource monitor after the close completed.
+        std::list<Client> clients;
+
+        Core::IWorkerPool::Assign(&pool);
+        PluginHost::IFactories::Assign(&factories);
+        PluginHost::Channel::KeepAlive(0, 0);
+
+        if (listener.Open(1000) != Core::ERROR_NONE) {
+            printf("Could not listen on %s:%u\n", server.HostAddress().c_str(), server.PortNumber());
+        } else {
+            printf("%u GET requests per run, %u workers on the server\n", requests, workers);
+
+            PerConnection(clients, server, listener, responses, std::min(requests, 2000u));
+            Persistent(clients, _T("keep-alive"), server, listener, responses, requests, 1);
+            Persistent(clients, _T("pipelined, depth 8"), server, listener, responses, requests, 8);
+            Persistent(clients, _T("pipelined, depth 32"), server, listener, responses, requests, 32);
+
+            listener.Close(1000);
+            clients.clear();
+        }
+
+        PluginHost::IFactories::Assign(nullptr);
+        Core::IWorkerPool::Assign(nullptr);
+        pool.Stop();
+    }
+
+    Core::Singleton::Dispose();
+
+    return (0);
+}
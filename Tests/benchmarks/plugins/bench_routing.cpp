@@ -0,0 +1,442 @@
+/*
+ * If not stated otherwise in this file or this component's LICENSE file the
+ * following copyright and licenses apply:
+ *
+ * Copyright 2020 RDK Management
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Routing of requests to their service (ServiceMap::FromLocator) on a number of threads, while plugins are
+// added, removed and (de)activated. The ServiceMap lives in the WPEFramework executable, so both ways of
+// looking up are rebuilt here as PluginServer.h has them: the std::map walked under the admin lock, and the
+// Routing snapshot read without a lock.
+// Usage: WPEFramework_bench_routing [lookups per thread, default 200000] [threads, default 4] [plugins, default 40]
+// The churn thread takes the admin lock the way an activation does (bookkeeping of the remote process), and
+// every 64 rounds adds and removes a plugin. Reported is the time per lookup, averaged over every 64 lookups.
+
+#include <Benchmark.h>
+#include <plugins/plugins.h>
+
+#include <thread>
+
+using namespace WPEFramework;
+
+namespace {
+
+    class Service {
+    public:
+        Service(const Service&) = delete;
+        Service& operator=(const Service&) = delete;
+
+        Service()
+        {
+        }
+        ~Service()
+        {
+        }
+
+    public:
+        bool HasVersionSupport(const string& number) const
+        {
+            return (number.length() > 0) && (std::all_of(number.begin(), number.end(), [](TCHAR item) { return std::isdigit(item); })) && (atoi(number.c_str()) == 1);
+        }
+    };
+
+    // The lookup up till now: walk the map, under the lock every change takes as well.
+    class Locked {
+    public:
+        Locked(const Locked&) = delete;
+        Locked& operator=(const Locked&) = delete;
+
+        Locked()
+            : _adminLock()
+            , _services()
+            , _remotes()
+        {
+        }
+        ~Locked()
+        {
+        }
+
+    public:
+        void Insert(const string& callsign)
+        {
+            _adminLock.Lock();
+            _services.insert(std::pair<const string, Core::ProxyType<Service>>(callsign, Core::ProxyType<Service>::Create()));
+            _adminLock.Unlock();
+        }
+        void Destroy(const string& callsign)
+        {
+            _adminLock.Lock();
+            _services.erase(callsign);
+            _adminLock.Unlock();
+        }
+        void Remote(const string& callsign, const uint32_t id)
+        {
+            _adminLock.Lock();
+            _remotes[callsign] = id;
+            _adminLock.Unlock();
+        }
+        uint32_t FromLocator(const string& identifier, const string& prefix, Core::ProxyType<Service>& service)
+        {
+            size_t length;
+            uint32_t offset = static_cast<uint32_t>(prefix.length()) + 1;
+
+            const string callSign(identifier.substr(offset, ((length = identifier.find_first_of('/', offset)) == string::npos ? string::npos : length - offset)));
+
+            return (FromIdentifier(callSign, service));
+        }
+
+    private:
+        uint32_t FromIdentifier(const string& callSign, Core::ProxyType<Service>& service)
+        {
+            uint32_t result = Core::ERROR_UNAVAILABLE;
+
+            _adminLock.Lock();
+
+            for (auto index : _services) {
+                const string& source(index.first);
+                uint32_t length = static_cast<uint32_t>(source.length());
+
+                if (callSign.compare(0, source.length(), source) == 0) {
+                    if (callSign.length() == length) {
+                        service = index.second;
+                        result = Core::ERROR_NONE;
+                        break;
+                    } else if (callSign[length] == '.') {
+                        if (index.second->HasVersionSupport(callSign.substr(length + 1)) == true) {
+                            service = index.second;
+                            result = Core::ERROR_NONE;
+                        } else {
+                            result = Core::ERROR_INVALID_SIGNATURE;
+                        }
+                        break;
+                    }
+                }
+            }
+
+            _adminLock.Unlock();
+
+            return (result);
+        }
+
+    private:
+        Core::CriticalSection _adminLock;
+        std::map<const string, Core::ProxyType<Service>> _services;
+        std::map<string, uint32_t> _remotes;
+    };
+
+    // The lookup now: the ServiceMap::Routing table and its two reader counters.
+    class Snapshot {
+    private:
+        class Routing {
+        private:
+            struct Entry {
+                string Callsign;
+                Core::ProxyType<Service> Instance;
+            };
+
+        public:
+            Routing() = delete;
+            Routing(const Routing&) = delete;
+            Routing& operator=(const Routing&) = delete;
+
+            Routing(const std::map<const string, Core::ProxyType<Service>>& services)
+                : _entries()
+                , _slots()
+                , _mask(0)
+            {
+                uint32_t size = 8;
+
+                while (size < (2 * services.size())) {
+                    size <<= 1;
+                }
+
+                _mask = size - 1;
+                _slots.assign(size, 0);
+                _entries.reserve(services.size());
+
+                for (const std::pair<const string, Core::ProxyType<Service>>& entry : services) {
+                    uint32_t slot = Hash(entry.first.c_str(), static_cast<uint32_t>(entry.first.length())) & _mask;
+
+                    while (_slots[slot] != 0) {
+                        slot = (slot + 1) & _mask;
+                    }
+
+                    _entries.push_back({ entry.first, entry.second });
+                    _slots[slot] = static_cast<uint32_t>(_entries.size());
+                }
+            }
+            ~Routing()
+            {
+            }
+
+        public:
+            uint32_t Find(const TCHAR callsign[], const uint32_t length, Core::ProxyType<Service>& service) const
+            {
+                uint32_t result = Core::ERROR_UNAVAILABLE;
+                const Entry* entry = Lookup(callsign, length);
+
+                if (entry != nullptr) {
+                    service = entry->Instance;
+                    result = Core::ERROR_NONE;
+                } else {
+                    uint32_t dot = length;
+
+                    while ((dot > 0) && (callsign[dot - 1] != '.')) {
+                        dot--;
+                    }
+
+                    if ((dot > 1) && ((entry = Lookup(callsign, dot - 1)) != nullptr)) {
+                        if (entry->Instance->HasVersionSupport(string(&(callsign[dot]), length - dot)) == true) {
+                            service = entry->Instance;
+                            result = Core::ERROR_NONE;
+                        } else {
+                            result = Core::ERROR_INVALID_SIGNATURE;
+                        }
+                    }
+                }
+
+                return (result);
+            }
+
+        private:
+            static uint32_t Hash(const TCHAR text[], const uint32_t length)
+            {
+                uint32_t result = 2166136261u;
+
+                for (uint32_t index = 0; index < length; index++) {
+                    result = (result ^ static_cast<uint8_t>(text[index])) * 16777619u;
+                }
+
+                return (result);
+            }
+            const Entry* Lookup(const TCHAR callsign[], const uint32_t length) const
+            {
+                const Entry* result = nullptr;
+                uint32_t slot = Hash(callsign, length) & _mask;
+
+                while ((result == nullptr) && (_slots[slot] != 0)) {
+                    const Entry& entry(_entries[_slots[slot] - 1]);
+
+                    if ((entry.Callsign.length() == length) && (entry.Callsign.compare(0, length, callsign, length) == 0)) {
+                        result = &entry;
+                    }
+                    slot = (slot + 1) & _mask;
+                }
+
+                return (result);
+            }
+
+        private:
+            std::vector<Entry> _entries;
+            std::vector<uint32_t> _slots;
+            uint32_t _mask;
+        };
+
+    public:
+        Snapshot(const Snapshot&) = delete;
+        Snapshot& operator=(const Snapshot&) = delete;
+
+        Snapshot()
+            : _adminLock()
+            , _services()
+            , _remotes()
+            , _routing(new Routing(_services))
+            , _epoch(0)
+        {
+            _readers[0] = 0;
+            _readers[1] = 0;
+        }
+        ~Snapshot()
+        {
+            delete _routing.load();
+        }
+
+    public:
+        void Insert(const string& callsign)
+        {
+            _adminLock.Lock();
+            _services.insert(std::pair<const string, Core::ProxyType<Service>>(callsign, Core::ProxyType<Service>::Create()));
+            Publish();
+            _adminLock.Unlock();
+        }
+        void Destroy(const string& callsign)
+        {
+            _adminLock.Lock();
+            _services.erase(callsign);
+            Publish();
+            _adminLock.Unlock();
+        }
+        void Remote(const string& callsign, const uint32_t id)
+        {
+            _adminLock.Lock();
+            _remotes[callsign] = id;
+            _adminLock.Unlock();
+        }
+        uint32_t FromLocator(const string& identifier, const string& prefix, Core::ProxyType<Service>& service)
+        {
+            size_t length;
+            uint32_t offset = static_cast<uint32_t>(prefix.length()) + 1;
+
+            length = identifier.find_first_of('/', offset);
+
+            const uint8_t side = (_epoch.load() & 1);
+
+            _readers[side]++;
+
+            uint32_t result = _routing.load()->Find(&(identifier[offset]), static_cast<uint32_t>((length == string::npos ? identifier.length() : length) - offset), service);
+
+            _readers[side]--;
+
+            return (result);
+        }
+
+    private:
+        void Publish()
+        {
+            Routing* previous = _routing.exchange(new Routing(_services));
+
+            for (uint8_t round = 0; round < 2; round++) {
+                const uint8_t side = (_epoch.fetch_add(1) & 1);
+
+                while (_readers[side].load() != 0) {
+                    ::SleepMs(0);
+                }
+            }
+
+            delete previous;
+        }
+
+    private:
+        Core::CriticalSection _adminLock;
+        std::map<const string, Core::ProxyType<Service>> _services;
+        std::map<string, uint32_t> _remotes;
+        std::atomic<Routing*> _routing;
+        std::atomic<uint32_t> _epoch;
+        std::atomic<uint32_t> _readers[2];
+    };
+
+    string Callsign(const uint32_t index)
+    {
+        return (_T("Plugin") + Core::NumberType<uint32_t>(index).Text());
+    }
+
+    template <typename REGISTRY>
+    void Run(const TCHAR name[], const uint32_t lookups, const uint32_t threads, const uint32_t plugins)
+    {
+        const string prefix(_T("/Service"));
+        const string jsonrpc(_T("/jsonrpc"));
+        REGISTRY registry;
+        std::vector<string> paths;
+        std::vector<std::thread> routers;
+        std::atomic<bool> running(true);
+        std::atomic<uint32_t> missing(0);
+        std::vector<std::vector<uint64_t>> samples(threads);
+        uint32_t churns = 0;
+
+        for (uint32_t index = 0; index < plugins; index++) {
+            registry.Insert(Callsign(index));
+
+            // REST calls and JSON-RPC (with the version) calls, the prefix is the same length for both.
+            paths.push_back(prefix + _T("/") + Callsign(index) + _T("/Status"));
+            paths.push_back(jsonrpc + _T("/") + Callsign(index) + _T(".1"));
+        }
+
+        const uint64_t start = Benchmarks::Now();
+
+        for (uint32_t thread = 0; thread < threads; thread++) {
+            samples[thread].reserve(lookups / 64);
+
+            routers.emplace_back([&registry, &paths, &prefix, &missing, lookups, thread, &samples]() {
+                std::vector<uint64_t>& results(samples[thread]);
+                uint32_t path = thread;
+
+                for (uint32_t round = 0; round < (lookups / 64); round++) {
+                    const uint64_t begin = Benchmarks::Now();
+
+                    for (uint8_t index = 0; index < 64; index++) {
+                        Core::ProxyType<Service> service;
+
+                        path = (path + 7) % paths.size();
+
+                        if (registry.FromLocator(paths[path], prefix, service) != Core::ERROR_NONE) {
+                            missing++;
+                        }
+                    }
+
+                    results.push_back((Benchmarks::Now() - begin) / 64);
+                }
+            });
+        }
+
+        std::thread churn([&registry, &running, &churns, plugins]() {
+            while (running == true) {
+                const string callsign(Callsign(churns % plugins));
+
+                registry.Remote(callsign, churns);
+
+                if ((churns % 64) == 0) {
+                    // Take the last one out, and back in again the next time.
+                    const string added(_T("Added") + Core::NumberType<uint32_t>(churns).Text());
+
+                    registry.Insert(added);
+                    registry.Destroy(added);
+                }
+                churns++;
+
+                std::this_thread::yield();
+            }
+        });
+
+        for (std::thread& router : routers) {
+            router.join();
+        }
+
+        const uint64_t duration = Benchmarks::Now() - start;
+
+        running = false;
+        churn.join();
+
+        Benchmarks::Samples report(string(name) + _T(", per lookup"), (lookups / 64) * threads);
+
+        for (const std::vector<uint64_t>& results : samples) {
+            for (const uint64_t sample : results) {
+                report.Add(sample);
+            }
+        }
+
+        printf("%-40s: %7.1f ns per lookup, %u churns, %u not found\n", name,
+            static_cast<double>(duration) / (static_cast<double>(lookups) * threads), churns, missing.load());
+        report.Report();
+    }
+}
+
+int main(int argc, char** argv)
+{
+    const uint32_t lookups = (argc > 1 ? std::max(64, atoi(argv[1])) : 200000);
+    const uint32_t threads = (argc > 2 ? std::max(1, atoi(argv[2])) : 4);
+    const uint32_t plugins = (argc > 3 ? std::max(1, atoi(argv[3])) : 40);
+
+    printf("%u threads, %u lookups each, %u plugins\n", threads, lookups, plugins);
+
+    Run<Locked>(_T("map, under the lock"), lookups, threads, plugins);
+    Run<Snapshot>(_T("routing snapshot"), lookups, threads, plugins);
+    Run<Locked>(_T("map, under the lock"), lookups, threads, plugins);
+    Run<Snapshot>(_T("routing snapshot"), lookups, threads, plugins);
+
+    Core::Singleton::Dispose();
+
+    return (0);
+}
@@ -0,0 +1,233 @@
+/*
+ * If not stated otherwise in this file or this component's LICENSE file the
+ * following copyright and licenses apply:
+ *
+ * Copyright 2020 RDK Management
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Soak of the send queue of a PluginHost::Channel with a websocket consumer that stopped reading.
+// Usage: WPEFramework_bench_sendqueue [notifications, default 50000] [payload bytes, default 1024]
+// Every scenario upgrades a fresh loopback connection to a JSON-RPC websocket, reads the upgrade response
+// and then stalls. The notifications (16 different events) are submitted as fast as possible, after which
+// the queue and the growth of the resident memory of this process are reported. The bounded scenarios run
+// first, the memory the unbounded one takes is not given back to the system.
+
+#include <Benchmark.h>
+#include <plugins/plugins.h>
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+using namespace WPEFramework;
+
+namespace {
+
+    constexpr uint32_t MaxMessages = 1000;
+    constexpr uint32_t MaxBytes = 1024 * 1024;
+
+    class StalledChannel : public PluginHost::Channel {
+    public:
+        StalledChannel() = delete;
+        StalledChannel(const StalledChannel&) = delete;
+        StalledChannel& operator=(const StalledChannel&) = delete;
+
+        StalledChannel(const SOCKET& connector, const Core::NodeId& remoteId)
+            : PluginHost::Channel(connector, remoteId)
+            , _upgraded(false, true)
+        {
+        }
+        ~StalledChannel() override
+        {
+            Close(0);
+        }
+
+    public:
+        bool WaitForUpgrade(const uint32_t waitTime)
+        {
+            return (_upgraded.Lock(waitTime) == Core::ERROR_NONE);
+        }
+
+    private:
+        void LinkBody(Core::ProxyType<PluginHost::Request>&) override
+        {
+        }
+        void Received(Core::ProxyType<PluginHost::Request>&) override
+        {
+        }
+        void Send(const Core::ProxyType<Web::Response>&) override
+        {
+        }
+        void Send(const Core::ProxyType<Core::JSON::IElement>&) override
+        {
+        }
+        Core::ProxyType<Core::JSON::IElement> Element(const string&) override
+        {
+            return (Core::ProxyType<Core::JSON::IElement>());
+        }
+        void Received(Core::ProxyType<Core::JSON::IElement>&) override
+        {
+        }
+        uint16_t SendData(uint8_t* dataFrame, const uint16_t maxSendSize) override
+        {
+            return (PluginHost::Channel::Serialize(dataFrame, maxSendSize));
+        }
+        uint16_t ReceiveData(uint8_t* dataFrame, const uint16_t receivedSize) override
+        {
+            return (PluginHost::Channel::Deserialize(dataFrame, receivedSize));
+        }
+        void Received(const string&) override
+        {
+        }
+        void StateChange() override
+        {
+            if (IsOpen() == false) {
+                State(CLOSED, false);
+            } else if (IsWebSocket() == true) {
+                State(JSONRPC, false);
+                _upgraded.SetEvent();
+            }
+        }
+
+    private:
+        Core::Event _upgraded;
+    };
+
+    // A loopback connection of which the client side upgrades to a websocket and then never reads again.
+    class Connection {
+    public:
+        Connection(const Connection&) = delete;
+        Connection& operator=(const Connection&) = delete;
+
+        Connection()
+            : _client(-1)
+            , _channel()
+        {
+            struct sockaddr_in address;
+            socklen_t length = sizeof(address);
+            int listener = ::socket(AF_INET, SOCK_STREAM, 0);
+            int smallest = 4096;
+
+            ::memset(&address, 0, sizeof(address));
+            address.sin_family = AF_INET;
+            address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+
+            ::bind(listener, reinterpret_cast<struct sockaddr*>(&address), sizeof(address));
+            ::listen(listener, 1);
+            ::getsockname(listener, reinterpret_cast<struct sockaddr*>(&address), &length);
+
+            _client = ::socket(AF_INET, SOCK_STREAM, 0);
+            ::setsockopt(_client, SOL_SOCKET, SO_RCVBUF, &smallest, sizeof(smallest));
+            ::connect(_client, reinterpret_cast<struct sockaddr*>(&address), sizeof(address));
+
+            SOCKET server = ::accept(listener, nullptr, nullptr);
+            ::setsockopt(server, SOL_SOCKET, SO_SNDBUF, &smallest, sizeof(smallest));
+            ::close(listener);
+
+            _channel = Core::ProxyType<StalledChannel>::Create(server, Core::NodeId(_T("127.0.0.1")));
+            _channel->Open(0);
+
+            const string upgrade(_T("GET /Service/Soak HTTP/1.1\r\n"
+                                    "Host: 127.0.0.1\r\n"
+                                    "Upgrade: websocket\r\n"
+                                    "Connection: Upgrade\r\n"
+                                    "Sec-WebSocket-Key: dGhlIHNhbXBsZSBub25jZQ==\r\n"
+                                    "Sec-WebSocket-Protocol: jsonrpc\r\n"
+                                    "Sec-WebSocket-Version: 13\r\n\r\n"));
+
+            ::send(_client, upgrade.c_str(), upgrade.length(), 0);
+
+            // Read the switching protocols response, after that the client stalls.
+            string response;
+            char buffer[256];
+            ssize_t loaded;
+
+            while ((response.find(_T("\r\n\r\n")) == string::npos) && ((loaded = ::recv(_client, buffer, sizeof(buffer), 0)) > 0)) {
+                response.append(buffer, loaded);
+            }
+        }
+        ~Connection()
+        {
+            _channel->Close(Core::infinite);
+            _channel.Release();
+            ::close(_client);
+        }
+
+    public:
+        StalledChannel& Channel()
+        {
+            return (*_channel);
+        }
+
+    private:
+        int _client;
+        Core::ProxyType<StalledChannel> _channel;
+    };
+
+    void Soak(const TCHAR name[], const uint32_t messages, const uint32_t bytes, const PluginHost::Channel::overflow policy, const uint32_t notifications, const string& parameters)
+    {
+        PluginHost::Channel::SendQueue(messages, bytes, policy);
+
+        const uint64_t resident = Core::ProcessInfo().Resident();
+        Connection connection;
+        StalledChannel& channel(connection.Channel());
+
+        if (channel.WaitForUpgrade(2000) == false) {
+            printf("%-24s: the websocket upgrade failed\n", name);
+        } else {
+            const uint64_t start = Benchmarks::Now();
+            TCHAR designator[32];
+
+            for (uint32_t index = 0; index < notifications; index++) {
+                Core::ProxyType<Core::JSONRPC::Message> message(Core::ProxyType<Core::JSONRPC::Message>::Create());
+
+                ::snprintf(designator, sizeof(designator), _T("client.event%u"), index % 16);
+                message->Designator = designator;
+                message->Parameters = parameters;
+
+                channel.Submit(Core::ProxyType<Core::JSON::IElement>(message));
+            }
+
+            const uint64_t duration = Benchmarks::Now() - start;
+            const int64_t growth = static_cast<int64_t>(Core::ProcessInfo().Resident()) - static_cast<int64_t>(resident);
+
+            printf("%-24s: %6u queued (%8u bytes), %6u dropped, %6u coalesced, %s, RSS %+8" PRId64 " KB, %6" PRIu64 " ns per submit\n",
+                name, channel.Queued(), channel.QueuedBytes(), channel.Dropped(), channel.Coalesced(),
+                (channel.IsOpen() == true ? _T("open  ") : _T("closed")), growth / 1024, duration / notifications);
+        }
+    }
+}
+
+int main(int argc, char** argv)
+{
+    const uint32_t notifications = (argc > 1 ? std::max(1, atoi(argv[1])) : 50000);
+    const uint32_t size = (argc > 2 ? std::max(1, atoi(argv[2])) : 1024);
+    const string parameters(_T("{\"value\":\"") + string(size, 'x') + _T("\"}"));
+
+    printf("%u notifications of %u bytes to a stalled consumer, limits %u messages, %u bytes\n", notifications, size, MaxMessages, MaxBytes);
+
+    Soak(_T("drop oldest, messages"), MaxMessages, 0, PluginHost::Channel::DROP_OLDEST, notifications, parameters);
+    Soak(_T("drop oldest, bytes"), 0, MaxBytes, PluginHost::Channel::DROP_OLDEST, notifications, parameters);
+    Soak(_T("coalesce"), MaxMessages, MaxBytes, PluginHost::Channel::COALESCE, notifications, parameters);
+    Soak(_T("disconnect"), MaxMessages, MaxBytes, PluginHost::Channel::DISCONNECT, notifications, parameters);
+    Soak(_T("unlimited"), 0, 0, PluginHost::Channel::DROP_OLDEST, notifications, parameters);
+
+    PluginHost::Channel::SendQueue(0, 0, PluginHost::Channel::DROP_OLDEST);
+
+    Core::Singleton::Dispose();
+
+    return (0);
+}
@@ -0,0 +1,284 @@
+/*
+ * If not stated otherwise in this file or this component's LICENSE file the
+ * following copyright and licenses apply:
+ *
+ * Copyright 2020 RDK Management
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Heap allocations, and time, per HTTP request and per JSON-RPC call in the web stack of PluginHost.
+// Usage: WPEFramework_bench_webpool [requests, default 100000] [threads, default 4]
+// Every request goes the way it goes in a PluginHost::Channel: a request from the channel pool is filled
+// by the Web::Request deserializer, the JSON-RPC body comes from the factories, the call is dispatched,
+// and the response (and its body) from the factories is serialized. The first requests warm the pools,
+// the allocations counted after that are the ones every request pays. The contended run does the same
+// from several threads, sharing the pools.
+
+#include <Benchmark.h>
+#include <plugins/plugins.h>
+
+#include <atomic>
+#include <new>
+#include <thread>
+
+namespace {
+
+    std::atomic<uint64_t> _allocations(0);
+
+}
+
+void* operator new(size_t size)
+{
+    void* result = ::malloc(size != 0 ? size : 1);
+
+    if (result == nullptr) {
+        throw std::bad_alloc();
+    }
+
+    _allocations.fetch_add(1, std::memory_order_relaxed);
+
+    return (result);
+}
+void operator delete(void* pointer) noexcept
+{
+    ::free(pointer);
+}
+void operator delete(void* pointer, size_t) noexcept
+{
+    ::free(pointer);
+}
+
+using namespace WPEFramework;
+
+namespace {
+
+    constexpr uint32_t Warmup = 1000;
+
+    const string HTTPRequest(_T("GET /Service/Controller/Plugins HTTP/1.1\r\n"
+                                "Host: 127.0.0.1:80\r\n"
+                                "User-Agent: bench/1.0\r\n"
+                                "Accept: */*\r\n"
+                                "Accept-Language: en-US,en;q=0.5\r\n"
+                                "Connection: keep-alive\r\n\r\n"));
+
+    const string JSONRPCBody(_T("{\"jsonrpc\":\"2.0\",\"id\":42,\"method\":\"Benchmark.1.echo\",\"params\":{\"value\":42}}"));
+
+    const string JSONRPCRequest(_T("POST /jsonrpc HTTP/1.1\r\n"
+                                   "Host: 127.0.0.1:80\r\n"
+                                   "User-Agent: bench/1.0\r\n"
+                                   "Content-Type: application/json\r\n"
+                                   "Content-Length: ")
+        + Core::NumberType<uint32_t>(static_cast<uint32_t>(JSONRPCBody.length())).Text() + _T("\r\n\r\n") + JSONRPCBody);
+
+    class Factories : public PluginHost::IFactories {
+    public:
+        Factories(const Factories&) = delete;
+        Factories& operator=(const Factories&) = delete;
+
+        Factories()
+            : _requestFactory(5)
+            , _responseFactory(5)
+            , _fileBodyFactory(5)
+            , _jsonRPCFactory(5)
+        {
+        }
+        ~Factories() override
+        {
+        }
+
+    public:
+        Core::ProxyType<Web::Request> Request() override
+        {
+            return (_requestFactory.Element());
+        }
+        Core::ProxyType<Web::Response> Response() override
+        {
+            return (_responseFactory.Element());
+        }
+        Core::ProxyType<Web::FileBody> FileBody() override
+        {
+            return (_fileBodyFactory.Element());
+        }
+        Core::ProxyType<Web::JSONBodyType<Core::JSONRPC::Message>> JSONRPC() override
+        {
+            return (_jsonRPCFactory.Element());
+        }
+
+    private:
+        Core::ProxyPoolType<Web::Request> _requestFactory;
+        Core::ProxyPoolType<Web::Response> _responseFactory;
+        Core::ProxyPoolType<Web::FileBody> _fileBodyFactory;
+        Core::ProxyPoolType<Web::JSONBodyType<Core::JSONRPC::Message>> _jsonRPCFactory;
+    };
+
+    // One connection: the (de)serializers of a channel, taking the requests from the channel pool.
+    class Connection : public Web::Request::Deserializer, public Web::Response::Serializer {
+    public:
+        Connection(const Connection&) = delete;
+        Connection& operator=(const Connection&) = delete;
+
+        Connection(PluginHost::RequestPool& pool, Core::JSONRPC::Handler& handler)
+            : Web::Request::Deserializer()
+            , Web::Response::Serializer()
+            , _pool(pool)
+            , _handler(handler)
+            , _request()
+            , _response()
+            , _buffer()
+        {
+        }
+        ~Connection()
+        {
+        }
+
+    public:
+        void Run(const string& text)
+        {
+            Web::Request::Deserializer::Deserialize(reinterpret_cast<const uint8_t*>(text.c_str()), static_cast<uint16_t>(text.length()));
+
+            ASSERT(_response.IsValid() == true);
+
+            Web::Response::Serializer::Submit(*_response);
+
+            while (Web::Response::Serializer::Serialize(_buffer, sizeof(_buffer)) != 0) {
+            }
+
+            _response.Release();
+        }
+
+    private:
+        Web::Request* Element() override
+        {
+            _request = _pool.Element();
+            return (&(*_request));
+        }
+        bool LinkBody(Web::Request& request) override
+        {
+            if (request.Verb == Web::Request::HTTP_POST) {
+                request.Body(PluginHost::IFactories::Instance().JSONRPC());
+            }
+            return (request.HasBody());
+        }
+        void Deserialized(Web::Request& request) override
+        {
+            _response = PluginHost::IFactories::Instance().Response();
+
+            if (request.HasBody() == true) {
+                Core::ProxyType<Web::JSONBodyType<Core::JSONRPC::Message>> message(request.Body<Web::JSONBodyType<Core::JSONRPC::Message>>());
+                Core::ProxyType<Web::JSONBodyType<Core::JSONRPC::Message>> body(PluginHost::IFactories::Instance().JSONRPC());
+                string result;
+
+                _handler.Invoke(Core::JSONRPC::Connection(1, message->Id.Value()), message->Designator.Value(), message->Parameters.Value(), result);
+
+                body->JSONRPC = Core::JSONRPC::Message::DefaultVersion;
+                body->Id = message->Id.Value();
+                body->Result = result;
+
+                _response->Body(body);
+                _response->ContentType = Web::MIMETypes::MIME_JSON;
+            } else {
+                _response->Message = _T("OK");
+            }
+
+            _response->ErrorCode = Web::STATUS_OK;
+
+            _request.Release();
+        }
+        void Serialized(const Web::Response&) override
+        {
+        }
+
+    private:
+        PluginHost::RequestPool& _pool;
+        Core::JSONRPC::Handler& _handler;
+        Core::ProxyType<PluginHost::Request> _request;
+        Core::ProxyType<Web::Response> _response;
+        uint8_t _buffer[1024];
+    };
+
+    void Measure(const TCHAR name[], const string& text, const uint32_t requests, const uint8_t threads, PluginHost::RequestPool& pool, Core::JSONRPC::Handler& handler)
+    {
+        std::vector<std::thread> workers;
+        uint64_t allocations = 0;
+        uint64_t start = 0;
+
+        std::vector<Connection*> connections;
+
+        for (uint8_t thread = 0; thread < threads; thread++) {
+            connections.push_back(new Connection(pool, handler));
+
+            for (uint32_t request = 0; request < Warmup; request++) {
+                connections.back()->Run(text);
+            }
+        }
+
+        allocations = _allocations.load();
+        start = Benchmarks::Now();
+
+        for (uint8_t thread = 0; thread < threads; thread++) {
+            workers.emplace_back([&connections, &text, requests, thread]() {
+                for (uint32_t request = 0; request < requests; request++) {
+                    connections[thread]->Run(text);
+                }
+            });
+        }
+        for (std::thread& worker : workers) {
+            worker.join();
+        }
+
+        const uint64_t duration = Benchmarks::Now() - start;
+        const uint64_t total = static_cast<uint64_t>(requests) * threads;
+
+        allocations = _allocations.load() - allocations;
+
+        printf("%-32s: %6.2f allocations, %6" PRIu64 " ns per request\n", name,
+            static_cast<double>(allocations) / total, duration / total);
+
+        for (Connection* connection : connections) {
+            delete connection;
+        }
+    }
+}
+
+int main(int argc, char** argv)
+{
+    const uint32_t requests = (argc > 1 ? std::max(1, atoi(argv[1])) : 100000);
+    const uint8_t threads = (argc > 2 ? std::max(1, std::min(atoi(argv[2]), 64)) : 4);
+
+    {
+        Factories factories;
+        PluginHost::RequestPool pool(10);
+        Core::JSONRPC::Handler handler([](const uint32_t, const string&, const string&) {}, { 1 });
+
+        handler.Register(_T("echo"), Core::JSONRPC::InvokeFunction([](const string&, const string& parameters, string& result) -> uint32_t {
+            result = parameters;
+            return (Core::ERROR_NONE);
+        }));
+
+        PluginHost::IFactories::Assign(&factories);
+
+        printf("%u requests per thread, after a warmup of %u, %u threads for the contended runs\n", requests, Warmup, threads);
+
+        Measure(_T("HTTP GET"), HTTPRequest, requests, 1, pool, handler);
+        Measure(_T("JSON-RPC call"), JSONRPCRequest, requests, 1, pool, handler);
+        Measure(_T("HTTP GET, contended"), HTTPRequest, requests, threads, pool, handler);
+        Measure(_T("JSON-RPC call, contended"), JSONRPCRequest, requests, threads, pool, handler);
+
+        PluginHost::IFactories::Assign(nullptr);
+    }
+
+    Core::Singleton::Dispose();
+
+    return (0);
+}
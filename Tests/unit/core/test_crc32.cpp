@@ -0,0 +1,98 @@
+/*
+ * If not stated otherwise in this file or this component's LICENSE file the
+ * following copyright and licenses apply:
+ *
+ * Copyright 2020 RDK Management
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+#include <core/core.h>
+
+namespace WPEFramework {
+namespace Tests {
+
+static uint32_t ReferenceCRC32(uint32_t crc, const uint8_t data[], const uint32_t length)
+{
+   for (uint32_t index = 0; index < length; index++) {
+      crc ^= (data[index] << 24);
+      for (uint8_t bit = 0; bit < 8; bit++) {
+         crc = ((crc & 0x80000000) != 0 ? (crc << 1) ^ 0x04C11DB7 : (crc << 1));
+      }
+   }
+   return (crc);
+}
+
+TEST(Core_CRC32, checkValue)
+{
+   const uint8_t message[] = { '1', '2', '3', '4', '5', '6', '7', '8', '9' };
+
+   // Published check value of CRC-32/MPEG-2
+   EXPECT_EQ(Core::CRC32(message, sizeof(message)).Result(), 0x0376E6E7u);
+}
+
+TEST(Core_CRC32, lengthsAndAlignments)
+{
+   uint8_t buffer[1024 + 16];
+
+   for (uint32_t index = 0; index < sizeof(buffer); index++) {
+      buffer[index] = static_cast<uint8_t>((index * 2654435761u) >> 13);
+   }
+
+   for (uint8_t offset = 0; offset < 16; offset += 3) {
+      for (uint32_t length = 0; length <= 1024; length++) {
+         EXPECT_EQ(Core::CRC32::Calculate(Core::CRC32::InitialValue, &buffer[offset], length), ReferenceCRC32(0xFFFFFFFF, &buffer[offset], length)) << "offset " << static_cast<uint32_t>(offset) << ", length " << length;
+      }
+   }
+}
+
+TEST(Core_CRC32, incremental)
+{
+   uint8_t buffer[4096];
+
+   for (uint32_t index = 0; index < sizeof(buffer); index++) {
+      buffer[index] = static_cast<uint8_t>(index ^ (index >> 8));
+   }
+
+   const uint32_t expected = ReferenceCRC32(0xFFFFFFFF, buffer, sizeof(buffer));
+   const uint32_t splits[] = { 1, 7, 63, 64, 129, 1000, 4095 };
+
+   for (const uint32_t split : splits) {
+      Core::CRC32 crc;
+      crc.Input(buffer, split);
+      crc.Input(&buffer[split], sizeof(buffer) - split);
+      EXPECT_EQ(crc.Result(), expected) << "split at " << split;
+   }
+}
+
+TEST(Core_CRC32, sectionResidue)
+{
+   // An MPEG section with its CRC appended has a CRC of 0.
+   uint8_t section[188] = { 0x00, 0xB0, 0x0D, 0x00, 0x01, 0xC1, 0x00, 0x00, 0x00, 0x01, 0xE0, 0x20 };
+   const uint32_t length = 12;
+   const uint32_t crc = Core::CRC32(section, length).Result();
+
+   section[length + 0] = static_cast<uint8_t>(crc >> 24);
+   section[length + 1] = static_cast<uint8_t>(crc >> 16);
+   section[length + 2] = static_cast<uint8_t>(crc >> 8);
+   section[length + 3] = static_cast<uint8_t>(crc);
+
+   EXPECT_EQ(Core::CRC32(section, length + 4).Result(), 0u);
+
+   Core::DataElement element(sizeof(section), section);
+   EXPECT_EQ(element.CRC32(0, length), crc);
+}
+
+} // Tests
+} // WPEFramework
@@ -0,0 +1,103 @@
+/*
+ * If not stated otherwise in this file or this component's LICENSE file the
+ * following copyright and licenses apply:
+ *
+ * Copyright 2020 RDK Management
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+#include <core/core.h>
+
+namespace WPEFramework {
+namespace Tests {
+
+   enum class EnumerateTestColor : uint8_t {
+      RED = 1,
+      GREEN = 2,
+      BLUE = 3,
+      CRIMSON = 4
+   };
+
+   enum EnumerateTestSparse : uint32_t {
+      SPARSE_LOW = 0x00000010,
+      SPARSE_HIGH = 0x80000000
+   };
+
+   const TCHAR* const EnumerateTestGreen = _T("Green");
+
+TEST(Core_Enumerate, nameToValue)
+{
+   EXPECT_EQ(Core::EnumerateType<EnumerateTestColor>(_T("Blue")).Value(), EnumerateTestColor::BLUE);
+   EXPECT_FALSE(Core::EnumerateType<EnumerateTestColor>(_T("blue")).IsSet());
+   EXPECT_EQ(Core::EnumerateType<EnumerateTestColor>(_T("bLuE"), false).Value(), EnumerateTestColor::BLUE);
+   EXPECT_FALSE(Core::EnumerateType<EnumerateTestColor>(_T("Blu"), false).IsSet());
+   EXPECT_FALSE(Core::EnumerateType<EnumerateTestColor>(_T("Blues"), false).IsSet());
+   EXPECT_FALSE(Core::EnumerateType<EnumerateTestColor>(_T(""), false).IsSet());
+
+   // The length in the table is sizeof a pointer here, the name is what counts.
+   EXPECT_EQ(Core::EnumerateType<EnumerateTestColor>(_T("Green")).Value(), EnumerateTestColor::GREEN);
+   EXPECT_EQ(Core::EnumerateType<EnumerateTestColor>(Core::TextFragment(_T("Green"))).Value(), EnumerateTestColor::GREEN);
+
+   // A fragment is only compared over its own length.
+   const string text(_T("[RED]"));
+   EXPECT_EQ(Core::EnumerateType<EnumerateTestColor>(Core::TextFragment(text, 1, 3), false).Value(), EnumerateTestColor::RED);
+   EXPECT_FALSE(Core::EnumerateType<EnumerateTestColor>(Core::TextFragment(text, 1, 3), true).IsSet());
+}
+
+TEST(Core_Enumerate, firstEntryWins)
+{
+   // "Red" and "red" are both in the table, "Crimson" is named "red" as well.
+   EXPECT_EQ(Core::EnumerateType<EnumerateTestColor>(_T("red")).Value(), EnumerateTestColor::CRIMSON);
+   EXPECT_EQ(Core::EnumerateType<EnumerateTestColor>(_T("Red")).Value(), EnumerateTestColor::RED);
+   EXPECT_EQ(Core::EnumerateType<EnumerateTestColor>(_T("RED"), false).Value(), EnumerateTestColor::RED);
+
+   // RED has two names, the first one is used.
+   EXPECT_STREQ(Core::EnumerateType<EnumerateTestColor>(EnumerateTestColor::RED).Data(), _T("Red"));
+   EXPECT_STREQ(Core::EnumerateType<EnumerateTestColor>(EnumerateTestColor::CRIMSON).Data(), _T("red"));
+}
+
+TEST(Core_Enumerate, valueToName)
+{
+   EXPECT_STREQ(Core::EnumerateType<EnumerateTestColor>(EnumerateTestColor::BLUE).Data(), _T("Blue"));
+   EXPECT_STREQ(Core::EnumerateType<EnumerateTestColor>(EnumerateTestColor::GREEN).Data(), _T("Green"));
+   EXPECT_STREQ(Core::EnumerateType<EnumerateTestColor>(static_cast<EnumerateTestColor>(9)).Data(), _T(""));
+   EXPECT_STREQ(Core::EnumerateType<EnumerateTestColor>().Data(), _T(""));
+   EXPECT_FALSE(Core::EnumerateType<EnumerateTestColor>(static_cast<uint32_t>(0)).IsSet());
+   EXPECT_EQ(Core::EnumerateType<EnumerateTestColor>(static_cast<uint32_t>(3)).Value(), EnumerateTestColor::BLUE);
+
+   // Values too far apart for an array.
+   EXPECT_STREQ(Core::EnumerateType<EnumerateTestSparse>(SPARSE_HIGH).Data(), _T("high"));
+   EXPECT_STREQ(Core::EnumerateType<EnumerateTestSparse>(SPARSE_LOW).Data(), _T("low"));
+   EXPECT_EQ(Core::EnumerateType<EnumerateTestSparse>(_T("HIGH"), false).Value(), SPARSE_HIGH);
+   EXPECT_FALSE(Core::EnumerateType<EnumerateTestSparse>(static_cast<uint32_t>(0x11)).IsSet());
+}
+
+} // Tests
+
+ENUM_CONVERSION_BEGIN(Tests::EnumerateTestColor)
+   { WPEFramework::Tests::EnumerateTestColor::RED, _TXT("Red") },
+   { WPEFramework::Tests::EnumerateTestColor::GREEN, WPEFramework::Tests::EnumerateTestGreen, sizeof(WPEFramework::Tests::EnumerateTestGreen) },
+   { WPEFramework::Tests::EnumerateTestColor::BLUE, _TXT("Blue") },
+   { WPEFramework::Tests::EnumerateTestColor::CRIMSON, _TXT("red") },
+   { WPEFramework::Tests::EnumerateTestColor::RED, _TXT("scarlet") },
+   { WPEFramework::Tests::EnumerateTestColor::CRIMSON, _TXT("Red") },
+ENUM_CONVERSION_END(Tests::EnumerateTestColor)
+
+ENUM_CONVERSION_BEGIN(Tests::EnumerateTestSparse)
+   { WPEFramework::Tests::SPARSE_LOW, _TXT("low") },
+   { WPEFramework::Tests::SPARSE_HIGH, _TXT("high") },
+ENUM_CONVERSION_END(Tests::EnumerateTestSparse)
+
+} // WPEFramework
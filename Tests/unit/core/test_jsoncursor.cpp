@@ -0,0 +1,162 @@
+/*
+ * If not stated otherwise in this file or this component's LICENSE file the
+ * following copyright and licenses apply:
+ *
+ * Copyright 2020 RDK Management
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <gtest/gtest.h>
+#include <core/core.h>
+
+namespace WPEFramework {
+namespace Tests {
+
+   typedef Core::JSON::Cursor Cursor;
+
+   static string Events(const string& text)
+   {
+      static const TCHAR* const names[] = { _T("{"), _T("}"), _T("["), _T("]"), _T("label"), _T("string"), _T("number"), _T("boolean"), _T("null"), _T("end"), _T("error") };
+      Cursor cursor(text);
+      string result;
+      Cursor::token token;
+
+      do {
+         token = cursor.Next();
+         result += (result.empty() ? _T("") : _T(" "));
+         result += names[token];
+         if ((token == Cursor::LABEL) || (token == Cursor::STRING) || (token == Cursor::NUMBER) || (token == Cursor::BOOLEAN)) {
+            result += _T("(") + cursor.Text().Text() + _T(")");
+         }
+      } while ((token != Cursor::END) && (token != Cursor::ERROR));
+
+      return (result);
+   }
+
+TEST(Core_JSONCursor, events)
+{
+   EXPECT_EQ(Events(_T(" {\"a\" : 1, \"b\":[true,false,null,\"x\\\"y\"],\"c\":{},\"d\":[ ]} ")),
+      string(_T("{ label(a) number(1) label(b) [ boolean(true) boolean(false) null string(x\\\"y) ] label(c) { } label(d) [ ] } end")));
+   EXPECT_EQ(Events(_T("-1.5e3")), string(_T("number(-1.5e3) end")));
+   EXPECT_EQ(Events(_T("[[],[[]]]")), string(_T("[ [ ] [ [ ] ] ] end")));
+}
+
+TEST(Core_JSONCursor, invalidText)
+{
+   EXPECT_EQ(Events(_T("")), string(_T("error")));
+   EXPECT_EQ(Events(_T("{\"a\":1,}")), string(_T("{ label(a) number(1) error")));
+   EXPECT_EQ(Events(_T("{\"a\" 1}")), string(_T("{ error")));
+   EXPECT_EQ(Events(_T("[1,2")), string(_T("[ number(1) number(2) error")));
+   EXPECT_EQ(Events(_T("[1}")), string(_T("[ number(1) error")));
+   EXPECT_EQ(Events(_T("[1]]")), string(_T("[ number(1) ] error")));
+   EXPECT_EQ(Events(_T("[\"open]")), string(_T("[ error")));
+   EXPECT_EQ(Events(_T("[nul]")), string(_T("[ error")));
+
+   // Nested deeper than the cursor keeps track of.
+   const uint32_t depth = Cursor::MaxDepth;
+   const string deep(string(depth, '[') + _T("[]") + string(depth, ']'));
+   Cursor cursor(deep);
+   uint32_t count = 0;
+
+   while (cursor.Next() == Cursor::BEGIN_ARRAY) {
+      count++;
+   }
+   EXPECT_EQ(count, depth);
+   EXPECT_EQ(cursor.Current(), Cursor::ERROR);
+}
+
+TEST(Core_JSONCursor, skip)
+{
+   const string text(_T("{\"skipped\":{\"a\":\"}]\\\"{\",\"b\":[1,[2,{}]]},\"next\":3}"));
+   Cursor cursor(text);
+   uint32_t value = 0;
+
+   EXPECT_EQ(cursor.Next(), Cursor::BEGIN_OBJECT);
+   EXPECT_EQ(cursor.Next(), Cursor::LABEL);
+   EXPECT_EQ(cursor.Next(), Cursor::BEGIN_OBJECT);
+   EXPECT_EQ(cursor.Depth(), 2u);
+   cursor.Skip();
+   EXPECT_EQ(cursor.Current(), Cursor::END_OBJECT);
+   EXPECT_EQ(cursor.Depth(), 1u);
+   EXPECT_EQ(cursor.Next(), Cursor::LABEL);
+   EXPECT_EQ(cursor.Text().Text(), string(_T("next")));
+   EXPECT_EQ(cursor.Next(), Cursor::NUMBER);
+   EXPECT_TRUE(cursor.Get(value));
+   EXPECT_EQ(value, 3u);
+   EXPECT_EQ(cursor.Next(), Cursor::END_OBJECT);
+   EXPECT_EQ(cursor.Next(), Cursor::END);
+
+   // Skipping from a label goes over its value, whatever it is.
+   const string labels(_T("{\"a\":[1,2],\"b\":true}"));
+   Cursor other(labels);
+   EXPECT_EQ(other.Next(), Cursor::BEGIN_OBJECT);
+   EXPECT_EQ(other.Next(), Cursor::LABEL);
+   other.Skip();
+   EXPECT_EQ(other.Current(), Cursor::END_ARRAY);
+   EXPECT_EQ(other.Next(), Cursor::LABEL);
+   other.Skip();
+   EXPECT_EQ(other.Current(), Cursor::BOOLEAN);
+
+   // What is skipped only has to have its brackets and strings right.
+   const string mismatch(_T("[{\"a\":[}]]"));
+   Cursor broken(mismatch);
+   EXPECT_EQ(broken.Next(), Cursor::BEGIN_ARRAY);
+   EXPECT_EQ(broken.Next(), Cursor::BEGIN_OBJECT);
+   broken.Skip();
+   EXPECT_EQ(broken.Current(), Cursor::ERROR);
+}
+
+TEST(Core_JSONCursor, find)
+{
+   const string text(_T("{\"version\":\"1.0\",\"plugins\":[{\"callsign\":\"a]\"},{\"callsign\":\"b\",\"list\":[1,[2,{}]]},"
+                        "{\"callsign\":\"say \\\"c\\\"\"}],\"tail\":{\"port\":\"0x50\",\"ratio\":-1.5e3,\"on\":true,\"none\":null}}"));
+   Cursor cursor(text);
+   string name;
+   uint32_t port = 0;
+   double ratio = 0;
+   int32_t number = 0;
+   bool on = false;
+
+   EXPECT_TRUE(cursor.Get(_T("version"), name));
+   EXPECT_EQ(name, string(_T("1.0")));
+   EXPECT_TRUE(cursor.Get(_T("plugins[2].callsign"), name));
+   EXPECT_EQ(name, string(_T("say \"c\"")));
+   EXPECT_TRUE(cursor.Get(_T("plugins[1].callsign"), name));
+   EXPECT_EQ(name, string(_T("b")));
+   EXPECT_TRUE(cursor.Get(_T("plugins[1].list[1][0]"), number));
+   EXPECT_EQ(number, 2);
+   EXPECT_TRUE(cursor.Get(_T("tail.port"), port));
+   EXPECT_EQ(port, 80u);
+   EXPECT_TRUE(cursor.Get(_T("tail.ratio"), ratio));
+   EXPECT_EQ(ratio, -1500.0);
+   EXPECT_TRUE(cursor.Get(_T("tail.on"), on));
+   EXPECT_TRUE(on);
+
+   EXPECT_TRUE(cursor.Find(_T("tail.none")));
+   EXPECT_EQ(cursor.Current(), Cursor::NULL_VALUE);
+   EXPECT_FALSE(cursor.Get(name));
+
+   EXPECT_TRUE(cursor.Find(_T("plugins[1].list")));
+   EXPECT_EQ(cursor.Current(), Cursor::BEGIN_ARRAY);
+
+   EXPECT_FALSE(cursor.Find(_T("plugins[3].callsign")));
+   EXPECT_FALSE(cursor.Find(_T("plugins.callsign")));
+   EXPECT_FALSE(cursor.Find(_T("version[0]")));
+   EXPECT_FALSE(cursor.Find(_T("tail.missing")));
+   EXPECT_FALSE(cursor.Get(_T("version"), port));
+}
+
+} // Tests
+} // WPEFramework
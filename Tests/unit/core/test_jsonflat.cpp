@@ -0,0 +1,356 @@
+/*
+ * If not stated otherwise in this file or this component's LICENSE file the
+ * following copyright and licenses apply:
+ *
+ * Copyright 2020 RDK Management
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+#include <core/core.h>
+
+namespace WPEFramework {
+namespace Tests {
+
+   enum class FlatTestEnum {
+      RED,
+      GREEN
+   };
+
+   // The same object, as a container class and as the JsonGenerator emits it with --flat.
+   class ContainerSample : public Core::JSON::Container {
+   public:
+      class PointData : public Core::JSON::Container {
+      public:
+         PointData()
+            : Core::JSON::Container()
+         {
+            Init();
+         }
+         PointData(const PointData& other)
+            : Core::JSON::Container()
+            , X(other.X)
+            , Y(other.Y)
+         {
+            Init();
+         }
+         PointData& operator=(const PointData& rhs)
+         {
+            X = rhs.X;
+            Y = rhs.Y;
+            return (*this);
+         }
+
+      private:
+         void Init()
+         {
+            Add(_T("x"), &X);
+            Add(_T("y"), &Y);
+         }
+
+      public:
+         Core::JSON::DecSInt32 X;
+         Core::JSON::DecSInt32 Y;
+      };
+
+      ContainerSample(const ContainerSample&) = delete;
+      ContainerSample& operator=(const ContainerSample&) = delete;
+
+      ContainerSample()
+         : Core::JSON::Container()
+      {
+         Add(_T("text"), &Text);
+         Add(_T("number"), &Number);
+         Add(_T("enabled"), &Enabled);
+         Add(_T("color"), &Color);
+         Add(_T("ratio"), &Ratio);
+         Add(_T("points"), &Points);
+         Add(_T("names"), &Names);
+      }
+
+   public:
+      Core::JSON::String Text;
+      Core::JSON::DecUInt32 Number;
+      Core::JSON::Boolean Enabled;
+      Core::JSON::EnumType<FlatTestEnum> Color;
+      Core::JSON::Double Ratio;
+      Core::JSON::ArrayType<PointData> Points;
+      Core::JSON::ArrayType<Core::JSON::String> Names;
+   };
+
+   class FlatSample {
+   public:
+      class PointData {
+      public:
+         void Clear()
+         {
+            X.Clear();
+            Y.Clear();
+         }
+         bool IsSet() const
+         {
+            return ((X.IsSet() == true) || (Y.IsSet() == true));
+         }
+         void Serialize(string& text) const
+         {
+            Core::JSON::Flat::Writer writer(text);
+            writer.Write(Fields()[0], X);
+            writer.Write(Fields()[1], Y);
+            writer.End();
+         }
+         void Deserialize(Core::JSON::Flat::Reader& reader)
+         {
+            uint8_t index;
+
+            Clear();
+
+            if (reader.Begin() == true) {
+               while (reader.Next(Fields(), 2, index) == true) {
+                  switch (index) {
+                  case 0:
+                     reader.Read(X);
+                     break;
+                  case 1:
+                     reader.Read(Y);
+                     break;
+                  default:
+                     reader.Skip();
+                     break;
+                  }
+               }
+            }
+         }
+
+      private:
+         static const Core::JSON::Flat::Field* Fields()
+         {
+            static constexpr Core::JSON::Flat::Field fields[] = {
+               { _T("x"), 1 },
+               { _T("y"), 1 },
+            };
+            return (fields);
+         }
+
+      public:
+         Core::JSON::Flat::Scalar<int32_t> X;
+         Core::JSON::Flat::Scalar<int32_t> Y;
+      };
+
+   public:
+      void Clear()
+      {
+         Text.Clear();
+         Number.Clear();
+         Enabled.Clear();
+         Color.Clear();
+         Ratio.Clear();
+         Points.Clear();
+         Names.Clear();
+      }
+      void ToString(string& text) const
+      {
+         text.clear();
+         Serialize(text);
+      }
+      bool FromString(const string& text)
+      {
+         Core::JSON::Flat::Reader reader(text);
+         Deserialize(reader);
+         return (reader.IsValid());
+      }
+      void Serialize(string& text) const
+      {
+         Core::JSON::Flat::Writer writer(text);
+         writer.Write(Fields()[0], Text);
+         writer.Write(Fields()[1], Number);
+         writer.Write(Fields()[2], Enabled);
+         writer.Write(Fields()[3], Color);
+         writer.Write(Fields()[4], Ratio);
+         writer.Write(Fields()[5], Points);
+         writer.Write(Fields()[6], Names);
+         writer.End();
+      }
+      void Deserialize(Core::JSON::Flat::Reader& reader)
+      {
+         uint8_t index;
+
+         Clear();
+
+         if (reader.Begin() == true) {
+            while (reader.Next(Fields(), 7, index) == true) {
+               switch (index) {
+               case 0:
+                  reader.Read(Text);
+                  break;
+               case 1:
+                  reader.Read(Number);
+                  break;
+               case 2:
+                  reader.Read(Enabled);
+                  break;
+               case 3:
+                  reader.Read(Color);
+                  break;
+               case 4:
+                  reader.Read(Ratio);
+                  break;
+               case 5:
+                  reader.Read(Points);
+                  break;
+               case 6:
+                  reader.Read(Names);
+                  break;
+               default:
+                  reader.Skip();
+                  break;
+               }
+            }
+         }
+      }
+
+   private:
+      static const Core::JSON::Flat::Field* Fields()
+      {
+         static constexpr Core::JSON::Flat::Field fields[] = {
+            { _T("text"), 4 },
+            { _T("number"), 6 },
+            { _T("enabled"), 7 },
+            { _T("color"), 5 },
+            { _T("ratio"), 5 },
+            { _T("points"), 6 },
+            { _T("names"), 5 },
+         };
+         return (fields);
+      }
+
+   public:
+      Core::JSON::Flat::Scalar<string> Text;
+      Core::JSON::Flat::Scalar<uint32_t> Number;
+      Core::JSON::Flat::Scalar<bool> Enabled;
+      Core::JSON::Flat::Scalar<FlatTestEnum> Color;
+      Core::JSON::Flat::Scalar<double> Ratio;
+      Core::JSON::Flat::Array<PointData> Points;
+      Core::JSON::Flat::Array<string> Names;
+   };
+
+TEST(Core_JSONFlat, sameTextAsContainer)
+{
+   const string input(_T("{\"text\":\"say \\\"hi\\\"\\nnow\",\"number\":4000000000,\"enabled\":false,\"color\":\"green\",\"ratio\":0.25,"
+                         "\"points\":[{\"x\":-3,\"y\":7},{\"y\":-2147483647}],\"names\":[\"a\",\"\",\"c\"]}"));
+   ContainerSample container;
+   FlatSample flat;
+   string containerText;
+   string flatText;
+
+   EXPECT_TRUE(container.FromString(input));
+   EXPECT_TRUE(flat.FromString(input));
+
+   EXPECT_EQ(flat.Text.Value(), string(_T("say \"hi\"\nnow")));
+   EXPECT_EQ(flat.Number.Value(), 4000000000u);
+   EXPECT_TRUE(flat.Enabled.IsSet());
+   EXPECT_FALSE(flat.Enabled.Value());
+   EXPECT_EQ(flat.Color.Value(), FlatTestEnum::GREEN);
+   EXPECT_EQ(flat.Ratio.Value(), 0.25);
+   ASSERT_EQ(flat.Points.Length(), 2u);
+   EXPECT_EQ(flat.Points[0].X.Value(), -3);
+   EXPECT_FALSE(flat.Points[1].X.IsSet());
+   EXPECT_EQ(flat.Points[1].Y.Value(), -2147483647);
+   ASSERT_EQ(flat.Names.Length(), 3u);
+   EXPECT_EQ(flat.Names[2], string(_T("c")));
+
+   container.ToString(containerText);
+   flat.ToString(flatText);
+   EXPECT_EQ(flatText, containerText);
+}
+
+TEST(Core_JSONFlat, onlyWhatIsSet)
+{
+   FlatSample flat;
+   string text;
+
+   flat.ToString(text);
+   EXPECT_EQ(text, string(_T("{}")));
+
+   flat.Number = 42;
+   flat.Names.Add(_T("one"));
+   flat.ToString(text);
+   EXPECT_EQ(text, string(_T("{\"number\":42,\"names\":[\"one\"]}")));
+
+   flat.Clear();
+   EXPECT_FALSE(flat.Number.IsSet());
+   EXPECT_EQ(flat.Names.Length(), 0u);
+}
+
+TEST(Core_JSONFlat, lenientReading)
+{
+   FlatSample flat;
+
+   // Labels that are not known are skipped, whatever their value, null leaves a member not set, numbers
+   // may be quoted (and then hexadecimal), as the container classes read them.
+   EXPECT_TRUE(flat.FromString(_T(" { \"extra\" : {\"a\":[1,{\"b\":\"}]\\\"\"}],\"c\":null} , \"number\" : \"0x1F\" ,"
+                                  "\"text\":null, \"color\":\"RED\", \"enabled\":true, \"unknown\":-1.5e3 } ")));
+   EXPECT_EQ(flat.Number.Value(), 31u);
+   EXPECT_FALSE(flat.Text.IsSet());
+   EXPECT_TRUE(flat.Color.IsSet());
+   EXPECT_EQ(flat.Color.Value(), FlatTestEnum::RED);
+   EXPECT_TRUE(flat.Enabled.Value());
+
+   // An enum value that is not known leaves the member not set.
+   EXPECT_TRUE(flat.FromString(_T("{\"color\":\"blue\"}")));
+   EXPECT_FALSE(flat.Color.IsSet());
+
+   EXPECT_TRUE(flat.FromString(_T("")));
+   EXPECT_TRUE(flat.FromString(_T("null")));
+}
+
+TEST(Core_JSONFlat, invalidText)
+{
+   FlatSample flat;
+
+   EXPECT_FALSE(flat.FromString(_T("{\"number\":12")));
+   EXPECT_FALSE(flat.FromString(_T("{\"number\":twelve}")));
+   EXPECT_FALSE(flat.FromString(_T("{\"text\":\"not closed}")));
+   EXPECT_FALSE(flat.FromString(_T("[1,2]")));
+   EXPECT_FALSE(flat.FromString(_T("{\"points\":[{\"x\":1}")));
+}
+
+TEST(Core_JSONFlat, reusedArrays)
+{
+   FlatSample flat;
+
+   EXPECT_TRUE(flat.FromString(_T("{\"points\":[{\"x\":1,\"y\":2},{\"x\":3,\"y\":4}]}")));
+   ASSERT_EQ(flat.Points.Length(), 2u);
+
+   // The elements are reused, what is not in the new text must not be left from the previous one.
+   EXPECT_TRUE(flat.FromString(_T("{\"points\":[{\"y\":5}]}")));
+   ASSERT_EQ(flat.Points.Length(), 1u);
+   EXPECT_FALSE(flat.Points[0].X.IsSet());
+   EXPECT_EQ(flat.Points[0].Y.Value(), 5);
+
+   uint32_t count = 0;
+   for (const FlatSample::PointData& point : flat.Points) {
+      EXPECT_TRUE(point.IsSet());
+      count++;
+   }
+   EXPECT_EQ(count, 1u);
+}
+
+} // Tests
+
+ENUM_CONVERSION_BEGIN(Tests::FlatTestEnum)
+   { WPEFramework::Tests::FlatTestEnum::RED, _TXT("red") },
+   { WPEFramework::Tests::FlatTestEnum::GREEN, _TXT("green") },
+ENUM_CONVERSION_END(Tests::FlatTestEnum)
+
+} // WPEFramework
@@ -0,0 +1,121 @@
+/*
+ * If not stated otherwise in this file or this component's LICENSE file the
+ * following copyright and licenses apply:
+ *
+ * Copyright 2020 RDK Management
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <gtest/gtest.h>
+#include <core/core.h>
+
+namespace WPEFramework {
+namespace Tests {
+
+   // The "jsonrpc+msgpack" websocket subprotocol carries the JSON-RPC envelope as MessagePack, in binary frames.
+   static void RoundTrip(const Core::JSONRPC::Message& message, Core::JSONRPC::Message& received)
+   {
+      std::vector<uint8_t> buffer;
+      string sent;
+      string text;
+
+      message.ToBuffer(buffer);
+      EXPECT_FALSE(buffer.empty());
+      EXPECT_TRUE(received.FromBuffer(buffer));
+
+      message.ToString(sent);
+      received.ToString(text);
+      EXPECT_EQ(text, sent);
+   }
+
+TEST(Core_MessagePack, requestIds)
+{
+   const uint32_t ids[] = { 0, 1, 127, 128, 255, 256, 65535, 65536, 0xFFFFFFFE };
+
+   for (const uint32_t id : ids) {
+      Core::JSONRPC::Message message;
+      Core::JSONRPC::Message received;
+
+      message.Id = id;
+      message.Designator = _T("Controller.1.status");
+      message.Parameters = _T("{\"callsign\":\"Controller\",\"list\":[1,2]}");
+
+      RoundTrip(message, received);
+
+      EXPECT_TRUE(received.Id.IsSet());
+      EXPECT_EQ(received.Id.Value(), id);
+      EXPECT_EQ(received.Designator.Value(), string(_T("Controller.1.status")));
+      EXPECT_EQ(received.Parameters.Value(), string(_T("{\"callsign\":\"Controller\",\"list\":[1,2]}")));
+      EXPECT_FALSE(received.Result.IsSet());
+   }
+}
+
+TEST(Core_MessagePack, errorCodes)
+{
+   const int32_t codes[] = { 0, -1, -31, -32, -33, -128, -129, -200, -32601, -32768, -32769, 40000, -70000 };
+
+   for (const int32_t code : codes) {
+      Core::JSONRPC::Message message;
+      Core::JSONRPC::Message received;
+
+      message.Id = 7;
+      message.Error.Code = code;
+      message.Error.Text = _T("failed");
+
+      RoundTrip(message, received);
+
+      EXPECT_TRUE(received.Error.Code.IsSet());
+      EXPECT_EQ(received.Error.Code.Value(), code);
+      EXPECT_EQ(received.Error.Text.Value(), string(_T("failed")));
+   }
+}
+
+TEST(Core_MessagePack, resultLengths)
+{
+   // Around the fixstr (31), str8 (255) and str16 boundaries.
+   const uint16_t lengths[] = { 0, 1, 31, 32, 255, 256, 4000 };
+
+   for (const uint16_t length : lengths) {
+      Core::JSONRPC::Message message;
+      Core::JSONRPC::Message received;
+      const string result(_T("\"") + string(length, 'r') + _T("\""));
+
+      message.Id = 1;
+      message.Result = result;
+
+      RoundTrip(message, received);
+
+      EXPECT_EQ(received.Result.Value(), result);
+   }
+}
+
+TEST(Core_MessagePack, smallerThanText)
+{
+   Core::JSONRPC::Message message;
+   std::vector<uint8_t> buffer;
+   string text;
+
+   message.Id = 1000;
+   message.Designator = _T("DeviceInfo.1.systeminfo");
+   message.Parameters = _T("{}");
+
+   message.ToBuffer(buffer);
+   message.ToString(text);
+
+   EXPECT_LT(buffer.size(), text.length());
+}
+
+} // Tests
+} // WPEFramework
@@ -0,0 +1,116 @@
+/*
+ * If not stated otherwise in this file or this component's LICENSE file the
+ * following copyright and licenses apply:
+ *
+ * Copyright 2020 RDK Management
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+#include <core/core.h>
+
+#include <thread>
+
+namespace WPEFramework {
+namespace Tests {
+
+TEST(Core_Metrics, histogramBuckets)
+{
+   // Every value lands in the bucket that covers it, the buckets are contiguous.
+   for (uint64_t value = 0; value < (1 << 20); value += 7) {
+      const uint32_t index = Core::Histogram::Index(value);
+
+      EXPECT_LE(Core::Histogram::Lowest(index), value);
+      EXPECT_GE(Core::Histogram::Highest(index), value);
+   }
+   for (uint32_t index = 1; index < Core::Histogram::Buckets; index++) {
+      EXPECT_EQ(Core::Histogram::Highest(index - 1) + 1, Core::Histogram::Lowest(index));
+   }
+
+   EXPECT_EQ(Core::Histogram::Index(~0ULL), Core::Histogram::Buckets - 1);
+}
+
+TEST(Core_Metrics, histogramPercentiles)
+{
+   Core::Histogram histogram;
+
+   EXPECT_EQ(histogram.Count(), 0u);
+   EXPECT_EQ(histogram.Min(), 0u);
+   EXPECT_EQ(histogram.Percentile(50), 0u);
+
+   for (uint64_t value = 1; value <= 1000; value++) {
+      histogram.Record(value * 1000);
+   }
+
+   EXPECT_EQ(histogram.Count(), 1000u);
+   EXPECT_EQ(histogram.Min(), 1000u);
+   EXPECT_EQ(histogram.Max(), 1000000u);
+   EXPECT_EQ(histogram.Average(), 500500u);
+
+   // Within one bucket, 1/16th, of the exact percentile.
+   EXPECT_GE(histogram.Percentile(50), 500000u);
+   EXPECT_LE(histogram.Percentile(50), 500000u + (500000u / 16));
+   EXPECT_GE(histogram.Percentile(99), 990000u);
+   EXPECT_LE(histogram.Percentile(99), 1000000u);
+   EXPECT_EQ(histogram.Percentile(100), 1000000u);
+
+   histogram.Reset();
+
+   EXPECT_EQ(histogram.Count(), 0u);
+   EXPECT_EQ(histogram.Max(), 0u);
+   EXPECT_EQ(histogram.Percentile(99), 0u);
+}
+
+TEST(Core_Metrics, registryConcurrentRecord)
+{
+   Core::Metrics& metrics(Core::Metrics::Instance());
+   std::vector<std::thread> threads;
+
+   for (uint8_t thread = 0; thread < 4; thread++) {
+      threads.emplace_back([&metrics, thread]() {
+         for (uint32_t call = 0; call < 10000; call++) {
+            metrics.Find(_T("Test.method")).Record(100, ((call % 10) == 0), 10, 20);
+            metrics.Find(0x31, thread).Record(200, false, 1, 2);
+         }
+      });
+   }
+   for (std::thread& thread : threads) {
+      thread.join();
+   }
+
+   const Core::Metrics::Entry& entry(metrics.Find(_T("Test.method")));
+   EXPECT_EQ(entry.Latency().Count(), 40000u);
+   EXPECT_EQ(entry.Errors(), 4000u);
+   EXPECT_EQ(entry.BytesIn(), 400000u);
+   EXPECT_EQ(entry.BytesOut(), 800000u);
+   EXPECT_EQ(metrics.Find(0x31, 2).Designator(), _T("0x00000031.2"));
+   EXPECT_EQ(&metrics.Find(0x31, 2), &metrics.Find(_T("0x00000031.2")));
+
+   uint32_t entries = 0;
+   metrics.Visit([&entries](const Core::Metrics::Entry& entry) {
+      EXPECT_NE(entry.Latency().Count(), 0u);
+      entries++;
+   });
+   EXPECT_EQ(entries, 5u);
+
+   metrics.Reset();
+
+   EXPECT_EQ(entry.Latency().Count(), 0u);
+   EXPECT_EQ(entry.Errors(), 0u);
+
+   Core::Singleton::Dispose();
+}
+
+} // Tests
+} // WPEFramework
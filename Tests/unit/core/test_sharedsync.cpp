@@ -0,0 +1,151 @@
+/*
+ * If not stated otherwise in this file or this component's LICENSE file the
+ * following copyright and licenses apply:
+ *
+ * Copyright 2020 RDK Management
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "../IPTestAdministrator.h"
+
+#include <gtest/gtest.h>
+#include <core/core.h>
+
+#include <sys/mman.h>
+
+namespace WPEFramework {
+namespace Tests {
+
+struct SharedSyncArea {
+   Core::SharedMutex mutex;
+   Core::SharedSemaphore semaphore;
+   Core::SharedSignal signal;
+};
+
+static SharedSyncArea* g_syncArea = nullptr;
+
+static SharedSyncArea* CreateSyncArea()
+{
+   void* memory = mmap(nullptr, sizeof(SharedSyncArea), PROT_READ | PROT_WRITE, MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+   EXPECT_NE(memory, MAP_FAILED);
+
+   SharedSyncArea* area = static_cast<SharedSyncArea*>(memory);
+   area->mutex.Initialize();
+   area->semaphore.Initialize(0);
+   area->signal.Initialize();
+
+   return (area);
+}
+
+TEST(Core_SharedSync, mutexTimeout)
+{
+   SharedSyncArea* area = CreateSyncArea();
+
+   EXPECT_EQ(area->mutex.Lock(0), Core::ERROR_NONE);
+   EXPECT_TRUE(area->mutex.IsLocked());
+
+   Core::StopWatch timer;
+   EXPECT_EQ(area->mutex.Lock(50), Core::ERROR_TIMEDOUT);
+   EXPECT_GE(timer.Elapsed(), 50 * 1000u);
+
+   EXPECT_EQ(area->mutex.Unlock(), Core::ERROR_NONE);
+   EXPECT_FALSE(area->mutex.IsLocked());
+
+   munmap(area, sizeof(SharedSyncArea));
+}
+
+TEST(Core_SharedSync, semaphoreCounting)
+{
+   SharedSyncArea* area = CreateSyncArea();
+
+   EXPECT_TRUE(area->semaphore.IsLocked());
+   EXPECT_EQ(area->semaphore.Lock(10), Core::ERROR_TIMEDOUT);
+
+   area->semaphore.Unlock();
+   area->semaphore.Unlock();
+
+   EXPECT_EQ(area->semaphore.Lock(0), Core::ERROR_NONE);
+   EXPECT_EQ(area->semaphore.Lock(0), Core::ERROR_NONE);
+   EXPECT_EQ(area->semaphore.Lock(0), Core::ERROR_TIMEDOUT);
+
+   munmap(area, sizeof(SharedSyncArea));
+}
+
+TEST(Core_SharedSync, signalTimeout)
+{
+   SharedSyncArea* area = CreateSyncArea();
+
+   uint32_t sequence = area->signal.Sequence();
+   EXPECT_EQ(area->signal.Wait(sequence, 20), 0u);
+
+   area->signal.Signal();
+   EXPECT_EQ(area->signal.Wait(sequence, 20), 20u);
+
+   munmap(area, sizeof(SharedSyncArea));
+}
+
+TEST(Core_SharedSync, crossProcess)
+{
+   g_syncArea = CreateSyncArea();
+
+   IPTestAdministrator::OtherSideMain otherSide = [](IPTestAdministrator& testAdmin) {
+      uint32_t sequence = g_syncArea->signal.Sequence();
+
+      testAdmin.Sync("setup");
+
+      EXPECT_EQ(g_syncArea->semaphore.Lock(Core::infinite), Core::ERROR_NONE);
+      EXPECT_NE(g_syncArea->signal.Wait(sequence, 2000), 0u);
+
+      testAdmin.Sync("done");
+   };
+
+   IPTestAdministrator testAdmin(otherSide);
+
+   testAdmin.Sync("setup");
+
+   g_syncArea->semaphore.Unlock();
+   g_syncArea->signal.Signal();
+
+   testAdmin.Sync("done");
+
+   munmap(g_syncArea, sizeof(SharedSyncArea));
+   g_syncArea = nullptr;
+}
+
+TEST(Core_SharedSync, ownerDied)
+{
+   g_syncArea = CreateSyncArea();
+
+   IPTestAdministrator::OtherSideMain otherSide = [](IPTestAdministrator& testAdmin) {
+      EXPECT_EQ(g_syncArea->mutex.Lock(Core::infinite), Core::ERROR_NONE);
+
+      // Leave without unlocking, the process will be terminated holding the lock.
+      testAdmin.Sync("locked");
+   };
+
+   IPTestAdministrator testAdmin(otherSide);
+
+   testAdmin.Sync("locked");
+
+   EXPECT_EQ(g_syncArea->mutex.Lock(1000), Core::ERROR_PROCESS_TERMINATED);
+   EXPECT_EQ(g_syncArea->mutex.Unlock(), Core::ERROR_NONE);
+   EXPECT_EQ(g_syncArea->mutex.Lock(0), Core::ERROR_NONE);
+   EXPECT_EQ(g_syncArea->mutex.Unlock(), Core::ERROR_NONE);
+
+   munmap(g_syncArea, sizeof(SharedSyncArea));
+   g_syncArea = nullptr;
+}
+
+} // Tests
+} // WPEFramework
@@ -0,0 +1,172 @@
+/*
+ * If not stated otherwise in this file or this component's LICENSE file the
+ * following copyright and licenses apply:
+ *
+ * Copyright 2020 RDK Management
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+#include <core/core.h>
+
+#include <atomic>
+#include <sys/syscall.h>
+
+namespace {
+
+   // The wall clock as everything in this process sees it, can be stepped without touching the system.
+   std::atomic<int64_t> _wallStep(0);
+
+}
+
+extern "C" int clock_gettime(clockid_t clock, struct timespec* time) noexcept
+{
+   int result = static_cast<int>(::syscall(SYS_clock_gettime, clock, time));
+
+   if ((result == 0) && (clock == CLOCK_REALTIME)) {
+      time->tv_sec += static_cast<time_t>(_wallStep.load());
+   }
+
+   return (result);
+}
+
+namespace WPEFramework {
+namespace Tests {
+
+   class StepHandler {
+   public:
+      StepHandler() = delete;
+      StepHandler& operator=(const StepHandler&) = delete;
+
+      StepHandler(Core::Event& fired, std::atomic<uint64_t>& scheduled)
+         : _fired(fired)
+         , _scheduled(scheduled)
+      {
+      }
+      StepHandler(const StepHandler& copy)
+         : _fired(copy._fired)
+         , _scheduled(copy._scheduled)
+      {
+      }
+
+   public:
+      bool operator==(const StepHandler& rhs) const
+      {
+         return (&_fired == &rhs._fired);
+      }
+      bool operator!=(const StepHandler& rhs) const
+      {
+         return (!operator==(rhs));
+      }
+      uint64_t Timed(const uint64_t scheduledTime)
+      {
+         _scheduled = scheduledTime;
+         _fired.SetEvent();
+         return (0);
+      }
+
+   private:
+      Core::Event& _fired;
+      std::atomic<uint64_t>& _scheduled;
+   };
+
+TEST(Core_Time, brokenDownWhenAsked)
+{
+   // Sat, 29 Feb 2020 12:34:56.789 GMT
+   const uint64_t ticks = (1582979696ULL * 1000000ULL) + 789000ULL;
+   Core::Time time(ticks);
+   Core::Time copy(time);
+
+   EXPECT_EQ(time.Ticks(), ticks);
+   EXPECT_EQ(time.Year(), 2020u);
+   EXPECT_EQ(time.Month(), 2);
+   EXPECT_EQ(time.Day(), 29);
+   EXPECT_EQ(time.Hours(), 12);
+   EXPECT_EQ(time.Minutes(), 34);
+   EXPECT_EQ(time.Seconds(), 56);
+   EXPECT_EQ(time.MilliSeconds(), 789u);
+   EXPECT_EQ(time.DayOfWeek(), 6);
+   EXPECT_EQ(time.DayOfYear(), 59);
+
+   // A copy taken before anything was broken down, breaks down to the same.
+   EXPECT_EQ(copy.ToRFC1123(false), string(_T("Sat, 29 Feb 2020 12:34:56 GMT")));
+   EXPECT_EQ(copy.Add(1000).ToISO8601(false), string(_T("2020-02-29T12:34:57Z")));
+
+   Core::Time now(Core::Time::Now());
+   time_t seconds = static_cast<time_t>(now.Ticks() / 1000000);
+   struct tm expected;
+   gmtime_r(&seconds, &expected);
+   EXPECT_EQ(now.Minutes(), expected.tm_min);
+   EXPECT_EQ(now.Day(), expected.tm_mday);
+}
+
+TEST(Core_Time, monotonicTicks)
+{
+   const uint64_t start = Core::Time::MonotonicTicks();
+   const uint64_t coarse = Core::Time::MonotonicTicks(true);
+
+   SleepMs(20);
+
+   const uint64_t end = Core::Time::MonotonicTicks();
+
+   EXPECT_GE(end - start, 15000u);
+   // The coarse clock is behind by at most a few kernel ticks.
+   EXPECT_LT((coarse > start ? coarse - start : start - coarse), 100000u);
+
+   // Stepping the wall clock does not move it.
+   _wallStep = -3600;
+   const uint64_t stepped = Core::Time::MonotonicTicks();
+   _wallStep = 0;
+   EXPECT_GE(stepped, end);
+   EXPECT_LT(stepped - end, 1000000u);
+}
+
+TEST(Core_Time, timerSurvivesWallClockStep)
+{
+   Core::TimerType<StepHandler> timer(1024 * 64, _T("StepTimer"));
+   Core::Event fired(false, true);
+   std::atomic<uint64_t> scheduled(0);
+
+   // Back: an hour later on the wall clock, the timer still fires 200ms from now.
+   uint64_t start = Core::Time::MonotonicTicks();
+   timer.Schedule(Core::Time::Now().Add(200), StepHandler(fired, scheduled));
+   _wallStep = -3600;
+
+   EXPECT_EQ(fired.Lock(5000), Core::ERROR_NONE);
+   EXPECT_GE(Core::Time::MonotonicTicks() - start, 150000u);
+
+   // And tells the time it was scheduled for, on the wall clock as it is now.
+   uint64_t now = Core::Time::Now().Ticks();
+   EXPECT_LT((now > scheduled ? now - scheduled : scheduled - now), 1000000u);
+
+   _wallStep = 0;
+   fired.ResetEvent();
+
+   // Forward: an hour earlier on the wall clock, the timer does not fire right away.
+   start = Core::Time::MonotonicTicks();
+   timer.Schedule(Core::Time::Now().Add(300), StepHandler(fired, scheduled));
+   _wallStep = 3600;
+
+   EXPECT_EQ(fired.Lock(100), Core::ERROR_TIMEDOUT);
+   EXPECT_EQ(fired.Lock(5000), Core::ERROR_NONE);
+   EXPECT_GE(Core::Time::MonotonicTicks() - start, 250000u);
+
+   now = Core::Time::Now().Ticks();
+   EXPECT_LT((now > scheduled ? now - scheduled : scheduled - now), 1000000u);
+
+   _wallStep = 0;
+}
+
+} // Tests
+} // WPEFramework
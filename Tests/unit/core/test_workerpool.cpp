@@ -0,0 +1,171 @@
+/*
+ * If not stated otherwise in this file or this component's LICENSE file the
+ * following copyright and licenses apply:
+ *
+ * Copyright 2020 RDK Management
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+#include <core/core.h>
+
+#include <atomic>
+
+namespace WPEFramework {
+namespace Tests {
+
+   class StrandJob : public Core::IDispatch {
+   public:
+      StrandJob() = delete;
+      StrandJob(const StrandJob&) = delete;
+      StrandJob& operator=(const StrandJob&) = delete;
+
+      StrandJob(std::vector<uint32_t>& log, Core::CriticalSection& lock, std::atomic<uint32_t>& running, std::atomic<uint32_t>& overlaps, const uint32_t id, const uint32_t delay)
+         : _log(log)
+         , _lock(lock)
+         , _running(running)
+         , _overlaps(overlaps)
+         , _id(id)
+         , _delay(delay)
+      {
+      }
+      ~StrandJob() override
+      {
+      }
+
+   public:
+      void Dispatch() override
+      {
+         if (_running.fetch_add(1) != 0) {
+            _overlaps++;
+         }
+
+         SleepMs(_delay);
+
+         _lock.Lock();
+         _log.push_back(_id);
+         _lock.Unlock();
+
+         _running--;
+      }
+
+   private:
+      std::vector<uint32_t>& _log;
+      Core::CriticalSection& _lock;
+      std::atomic<uint32_t>& _running;
+      std::atomic<uint32_t>& _overlaps;
+      const uint32_t _id;
+      const uint32_t _delay;
+   };
+
+   bool WaitFor(const std::vector<uint32_t>& log, Core::CriticalSection& lock, const uint32_t count)
+   {
+      uint32_t rounds = 500;
+      bool done = false;
+
+      while ((done == false) && (rounds-- != 0)) {
+         lock.Lock();
+         done = (log.size() >= count);
+         lock.Unlock();
+
+         if (done == false) {
+            SleepMs(10);
+         }
+      }
+
+      return (done);
+   }
+
+TEST(Core_WorkerPool, strandsKeepOrder)
+{
+   Core::WorkerPool pool(4, 0, 16);
+   Core::CriticalSection lock;
+   std::vector<uint32_t> first, second;
+   std::atomic<uint32_t> running[2];
+   std::atomic<uint32_t> overlaps(0);
+
+   running[0] = 0;
+   running[1] = 0;
+
+   // The earlier jobs take longer, on their own the later ones would overtake them.
+   for (uint32_t index = 0; index < 8; index++) {
+      pool.Submit(1, Core::ProxyType<Core::IDispatch>(Core::ProxyType<StrandJob>::Create(first, lock, running[0], overlaps, index, 8 - index)));
+      pool.Submit(2, Core::ProxyType<Core::IDispatch>(Core::ProxyType<StrandJob>::Create(second, lock, running[1], overlaps, index, 8 - index)));
+   }
+
+   EXPECT_TRUE(WaitFor(first, lock, 8));
+   EXPECT_TRUE(WaitFor(second, lock, 8));
+   EXPECT_EQ(overlaps.load(), 0u);
+
+   lock.Lock();
+   for (uint32_t index = 0; index < 8; index++) {
+      EXPECT_EQ(first[index], index);
+      EXPECT_EQ(second[index], index);
+   }
+   lock.Unlock();
+
+   // Once drained, the key starts over, in order again.
+   pool.Submit(1, Core::ProxyType<Core::IDispatch>(Core::ProxyType<StrandJob>::Create(first, lock, running[0], overlaps, 8, 5)));
+   pool.Submit(1, Core::ProxyType<Core::IDispatch>(Core::ProxyType<StrandJob>::Create(first, lock, running[0], overlaps, 9, 0)));
+   EXPECT_TRUE(WaitFor(first, lock, 10));
+
+   lock.Lock();
+   EXPECT_EQ(first[8], 8u);
+   EXPECT_EQ(first[9], 9u);
+   lock.Unlock();
+
+   pool.Stop();
+}
+
+TEST(Core_WorkerPool, revokeFromStrand)
+{
+   Core::WorkerPool pool(2, 0, 16);
+   Core::CriticalSection lock;
+   std::vector<uint32_t> log;
+   std::atomic<uint32_t> running(0);
+   std::atomic<uint32_t> overlaps(0);
+
+   Core::ProxyType<Core::IDispatch> slow(Core::ProxyType<StrandJob>::Create(log, lock, running, overlaps, 1, 100));
+   Core::ProxyType<Core::IDispatch> pending(Core::ProxyType<StrandJob>::Create(log, lock, running, overlaps, 2, 0));
+   Core::ProxyType<Core::IDispatch> last(Core::ProxyType<StrandJob>::Create(log, lock, running, overlaps, 3, 0));
+
+   pool.Submit(7, slow);
+   pool.Submit(7, pending);
+   pool.Submit(7, last);
+
+   SleepMs(20);
+
+   // Still waiting behind the slow one, it is taken out and will not run.
+   EXPECT_EQ(pool.Revoke(pending, 1000), Core::ERROR_NONE);
+
+   // Running, revoke waits till it is done.
+   EXPECT_EQ(pool.Revoke(slow, 1000), Core::ERROR_NONE);
+
+   lock.Lock();
+   ASSERT_GE(log.size(), 1u);
+   EXPECT_EQ(log[0], 1u);
+   lock.Unlock();
+
+   EXPECT_TRUE(WaitFor(log, lock, 2));
+
+   lock.Lock();
+   ASSERT_EQ(log.size(), 2u);
+   EXPECT_EQ(log[1], 3u);
+   lock.Unlock();
+
+   pool.Stop();
+}
+
+} // Tests
+} // WPEFramework
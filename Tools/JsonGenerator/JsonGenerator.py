@@ -70,6 +70,7 @@ except:
 INDENT_SIZE = 4
 VERIFY = True
 ALWAYS_COPYCTOR = False
+FLAT_CLASSES = False
 KEEP_EMPTY = False
 CLASSNAME_FROM_REF = True
 DEFAULT_EMPTY_STRING = ""
@@ -1777,6 +1778,141 @@ def EmitObjects(root, emit, emitCommon=False):
             emit.Line("}; // class %s" % jsonObj.CppClass())
             emit.Line()
 
+    def FlatType(jsonObj):
+        if isinstance(jsonObj, (JsonArray, JsonObject)):
+            return FlatClass(jsonObj)
+        else:
+            return TypePrefix("Flat::Scalar<%s>" % FlatClass(jsonObj))
+
+    def FlatClass(jsonObj):
+        if isinstance(jsonObj, JsonArray):
+            return TypePrefix("Flat::Array<%s>" % FlatClass(jsonObj.Items()))
+        elif isinstance(jsonObj, JsonObject):
+            return jsonObj.CppClass() if jsonObj.properties else TypePrefix("Flat::Opaque")
+        elif isinstance(jsonObj, JsonEnum):
+            # The enums are shared with the container classes
+            enum = jsonObj.origRef if jsonObj.IsDuplicate() else jsonObj
+            return GetNamespace(root, enum) + enum.CppClass()
+        else:
+            return jsonObj.CppStdClass()
+
+    def EmitFlatClass(jsonObj, allowDup=False):
+        # Bail out if a duplicated class, same as for the container classes
+        if isinstance(jsonObj, JsonObject) and not jsonObj.properties:
+            return
+        if jsonObj.IsDuplicate() or (not allowDup and jsonObj.RefCount() > 1):
+            return
+        if isinstance(jsonObj, JsonMethod) and jsonObj.included_from:
+            return
+        isClass = not isinstance(jsonObj, (JsonRpcSchema, JsonMethod))
+        if isClass:
+            print("Emitting flat class '{}' (source: '{}')".format(jsonObj.CppClass(), jsonObj.OrigName()))
+            emit.Line("class %s {" % jsonObj.CppClass())
+            emit.Line("public:")
+            emit.Indent()
+
+        # Handle nested classes!
+        for obj in SortByDependency(jsonObj.Objects()):
+            EmitFlatClass(obj)
+
+        if isClass:
+            props = jsonObj.Properties()
+            emit.Line("void Clear()")
+            emit.Line("{")
+            emit.Indent()
+            for prop in props:
+                emit.Line("%s.Clear();" % prop.CppName())
+            emit.Unindent()
+            emit.Line("}")
+            emit.Line("bool IsSet() const")
+            emit.Line("{")
+            emit.Indent()
+            emit.Line("return (%s);" % " || ".join(map(lambda prop: "(%s.IsSet() == true)" % prop.CppName(), props)))
+            emit.Unindent()
+            emit.Line("}")
+            emit.Line("void ToString(string& text) const")
+            emit.Line("{")
+            emit.Indent()
+            emit.Line("text.clear();")
+            emit.Line("Serialize(text);")
+            emit.Unindent()
+            emit.Line("}")
+            emit.Line("bool FromString(const string& text)")
+            emit.Line("{")
+            emit.Indent()
+            emit.Line("%s reader(text);" % TypePrefix("Flat::Reader"))
+            emit.Line("Deserialize(reader);")
+            emit.Line("return (reader.IsValid());")
+            emit.Unindent()
+            emit.Line("}")
+            emit.Line("void Serialize(string& text) const")
+            emit.Line("{")
+            emit.Indent()
+            emit.Line("%s writer(text);" % TypePrefix("Flat::Writer"))
+            for index, prop in enumerate(props):
+                emit.Line("writer.Write(Fields()[%i], %s);" % (index, prop.CppName()))
+            emit.Line("writer.End();")
+            emit.Unindent()
+            emit.Line("}")
+            emit.Line("void Deserialize(%s& reader)" % TypePrefix("Flat::Reader"))
+            emit.Line("{")
+            emit.Indent()
+            emit.Line("uint8_t index;")
+            emit.Line()
+            emit.Line("Clear();")
+            emit.Line()
+            emit.Line("if (reader.Begin() == true) {")
+            emit.Indent()
+            emit.Line("while (reader.Next(Fields(), %i, index) == true) {" % len(props))
+            emit.Indent()
+            emit.Line("switch (index) {")
+            for index, prop in enumerate(props):
+                emit.Line("case %i:" % index)
+                emit.Indent()
+                emit.Line("reader.Read(%s);" % prop.CppName())
+                emit.Line("break;")
+                emit.Unindent()
+            emit.Line("default:")
+            emit.Indent()
+            emit.Line("reader.Skip();")
+            emit.Line("break;")
+            emit.Unindent()
+            emit.Line("}")
+            emit.Unindent()
+            emit.Line("}")
+            emit.Unindent()
+            emit.Line("}")
+            emit.Unindent()
+            emit.Line("}")
+            emit.Line()
+            emit.Unindent()
+            emit.Line("private:")
+            emit.Indent()
+            emit.Line("static const %s* Fields()" % TypePrefix("Flat::Field"))
+            emit.Line("{")
+            emit.Indent()
+            emit.Line("static constexpr %s fields[] = {" % TypePrefix("Flat::Field"))
+            emit.Indent()
+            for prop in props:
+                if len(prop.JsonName()) > 255:
+                    raise JsonParseError("Property name '%s' is too long for a flat class" % prop.JsonName())
+                emit.Line("{ _T(\"%s\"), %i }," % (prop.JsonName(), len(prop.JsonName())))
+            emit.Unindent()
+            emit.Line("};")
+            emit.Line("return (fields);")
+            emit.Unindent()
+            emit.Line("}")
+            emit.Line()
+            emit.Unindent()
+            emit.Line("public:")
+            emit.Indent()
+            for prop in props:
+                comment = prop.OrigName() if isinstance(prop, JsonMethod) else prop.Description()
+                emit.Line("%s %s;%s" % (FlatType(prop), prop.CppName(), (" // " + comment) if comment else ""))
+            emit.Unindent()
+            emit.Line("}; // class %s" % jsonObj.CppClass())
+            emit.Line()
+
     count = 0
     if enumTracker.Objects():
         count = 0
@@ -1787,6 +1923,8 @@ def EmitObjects(root, emit, emitCommon=False):
     emit.Line("#pragma once")
     emit.Line()
     emit.Line("#include <core/JSON.h>")
+    if FLAT_CLASSES:
+        emit.Line("#include <core/JSONFlat.h>")
     if count:
         emit.Line("#include <core/Enumerate.h>")
     emit.Line()
@@ -1820,6 +1958,22 @@ def EmitObjects(root, emit, emitCommon=False):
         emit.Line("//")
         emit.Line()
         EmitClass(root)
+    if FLAT_CLASSES and (objTracker.CommonObjects() or root.Objects()):
+        print("Emitting flat classes...")
+        emit.Line("// Flat classes, no registration of the members, (de)serialized from a constexpr table of the fields")
+        emit.Line("//")
+        emit.Line()
+        emit.Line("namespace Flat {")
+        emit.Indent()
+        emit.Line()
+        if emitCommon:
+            for obj in objTracker.CommonObjects():
+                if not obj.included_from:
+                    EmitFlatClass(obj, True)
+        EmitFlatClass(root)
+        emit.Unindent()
+        emit.Line("} // namespace Flat")
+        emit.Line()
     emit.Unindent()
     emit.Line("} // namespace %s" % root.JsonName())
     emit.Unindent()
@@ -2509,6 +2663,12 @@ if __name__ == "__main__":
         action="store_true",
         default=False,
         help="always emit a copy constructor and assignment operator for a class (default: emit only when needed)")
+    argparser.add_argument(
+        "--flat",
+        dest="flat",
+        action="store_true",
+        default=False,
+        help="also emit flat classes, (de)serialized from a constexpr table of the fields (default: emit the container classes only)")
     argparser.add_argument("--keep-empty",
                            dest="keep_empty",
                            action="store_true",
@@ -2558,6 +2718,7 @@ if __name__ == "__main__":
     VERIFY = not args.no_warnings
     INDENT_SIZE = args.indent_size
     ALWAYS_COPYCTOR = args.copy_ctor
+    FLAT_CLASSES = args.flat
     KEEP_EMPTY = args.keep_empty
     CLASSNAME_FROM_REF = not args.no_ref_names
     DEFAULT_EMPTY_STRING = args.def_string